@@ -154,6 +154,8 @@ int BaseClient::pollOne(const boost::posix_time::time_duration& duration)
 {
     int pollResult = m_connection.pollOne(duration);
     if (pollResult == 0) {
+        //Send the replies to all received operations together.
+        m_connection.beginBatch();
         Operation input;
         while ((input = m_connection.pop()).isValid()) {
             if (input->getClassNo() == Atlas::Objects::Operation::ERROR_NO) {
@@ -173,6 +175,7 @@ int BaseClient::pollOne(const boost::posix_time::time_duration& duration)
                 send(*I);
             }
         }
+        m_connection.flush();
     }
     return pollResult;
 }
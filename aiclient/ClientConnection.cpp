@@ -86,6 +86,10 @@ int ClientConnection::wait()
 // Waits for response from server. Used when we are expecting a login response
 // Return whether or not an error occured
 {
+   //The server can't reply to anything held back in a batch.
+   if (m_batchedOps > 0) {
+      writeBatch();
+   }
    error_flag = false;
    reply_flag = false;
    while (!reply_flag) {
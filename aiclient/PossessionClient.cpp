@@ -55,7 +55,11 @@ PossessionClient::~PossessionClient()
 
 bool PossessionClient::idle()
 {
-    return m_operationsDispatcher.idle();
+    //Send the operations of all minds handled in this round together.
+    m_connection.beginBatch();
+    bool result = m_operationsDispatcher.idle();
+    m_connection.flush();
+    return result;
 }
 
 double PossessionClient::secondsUntilNextOp() const
@@ -73,6 +77,16 @@ void PossessionClient::markQueueAsClean()
     m_operationsDispatcher.markQueueAsClean();
 }
 
+size_t PossessionClient::getMindCount() const
+{
+    return m_minds.size();
+}
+
+double PossessionClient::getDispatchLag() const
+{
+    return m_operationsDispatcher.getDispatchLag();
+}
+
 void PossessionClient::addLocatedEntity(LocatedEntity* entity)
 {
     m_minds.insert(std::make_pair(entity->getIntId(), entity));
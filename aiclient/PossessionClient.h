@@ -42,6 +42,14 @@ class PossessionClient: public BaseClient, public LocatedEntityRegistry
         bool isQueueDirty() const;
         void markQueueAsClean();
 
+        size_t getMindCount() const;
+
+        /**
+         * @brief Gets how late the minds' operations were dispatched in the last call to idle().
+         * @return Seconds.
+         */
+        double getDispatchLag() const;
+
         void createAccount(const std::string& accountId);
 
         virtual void addLocatedEntity(LocatedEntity* mind);
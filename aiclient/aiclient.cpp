@@ -20,6 +20,13 @@
 #include "PossessionClient.h"
 #include "rulesets/Python_API.h"
 #include "rulesets/PythonScriptFactory.h"
+#include "rulesets/PythonWrapper.h"
+#include "rulesets/MemEntity.h"
+#include "rulesets/MemMap.h"
+#include "rulesets/mind/AwareMind.h"
+#include "rulesets/mind/SharedTerrain.h"
+
+#include "navigation/Awareness.h"
 
 #include "common/debug.h"
 #include "common/globals.h"
@@ -27,14 +34,24 @@
 #include "common/compose.hpp"
 #include "common/sockets.h"
 #include "common/Inheritance.h"
+#include "common/Monitors.h"
+#include "common/Variable.h"
 #include "common/SystemTime.h"
 #include "common/system.h"
 #include "common/RuleTraversalTask.h"
 
 #define _GLIBCXX_USE_NANOSLEEP 1
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
 #include <thread>
+#include <vector>
 
 #include <sys/prctl.h>
+#include <sys/wait.h>
+#include <signal.h>
 
 using Atlas::Message::MapType;
 using Atlas::Objects::Root;
@@ -57,6 +74,125 @@ STRING_OPTION(password, "", "aiclient", "password", "Password to use to authenti
 
 static bool debug_flag = false;
 
+/// \brief Interval in seconds between the reports each worker logs.
+static const int WORKER_REPORT_INTERVAL = 60;
+
+/// \brief Interval in seconds between writes of the monitors file.
+static const int MONITORS_WRITE_INTERVAL = 10;
+
+/// \brief Max time in seconds the supervisor waits before restarting a worker which keeps exiting.
+static const int WORKER_MAX_RESTART_DELAY = 60;
+
+/// \brief Time in seconds a worker must have run for its restart delay to be reset.
+static const int WORKER_STABLE_TIME = 60;
+
+/// \brief Write the numeric monitors of this process to a file.
+///
+/// The aiclient has no http interface like the server, so this is where its
+/// monitors can be read. The file is replaced as a whole, so that a reader
+/// never sees it half written.
+static void writeMonitors(const std::string & path)
+{
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file) {
+            log(WARNING, String::compose("Could not write monitors to %1.", tmpPath));
+            return;
+        }
+        Monitors::instance()->sendNumerics(file);
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        log(WARNING, String::compose("Could not write monitors to %1.", path));
+    }
+}
+
+/// \brief Fork the worker processes which run the minds.
+///
+/// Each worker connects to the server on its own, and the server spreads the
+/// minds over all connected clients. The calling process stays on as a
+/// supervisor which restarts workers that exit, until it's told to shut down.
+/// This must be done before any threads are started or Python is set up.
+///
+/// @return the index of the worker in a worker process, or -1 in the supervisor
+/// once it's done.
+static int superviseWorkers(int workerCount)
+{
+    typedef std::chrono::steady_clock clock;
+    std::vector<pid_t> workers(workerCount, 0);
+    std::vector<clock::time_point> startTimes(workerCount);
+    std::vector<clock::time_point> restartTimes(workerCount);
+    //Workers which exit soon after being started are restarted with an increasing delay.
+    std::vector<int> restartDelays(workerCount, 0);
+
+    auto spawn = [&](int index) -> bool {
+        pid_t pid = fork();
+        if (pid == 0) {
+            //Kill the worker if the supervisor is killed.
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            //Each worker has its own system account, whose password must not be the same as the other workers'.
+            std::random_device device;
+            ::srand(device() ^ (unsigned int)getpid());
+            return true;
+        }
+        if (pid < 0) {
+            log(ERROR, String::compose("Could not fork AI worker %1.", index));
+        } else {
+            log(INFO, String::compose("Started AI worker %1 with pid %2.", index, pid));
+        }
+        workers[index] = pid;
+        startTimes[index] = clock::now();
+        return false;
+    };
+
+    for (int i = 0; i < workerCount; ++i) {
+        if (spawn(i)) {
+            return i;
+        }
+    }
+
+    while (!exit_flag) {
+        int status;
+        pid_t pid;
+        while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+            auto I = std::find(workers.begin(), workers.end(), pid);
+            if (I != workers.end()) {
+                auto index = I - workers.begin();
+                *I = 0;
+                if (clock::now() - startTimes[index] < std::chrono::seconds(WORKER_STABLE_TIME)) {
+                    restartDelays[index] = std::min(std::max(1, restartDelays[index] * 2), WORKER_MAX_RESTART_DELAY);
+                } else {
+                    restartDelays[index] = 0;
+                }
+                restartTimes[index] = clock::now() + std::chrono::seconds(restartDelays[index]);
+                log(WARNING, String::compose("AI worker %1 exited; restarting it in %2 seconds.", index, restartDelays[index]));
+            }
+        }
+        for (int i = 0; i < workerCount && !exit_flag; ++i) {
+            if (workers[i] <= 0 && clock::now() >= restartTimes[i]) {
+                log(WARNING, String::compose("AI worker %1 is not running; restarting it.", i));
+                if (spawn(i)) {
+                    return i;
+                }
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+
+    log(INFO, "Shutting down AI workers.");
+    for (pid_t pid : workers) {
+        if (pid > 0) {
+            kill(pid, SIGTERM);
+        }
+    }
+    for (pid_t pid : workers) {
+        if (pid > 0) {
+            waitpid(pid, nullptr, 0);
+        }
+    }
+    return -1;
+}
+
 static int tryToConnect(PossessionClient& possessionClient)
 {
     if (possessionClient.connectLocal(client_socket_name) == 0) {
@@ -125,15 +261,91 @@ int main(int argc, char ** argv)
         return 1;
     }
 
+    int ai_workers = 1;
+    readConfigItem(CYPHESIS, "aiworkers", ai_workers);
+    int worker_index = 0;
+    if (ai_workers > 1) {
+        worker_index = superviseWorkers(ai_workers);
+        if (worker_index < 0) {
+            return 0;
+        }
+    }
+
     init_python_api(ruleset_name, false);
 
     //Initialize inheritance explicitly here.
     Inheritance::instance();
 
+    Monitors::instance()->watchPool("mem_entity", MemEntity::pools().stats());
+    Monitors::instance()->watchPool("python_wrapper", PythonWrapper::pools().stats());
+    Monitors::instance()->watch("mind_memories", new Variable<int>(MemMap::s_statistics.memories));
+    Monitors::instance()->watch("mind_memory_entities", new Variable<int>(MemMap::s_statistics.entities));
+    Monitors::instance()->watch("mind_memory_evicted", new Variable<int>(MemMap::s_statistics.evicted));
+    Monitors::instance()->watch("mind_memory_pending_release", new Variable<int>(MemMap::s_statistics.pendingRelease));
+
+    int mind_memory = 0;
+    readConfigItem(CYPHESIS, "mindmemory", mind_memory);
+    if (mind_memory > 0) {
+        MemMap::s_defaultBudget = mind_memory;
+    }
+
+    Monitors::instance()->watch("navmesh_tiles_queued", new Variable<int>(Awareness::s_tileBuildStatistics.queued));
+    Monitors::instance()->watch("navmesh_tiles_built", new Variable<int>(Awareness::s_tileBuildStatistics.built));
+    Monitors::instance()->watch("navmesh_tile_build_ms", new Variable<int>(Awareness::s_tileBuildStatistics.buildMilliseconds));
+    Monitors::instance()->watch("navmesh_tile_latency_ms", new Variable<int>(Awareness::s_tileBuildStatistics.latencyMilliseconds));
+    Monitors::instance()->watch("navmesh_tile_cache_hits", new Variable<int>(Awareness::s_tileBuildStatistics.cacheHits));
+    Monitors::instance()->watch("navmesh_paths_queued", new Variable<int>(Awareness::s_pathStatistics.queued));
+    Monitors::instance()->watch("navmesh_paths_completed", new Variable<int>(Awareness::s_pathStatistics.completed));
+    Monitors::instance()->watch("navmesh_path_cache_hits", new Variable<int>(Awareness::s_pathStatistics.cacheHits));
+    Monitors::instance()->watch("navmesh_path_latency_p50_ms", new Variable<int>(Awareness::s_pathStatistics.latencyP50Milliseconds));
+    Monitors::instance()->watch("navmesh_path_latency_p90_ms", new Variable<int>(Awareness::s_pathStatistics.latencyP90Milliseconds));
+    Monitors::instance()->watch("navmesh_path_latency_p99_ms", new Variable<int>(Awareness::s_pathStatistics.latencyP99Milliseconds));
+    Monitors::instance()->watch("navmesh_crowd_agents", new Variable<int>(Awareness::s_crowdStatistics.agents));
+    Monitors::instance()->watch("navmesh_crowd_pass_us", new Variable<int>(Awareness::s_crowdStatistics.passMicroseconds));
+    Monitors::instance()->watch("terrain_height_blits", new Variable<int>(SharedTerrain::s_heightStatistics.blits));
+    Monitors::instance()->watch("terrain_segments_populated", new Variable<int>(SharedTerrain::s_heightStatistics.segmentsPopulated));
+    Monitors::instance()->watch("terrain_segments_cached", new Variable<int>(SharedTerrain::s_heightStatistics.segmentsCached));
+    Monitors::instance()->watch("terrain_blit_bytes", new Variable<int>(SharedTerrain::s_heightStatistics.blitBytes));
+
+    readConfigItem(CYPHESIS, "aibatchsize", AtlasStreamClient::s_batchSize);
+    readConfigItem(CYPHESIS, "aibatchinterval", AtlasStreamClient::s_batchInterval);
+    Monitors::instance()->watch("ops_sent", new Variable<int>(AtlasStreamClient::s_sendStatistics.opsSent));
+    Monitors::instance()->watch("op_writes", new Variable<int>(AtlasStreamClient::s_sendStatistics.writes));
+
+    int navmesh_threads = 2;
+    readConfigItem(CYPHESIS, "navmeshthreads", navmesh_threads);
+
+    readConfigItem(CYPHESIS, "pathiterations", AwareMind::s_pathSearchIterations);
+
+    readConfigItem(CYPHESIS, "crowdavoidance", AwareMind::s_crowdAvoidance);
+
+    int mind_lod = 0;
+    readConfigItem(CYPHESIS, "mindlod", mind_lod);
+    AwareMind::s_lodDistance = std::max(0, mind_lod);
+    for (int i = 0; i < AwareMind::LOD_LEVELS; ++i) {
+        Monitors::instance()->watch(String::compose("minds_lod{level=\"%1\"}", i), new Variable<int>(AwareMind::s_lodMinds[i]));
+    }
+
+    std::string navmesh_cache = var_directory + "/tmp/cyphesis_navmesh";
+    readConfigItem(CYPHESIS, "navmeshcache", navmesh_cache);
+    if (navmesh_cache == "none") {
+        navmesh_cache.clear();
+    }
+    int navmesh_cache_size = 256;
+    readConfigItem(CYPHESIS, "navmeshcachesize", navmesh_cache_size);
+
+    std::string monitors_directory = var_directory + "/tmp";
+    readConfigItem(CYPHESIS, "aimonitors", monitors_directory);
+    std::string monitors_file;
+    if (monitors_directory != "none") {
+        monitors_file = String::compose("%1/cyphesis_aiclient_%2.monitors", monitors_directory, worker_index);
+    }
+
     SystemTime time;
     time.update();
 
-    AwareMindFactory mindFactory;
+    AwareMindFactory mindFactory((unsigned int)std::max(0, navmesh_threads), navmesh_cache,
+                                 (std::uintmax_t)std::max(0, navmesh_cache_size) * 1024 * 1024);
 //    MindFactory mindFactory;
 //    AwareMindFactory awareMindFactory;
 
@@ -164,8 +376,24 @@ int main(int argc, char ** argv)
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
+    time_t nextReport = time.seconds() + WORKER_REPORT_INTERVAL;
+    time_t nextMonitorsWrite = time.seconds() + MONITORS_WRITE_INTERVAL;
+
     while (!exit_flag) {
         try {
+            time.update();
+            if (time.seconds() >= nextReport) {
+                nextReport = time.seconds() + WORKER_REPORT_INTERVAL;
+                log(INFO, String::compose("AI worker %1 is running %2 minds, with a tick lag of %3 ms.",
+                                          worker_index, possessionClient->getMindCount(),
+                                          (long)(possessionClient->getDispatchLag() * 1000)));
+            }
+            Monitors::instance()->insert("minds", (Atlas::Message::IntType)possessionClient->getMindCount());
+            if (!monitors_file.empty() && time.seconds() >= nextMonitorsWrite) {
+                nextMonitorsWrite = time.seconds() + MONITORS_WRITE_INTERVAL;
+                writeMonitors(monitors_file);
+            }
+
             double secondsUntilNextOp = possessionClient->secondsUntilNextOp();
             boost::posix_time::microseconds waitTime((long long)(secondsUntilNextOp * 1000000));
             int netResult = possessionClient->pollOne(waitTime);
@@ -243,6 +243,7 @@ static PyObject * CreatorClient_getattro(PyCreatorClient *self,
         if (loc != nullptr) {
             loc->location = &self->m_mind.c->m_location;
             loc->owner = self->m_mind.c;
+            loc->owner->incRef();
         }
         return (PyObject *)loc;
     }
@@ -416,9 +416,14 @@ void AtlasStreamClient::errorArrived(const RootOperation & op)
     }
 }
 
+AtlasStreamClient::SendStatistics AtlasStreamClient::s_sendStatistics;
+int AtlasStreamClient::s_batchSize = 64;
+int AtlasStreamClient::s_batchInterval = 20;
+
 AtlasStreamClient::AtlasStreamClient() : m_io_work(m_io_service), reply_flag(false), error_flag(false),
                                          serialNo(512), m_socket(nullptr),
-                                         m_currentTask(0), m_spacing(2)
+                                         m_currentTask(0), m_spacing(2),
+                                         m_batching(false), m_batchedOps(0)
 {
 }
 
@@ -441,7 +446,39 @@ void AtlasStreamClient::send(const RootOperation & op)
     reply_flag = false;
     error_flag = false;
     m_socket->getEncoder().streamObjectsMessage(op);
-    m_socket->write();
+    s_sendStatistics.opsSent++;
+
+    if (m_batching) {
+        auto now = std::chrono::steady_clock::now();
+        if (m_batchedOps++ == 0) {
+            m_batchStart = now;
+        }
+        if (m_batchedOps < s_batchSize && now - m_batchStart < std::chrono::milliseconds(s_batchInterval)) {
+            return;
+        }
+    }
+    writeBatch();
+}
+
+void AtlasStreamClient::writeBatch()
+{
+    m_batchedOps = 0;
+    if (m_socket->write() > 0) {
+        s_sendStatistics.writes++;
+    }
+}
+
+void AtlasStreamClient::beginBatch()
+{
+    m_batching = true;
+}
+
+void AtlasStreamClient::flush()
+{
+    m_batching = false;
+    if (m_socket != nullptr && m_batchedOps > 0) {
+        writeBatch();
+    }
 }
 
 int AtlasStreamClient::connect(const std::string & host, unsigned short port)
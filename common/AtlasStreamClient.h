@@ -128,6 +128,15 @@ class AtlasStreamClient : public Atlas::Objects::ObjectsDecoder
 
     std::list<Atlas::Objects::Operation::RootOperation> mOps;
 
+    /// \brief True if sent operations are held back until flushed
+    bool m_batching;
+    /// \brief Number of operations encoded but not yet written
+    int m_batchedOps;
+    /// \brief When the first held back operation was encoded
+    std::chrono::steady_clock::time_point m_batchStart;
+
+    void writeBatch();
+
     // void objectArrived(const Atlas::Objects::Root &);
     int waitForLoginResponse();
     void dispatch();
@@ -146,6 +155,22 @@ class AtlasStreamClient : public Atlas::Objects::ObjectsDecoder
     virtual void loginSuccess(const Atlas::Objects::Root & arg);
 
   public:
+    /// \brief Statistics for the operations sent by all clients.
+    struct SendStatistics
+    {
+        int opsSent = 0;
+        /// \brief The number of writes to the socket.
+        int writes = 0;
+    };
+
+    static SendStatistics s_sendStatistics;
+
+    /// \brief Max number of operations held back before they're written while batching.
+    static int s_batchSize;
+
+    /// \brief Max time in milliseconds an operation is held back while batching.
+    static int s_batchInterval;
+
     AtlasStreamClient();
     virtual ~AtlasStreamClient();
 
@@ -166,6 +191,20 @@ class AtlasStreamClient : public Atlas::Objects::ObjectsDecoder
     }
 
     virtual void send(const Atlas::Objects::Operation::RootOperation & op);
+
+    /**
+     * @brief Holds back sent operations, so that they're written together.
+     *
+     * They're written when flush() is called, or when there are too many or
+     * they have been held back for too long.
+     */
+    void beginBatch();
+
+    /**
+     * @brief Writes any held back operations, and stops holding them back.
+     */
+    void flush();
+
     int connect(const std::string & host, unsigned short port = 6767);
     int connectLocal(const std::string & host);
     int cleanDisconnect();
@@ -29,6 +29,7 @@
 
 class ArithmeticScript;
 class LocatedEntity;
+class SystemScheduler;
 class SystemTime;
 class Task;
 class Location;
@@ -75,6 +76,9 @@ class BaseWorld {
 
     LocatedEntity* m_limboLocation;
 
+    /// \brief Runs batched system updates, if the world supports them.
+    SystemScheduler* m_systems = nullptr;
+
     explicit BaseWorld(LocatedEntity & gw);
 
     /// \brief Called when the world is resumed.
@@ -144,6 +148,15 @@ class BaseWorld {
     void setLimboLocation(LocatedEntity* entity);
 
 
+    /// \brief Gets the scheduler used for batched periodic updates.
+    ///
+    /// Entities which need to be updated periodically should add themselves
+    /// to a system here rather than sending themselves Tick operations.
+    /// \returns The scheduler, or null if the world has none.
+    SystemScheduler* getSystems() const {
+        return m_systems;
+    }
+
     /// \brief Read only accessor for the in-game time.
     double getTime() const;
 
@@ -26,6 +26,9 @@
 
 #include <Atlas/Objects/Entity.h>
 
+#include <unordered_map>
+#include <vector>
+
 using Atlas::Message::Element;
 using Atlas::Message::ListType;
 
@@ -123,6 +126,7 @@ Inheritance & Inheritance::instance()
         installStandardObjects();
         installCustomOperations();
         installCustomEntities();
+        m_instance->renumber();
     }
     return *m_instance;
 }
@@ -224,13 +228,17 @@ bool Inheritance::isTypeOf(const std::string & instance,
     if (I == Iend) {
         return false;
     }
-    return I->second->isTypeOf(base_type);
+    return isTypeOf(I->second, base_type);
 }
 
 bool Inheritance::isTypeOf(const TypeNode * instance,
                            const std::string & base_type) const
 {
-    return instance->isTypeOf(base_type);
+    TypeNodeDict::const_iterator I = atlasObjects.find(base_type);
+    if (I == atlasObjects.end()) {
+        return instance->isTypeOf(base_type);
+    }
+    return instance->isTypeOf(I->second);
 }
 
 bool Inheritance::isTypeOf(const TypeNode * instance,
@@ -239,6 +247,47 @@ bool Inheritance::isTypeOf(const TypeNode * instance,
     return instance->isTypeOf(base_type);
 }
 
+typedef std::unordered_map<const TypeNode *, std::vector<TypeNode *>> TypeChildrenDict;
+
+static void numberSubtree(TypeNode * node,
+                          const TypeChildrenDict & children,
+                          int & index)
+{
+    int first = index++;
+    auto I = children.find(node);
+    if (I != children.end()) {
+        for (TypeNode * child : I->second) {
+            numberSubtree(child, children, index);
+        }
+    }
+    node->setTreeInterval(first, index - 1);
+}
+
+/// \brief Assign pre-order intervals to all nodes in the tree
+///
+/// Each node is given its pre-order index, and the highest index found in
+/// its subtree, so TypeNode::isTypeOf() can be answered by checking whether
+/// one index lies within the interval of the other. Nodes added after
+/// this call remain unnumbered, and fall back to walking the parent chain,
+/// until this is called again.
+void Inheritance::renumber()
+{
+    TypeChildrenDict children;
+    std::vector<TypeNode *> roots;
+    for (auto & entry : atlasObjects) {
+        TypeNode * node = entry.second;
+        if (node->parent() == nullptr) {
+            roots.push_back(node);
+        } else {
+            children[node->parent()].push_back(node);
+        }
+    }
+    int index = 0;
+    for (TypeNode * root : roots) {
+        numberSubtree(root, children, index);
+    }
+}
+
 using Atlas::Objects::Operation::RootOperation;
 using Atlas::Objects::Operation::Perception;
 using Atlas::Objects::Operation::Communicate;
@@ -19,6 +19,8 @@
 #ifndef COMMON_INHERITANCE_H
 #define COMMON_INHERITANCE_H
 
+#include "PropertyDict.h"
+
 #include <Atlas/Objects/ObjectsFwd.h>
 #include <Atlas/Objects/Root.h>
 #include <Atlas/Objects/SmartPtr.h>
@@ -30,7 +32,6 @@ void installStandardObjects();
 void installCustomOperations();
 void installCustomEntities();
 
-typedef std::map<std::string, PropertyBase *> PropertyDict;
 typedef std::map<std::string, TypeNode *> TypeNodeDict;
 
 /// \brief Class to manage the inheritance tree for in-game entity types
@@ -63,6 +64,7 @@ class Inheritance {
                   const std::string & base_type) const;
     bool isTypeOf(const TypeNode * instance,
                   const TypeNode * base_type) const;
+    void renumber();
     void flush();
 };
 
@@ -19,6 +19,7 @@
 #include "Monitors.h"
 
 #include "Variable.h"
+#include "ObjectPool.h"
 
 #include <iostream>
 
@@ -65,6 +66,14 @@ void Monitors::watch(const::std::string & name, VariableBase * monitor)
     m_variableMonitors[name] = monitor;
 }
 
+/// \brief Watch the usage counters of a family of object pools
+void Monitors::watchPool(const std::string & name, const PoolStats & stats)
+{
+    watch("pool_blocks_in_use{pool=\"" + name + "\"}", new Variable<int>(stats.inUse));
+    watch("pool_blocks_reserved{pool=\"" + name + "\"}", new Variable<int>(stats.reserved));
+    watch("pool_allocations{pool=\"" + name + "\"}", new Variable<int>(stats.allocations));
+}
+
 static std::ostream & operator<<(std::ostream & s, const Element & e)
 {
     switch (e.getType()) {
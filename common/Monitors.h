@@ -21,6 +21,7 @@
 
 #include <Atlas/Message/Element.h>
 
+struct PoolStats;
 class VariableBase;
 
 /// \brief Storage for monitor values to be exported
@@ -44,6 +45,7 @@ class Monitors {
 
     void insert(const std::string &, const Atlas::Message::Element &);
     void watch(const std::string &, VariableBase *);
+    void watchPool(const std::string &, const PoolStats &);
     void send(std::ostream &);
     void sendNumerics(std::ostream &);
     int readVariable(const std::string& key, std::ostream& out_stream) const;
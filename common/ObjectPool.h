@@ -0,0 +1,196 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef COMMON_OBJECT_POOL_H
+#define COMMON_OBJECT_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/// \brief Usage counters for a family of pools, exposed through Monitors
+struct PoolStats {
+    /// \brief Number of blocks currently handed out
+    int inUse = 0;
+    /// \brief Number of blocks allocated from the system, in use or free
+    int reserved = 0;
+    /// \brief Number of allocations served since startup
+    int allocations = 0;
+};
+
+/// \brief Free list allocator for blocks of a single size
+///
+/// Blocks are carved out of chunks which are never returned to the system,
+/// so memory freed by one object is reused by the next object of similar
+/// size without going through the general purpose allocator.
+class ObjectPool {
+  protected:
+    struct FreeBlock {
+        FreeBlock * next;
+    };
+
+    const std::size_t m_blockSize;
+    const std::size_t m_blocksPerChunk;
+    FreeBlock * m_free = nullptr;
+    std::vector<char *> m_chunks;
+
+    void grow()
+    {
+        char * chunk = static_cast<char *>(::operator new(m_blockSize * m_blocksPerChunk));
+        m_chunks.push_back(chunk);
+        for (std::size_t i = m_blocksPerChunk; i > 0; --i) {
+            FreeBlock * block = reinterpret_cast<FreeBlock *>(chunk + (i - 1) * m_blockSize);
+            block->next = m_free;
+            m_free = block;
+        }
+    }
+
+  public:
+    explicit ObjectPool(std::size_t blockSize,
+                        std::size_t chunkBytes = 64 * 1024) :
+        m_blockSize(blockSize),
+        m_blocksPerChunk(chunkBytes / blockSize > 0 ? chunkBytes / blockSize : 1)
+    {
+    }
+
+    ~ObjectPool()
+    {
+        for (char * chunk : m_chunks) {
+            ::operator delete(chunk);
+        }
+    }
+
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool & operator=(const ObjectPool &) = delete;
+
+    std::size_t blockSize() const { return m_blockSize; }
+
+    /// \brief Number of blocks this pool has allocated from the system
+    std::size_t capacity() const { return m_chunks.size() * m_blocksPerChunk; }
+
+    void * allocate()
+    {
+        if (m_free == nullptr) {
+            grow();
+        }
+        FreeBlock * block = m_free;
+        m_free = block->next;
+        return block;
+    }
+
+    void deallocate(void * p)
+    {
+        FreeBlock * block = static_cast<FreeBlock *>(p);
+        block->next = m_free;
+        m_free = block;
+    }
+};
+
+/// \brief Set of pools covering a range of object sizes
+///
+/// Requests are rounded up to a multiple of the granularity, and served from
+/// the pool for that size. Requests larger than the largest pool go to the
+/// general purpose allocator.
+class SizedPools {
+  public:
+    static const std::size_t granularity = 16;
+    static const std::size_t max_size = 2048;
+
+  protected:
+    ObjectPool * m_pools[max_size / granularity] = {};
+    PoolStats m_stats;
+
+  public:
+    SizedPools() = default;
+    SizedPools(const SizedPools &) = delete;
+    SizedPools & operator=(const SizedPools &) = delete;
+
+    ~SizedPools()
+    {
+        for (ObjectPool * pool : m_pools) {
+            delete pool;
+        }
+    }
+
+    PoolStats & stats() { return m_stats; }
+
+    void * allocate(std::size_t size)
+    {
+        ++m_stats.allocations;
+        if (size == 0 || size > max_size) {
+            return ::operator new(size);
+        }
+        std::size_t index = (size - 1) / granularity;
+        ObjectPool *& pool = m_pools[index];
+        if (pool == nullptr) {
+            pool = new ObjectPool((index + 1) * granularity);
+        }
+        std::size_t capacity = pool->capacity();
+        void * p = pool->allocate();
+        m_stats.reserved += pool->capacity() - capacity;
+        ++m_stats.inUse;
+        return p;
+    }
+
+    void deallocate(void * p, std::size_t size)
+    {
+        if (p == nullptr) {
+            return;
+        }
+        if (size == 0 || size > max_size) {
+            ::operator delete(p);
+            return;
+        }
+        m_pools[(size - 1) / granularity]->deallocate(p);
+        --m_stats.inUse;
+    }
+};
+
+/// \brief Base class which makes instances of a class family pool allocated
+///
+/// Inheriting from this gives a class, and every class derived from it,
+/// a class specific operator new and delete served from a set of pools
+/// shared by the family. The family type is only used to keep the pools
+/// and statistics of different families apart. Classes in the family must
+/// have a virtual destructor, so the correct size is passed to delete.
+/// The pools are not thread safe.
+template <class FamilyT>
+class PoolAllocated {
+  public:
+    /// \brief The pools shared by all classes in this family
+    ///
+    /// Deliberately never destroyed, so objects deleted during static
+    /// destruction can still be returned.
+    static SizedPools & pools()
+    {
+        static SizedPools * s_pools = new SizedPools;
+        return *s_pools;
+    }
+
+    static void * operator new(std::size_t size)
+    {
+        return pools().allocate(size);
+    }
+
+    static void operator delete(void * p, std::size_t size)
+    {
+        pools().deallocate(p, size);
+    }
+};
+
+#endif // COMMON_OBJECT_POOL_H
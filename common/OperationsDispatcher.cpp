@@ -49,7 +49,7 @@ OpQueEntry::~OpQueEntry()
 
 
 OperationsDispatcher::OperationsDispatcher(const std::function<void(const Operation &, LocatedEntity &)> & operationProcessor, const std::function<double()> & timeProviderFn)
-    : m_operationProcessor(operationProcessor), m_timeProviderFn(timeProviderFn), m_operation_queues_dirty(false)
+    : m_operationProcessor(operationProcessor), m_timeProviderFn(timeProviderFn), m_operation_queues_dirty(false), m_dispatchLag(0)
 {
 }
 
@@ -122,6 +122,8 @@ bool OperationsDispatcher::idle()
 
     double realtime = getTime();
     bool opsAvailableRightNow = !m_operationQueue.empty() && m_operationQueue.top()->getSeconds() <= realtime;
+    //The queue is ordered, so the first op dispatched is the one which has waited the longest.
+    m_dispatchLag = opsAvailableRightNow ? realtime - m_operationQueue.top()->getSeconds() : 0;
 
     while (opsAvailableRightNow && op_count < 10) {
         ++op_count;
@@ -137,6 +139,7 @@ bool OperationsDispatcher::idle()
     // that we keep processing ops at a the maximum rate without leaving
     // clients unattended.
     Monitors::instance()->insert("operations_queue", (Atlas::Message::IntType) m_operationQueue.size());
+    Monitors::instance()->insert("operations_lag_ms", (Atlas::Message::IntType) (m_dispatchLag * 1000));
     return opsAvailableRightNow;
 }
 
@@ -165,3 +168,7 @@ double OperationsDispatcher::secondsUntilNextOp() const
     return m_operationQueue.top()->getSeconds() - getTime();
 }
 
+double OperationsDispatcher::getDispatchLag() const
+{
+    return m_dispatchLag;
+}
@@ -120,6 +120,12 @@ class OperationsDispatcher
          */
         void addOperationToQueue(const Operation &,
                         LocatedEntity &);
+
+        /**
+         * @brief Gets how late the oldest operation dispatched in the last call to idle() was.
+         * @return Seconds, or zero if no operation was dispatched.
+         */
+        double getDispatchLag() const;
     protected:
 
         std::function<void(const Operation&, LocatedEntity&)> m_operationProcessor;
@@ -129,6 +135,8 @@ class OperationsDispatcher
         OpPriorityQueue m_operationQueue;
         /// Keeps track of if the operation queues are dirty.
         bool m_operation_queues_dirty;
+        /// How late the oldest operation dispatched by the last call to idle() was, in seconds.
+        double m_dispatchLag;
 
         /**
          * @brief Dispatches the operation contained in the OpQueueEntry.
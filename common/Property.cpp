@@ -83,6 +83,11 @@ HandlerResult PropertyBase::operation(LocatedEntity *,
     return OPERATION_IGNORED;
 }
 
+PropertyTypeId PropertyBase::typeId() const
+{
+    return propertyTypeId<PropertyBase>();
+}
+
 template<>
 void Property<int>::set(const Atlas::Message::Element & e)
 {
@@ -170,6 +175,11 @@ SoftProperty * SoftProperty::copy() const
     return new SoftProperty(*this);
 }
 
+PropertyTypeId SoftProperty::typeId() const
+{
+    return propertyTypeId<SoftProperty>();
+}
+
 template class Property<int>;
 template class Property<long>;
 template class Property<float>;
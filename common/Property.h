@@ -20,16 +20,35 @@
 #define COMMON_PROPERTY_H
 
 #include "OperationRouter.h"
+#include "ObjectPool.h"
 
 #include <Atlas/Message/Element.h>
 
+#include <cassert>
+
 class LocatedEntity;
 class TypeNode;
 
+/// \brief Identifier for a property class, used in place of RTTI
+///
+/// \ingroup PropertyClasses
+typedef const void * PropertyTypeId;
+
+/// \brief Get the unique identifier of a property class
+///
+/// \ingroup PropertyClasses
+template <class PropertyT>
+PropertyTypeId propertyTypeId()
+{
+    static const char s_tag = 0;
+    return &s_tag;
+}
+
 /// \brief Interface for Entity properties
 ///
+/// Instances of all property classes are pool allocated.
 /// \ingroup PropertyClasses
-class PropertyBase {
+class PropertyBase : public PoolAllocated<PropertyBase> {
   protected:
     /// \brief Flags indicating how this Property should be handled
     unsigned int m_flags;
@@ -81,8 +100,40 @@ class PropertyBase {
     ///
     /// The copy should have exactly the same type, and the same value
     virtual PropertyBase * copy() const = 0;
+    /// \brief Get the type tag of this property
+    ///
+    /// Classes which are frequently looked up by type override this to
+    /// return their own tag. Classes which do not inherit the tag of
+    /// their base class.
+    virtual PropertyTypeId typeId() const;
 };
 
+/// \brief Downcast a property to a given class
+///
+/// If the type tag of the property matches the class this is a static
+/// cast, which is checked against dynamic_cast in debug builds. Otherwise
+/// the property may still be of a class derived from the one requested,
+/// so dynamic_cast is used.
+/// \ingroup PropertyClasses
+template <class PropertyT>
+PropertyT * property_cast(PropertyBase * p)
+{
+    if (p->typeId() == propertyTypeId<PropertyT>()) {
+        assert(dynamic_cast<PropertyT *>(p) == p);
+        return static_cast<PropertyT *>(p);
+    }
+    return dynamic_cast<PropertyT *>(p);
+}
+
+/// \brief Downcast a const property to a given class
+///
+/// \ingroup PropertyClasses
+template <class PropertyT>
+const PropertyT * property_cast(const PropertyBase * p)
+{
+    return property_cast<PropertyT>(const_cast<PropertyBase *>(p));
+}
+
 /// \brief Flag indicating data has been written to permanent store
 /// \ingroup PropertyFlags
 static const unsigned int per_clean = 1 << 0;
@@ -147,6 +198,7 @@ class Property : public PropertyBase {
     void add(const std::string & key, Atlas::Message::MapType & map) const override;
     void add(const std::string & key, const Atlas::Objects::Entity::RootEntity & ent) const override;
     Property<T> * copy() const override;
+    PropertyTypeId typeId() const override;
 };
 
 /// \brief Entity property that can store any Atlas value
@@ -161,6 +213,7 @@ class SoftProperty : public PropertyBase {
     int get(Atlas::Message::Element & val) const override ;
     void set(const Atlas::Message::Element & val) override ;
     SoftProperty * copy() const override ;
+    PropertyTypeId typeId() const override;
 };
 
 #endif // COMMON_PROPERTY_H
@@ -0,0 +1,179 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef COMMON_PROPERTY_DICT_H
+#define COMMON_PROPERTY_DICT_H
+
+#include "PropertyKey.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+class PropertyBase;
+
+/// \brief Compact dictionary of properties, keyed by interned name
+///
+/// The entries hold only the PropertyKey of each property, and are kept in
+/// a vector in alphabetical order of name, so iteration yields entries in
+/// the same order as the std::map this replaces. A separate index of ids
+/// sorted numerically, each with the position of its entry, makes a lookup
+/// a binary search over a small contiguous array of integers. Inserting or
+/// erasing invalidates iterators.
+/// \ingroup PropertyClasses
+class PropertyDict {
+  public:
+    typedef std::pair<PropertyKey, PropertyBase *> value_type;
+    typedef std::vector<value_type>::iterator iterator;
+    typedef std::vector<value_type>::const_iterator const_iterator;
+
+  protected:
+    /// \brief Id of an entry and its position in m_entries
+    struct Slot {
+        unsigned int id;
+        unsigned int pos;
+
+        bool operator<(unsigned int other) const {
+            return id < other;
+        }
+    };
+
+    /// \brief Index of the entries, sorted by id
+    std::vector<Slot> m_slots;
+    /// \brief Key and property of each entry, sorted by name
+    std::vector<value_type> m_entries;
+
+    /// \brief Position of the entry for an id, or the size if not present
+    std::size_t position(unsigned int id) const {
+        auto I = std::lower_bound(m_slots.begin(), m_slots.end(), id);
+        if (I == m_slots.end() || I->id != id) {
+            return m_entries.size();
+        }
+        return I->pos;
+    }
+
+    /// \brief Add an entry for a key which is not yet present
+    std::size_t add(const PropertyKey & key, PropertyBase * prop) {
+        const std::string & name = key.name();
+        auto E = std::lower_bound(m_entries.begin(), m_entries.end(), name,
+            [](const value_type & entry, const std::string & other) {
+                return entry.first.name() < other;
+            });
+        unsigned int pos = E - m_entries.begin();
+        m_entries.insert(E, value_type(key, prop));
+        for (Slot & slot : m_slots) {
+            if (slot.pos >= pos) {
+                ++slot.pos;
+            }
+        }
+        m_slots.insert(std::lower_bound(m_slots.begin(), m_slots.end(),
+                                        key.id()),
+                       Slot{key.id(), pos});
+        return pos;
+    }
+
+  public:
+    iterator begin() { return m_entries.begin(); }
+    iterator end() { return m_entries.end(); }
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+
+    std::size_t size() const { return m_entries.size(); }
+    bool empty() const { return m_entries.empty(); }
+
+    void clear() {
+        m_slots.clear();
+        m_entries.clear();
+    }
+
+    iterator find(const PropertyKey & key) {
+        return m_entries.begin() + position(key.id());
+    }
+
+    const_iterator find(const PropertyKey & key) const {
+        return m_entries.begin() + position(key.id());
+    }
+
+    iterator find(const std::string & name) {
+        return find(PropertyKey::find(name));
+    }
+
+    const_iterator find(const std::string & name) const {
+        return find(PropertyKey::find(name));
+    }
+
+    std::size_t count(const std::string & name) const {
+        return find(name) == end() ? 0 : 1;
+    }
+
+    /// \brief Get the property stored for a key, inserting null if absent
+    PropertyBase *& operator[](const PropertyKey & key) {
+        std::size_t pos = position(key.id());
+        if (pos == m_entries.size()) {
+            pos = add(key, nullptr);
+        }
+        return m_entries[pos].second;
+    }
+
+    PropertyBase *& operator[](const std::string & name) {
+        return (*this)[PropertyKey::intern(name)];
+    }
+
+    std::pair<iterator, bool> emplace(const std::string & name,
+                                      PropertyBase * prop) {
+        PropertyKey key = PropertyKey::intern(name);
+        std::size_t pos = position(key.id());
+        if (pos != m_entries.size()) {
+            return std::make_pair(m_entries.begin() + pos, false);
+        }
+        return std::make_pair(m_entries.begin() + add(key, prop), true);
+    }
+
+    std::pair<iterator, bool> insert(const value_type & entry) {
+        return emplace(entry.first, entry.second);
+    }
+
+    std::pair<iterator, bool> insert(const std::pair<std::string,
+                                                     PropertyBase *> & entry) {
+        return emplace(entry.first, entry.second);
+    }
+
+    iterator erase(const_iterator I) {
+        unsigned int pos = I - m_entries.cbegin();
+        m_slots.erase(std::lower_bound(m_slots.begin(), m_slots.end(),
+                                       I->first.id()));
+        for (Slot & slot : m_slots) {
+            if (slot.pos > pos) {
+                --slot.pos;
+            }
+        }
+        return m_entries.erase(m_entries.begin() + pos);
+    }
+
+    std::size_t erase(const std::string & name) {
+        auto I = find(name);
+        if (I == end()) {
+            return 0;
+        }
+        erase(I);
+        return 1;
+    }
+};
+
+#endif // COMMON_PROPERTY_DICT_H
@@ -0,0 +1,184 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef COMMON_PROPERTY_KEY_H
+#define COMMON_PROPERTY_KEY_H
+
+#include <deque>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+/// \brief Interned handle for the name of a property
+///
+/// Each property name is given a small dense integer id the first time it
+/// is interned, so properties can be found by comparing integers rather
+/// than strings. The names of the most commonly accessed properties are
+/// interned before any other, so their ids are compile time constants.
+/// \ingroup PropertyClasses
+class PropertyKey {
+  public:
+    /// \brief Ids of the well known properties
+    enum : unsigned int {
+        key_id = 0,
+        key_bbox,
+        key_domain,
+        key_food,
+        key_friction,
+        key_geometry,
+        key_mass,
+        key_mind,
+        key_mode,
+        key_outfit,
+        key_planted_on,
+        key_right_hand_wield,
+        key_solid,
+        key_speed,
+        key_stamina,
+        key_status,
+        key_tasks,
+        key_visibility,
+        /// \brief Number of well known properties
+        key_well_known_count,
+        /// \brief Id of a key for a name which has never been interned
+        key_invalid = ~0u
+    };
+
+  private:
+    /// \brief Process wide table of interned names
+    ///
+    /// A deque is used so references to names stay valid as more are added.
+    struct Table {
+        std::deque<std::string> names;
+        std::unordered_map<std::string, unsigned int> ids;
+
+        Table();
+
+        unsigned int add(const std::string & name) {
+            auto I = ids.find(name);
+            if (I != ids.end()) {
+                return I->second;
+            }
+            unsigned int id = names.size();
+            names.push_back(name);
+            ids.emplace(name, id);
+            return id;
+        }
+    };
+
+    static Table & table() {
+        static Table s_table;
+        return s_table;
+    }
+
+    unsigned int m_id;
+
+  public:
+    explicit PropertyKey(unsigned int id = key_invalid) : m_id(id) { }
+
+    /// \brief Get the key for a name, interning it if it is new
+    static PropertyKey intern(const std::string & name) {
+        return PropertyKey(table().add(name));
+    }
+
+    /// \brief Get the key for a name, without interning it
+    ///
+    /// @return an invalid key if the name has never been interned
+    static PropertyKey find(const std::string & name) {
+        const Table & t = table();
+        auto I = t.ids.find(name);
+        if (I == t.ids.end()) {
+            return PropertyKey();
+        }
+        return PropertyKey(I->second);
+    }
+
+    /// \brief Number of names interned so far
+    static std::size_t count() {
+        return table().names.size();
+    }
+
+    unsigned int id() const {
+        return m_id;
+    }
+
+    bool isValid() const {
+        return m_id != key_invalid;
+    }
+
+    /// \brief The interned name of this key
+    const std::string & name() const {
+        return table().names[m_id];
+    }
+
+    /// \brief Keys stand in for their names where a string is expected
+    operator const std::string &() const {
+        return name();
+    }
+
+    bool operator==(const PropertyKey & other) const {
+        return m_id == other.m_id;
+    }
+
+    bool operator!=(const PropertyKey & other) const {
+        return m_id != other.m_id;
+    }
+
+    bool operator<(const PropertyKey & other) const {
+        return m_id < other.m_id;
+    }
+};
+
+inline bool operator==(const PropertyKey & key, const std::string & name)
+{
+    return key.name() == name;
+}
+
+inline bool operator==(const std::string & name, const PropertyKey & key)
+{
+    return key.name() == name;
+}
+
+inline bool operator!=(const PropertyKey & key, const std::string & name)
+{
+    return key.name() != name;
+}
+
+inline bool operator!=(const std::string & name, const PropertyKey & key)
+{
+    return key.name() != name;
+}
+
+inline std::ostream & operator<<(std::ostream & os, const PropertyKey & key)
+{
+    return os << key.name();
+}
+
+inline PropertyKey::Table::Table()
+{
+    // Must follow the order of the well known ids.
+    for (const char * name : {"id", "bbox", "domain", "food", "friction",
+                              "geometry", "mass", "mind", "mode", "outfit",
+                              "planted_on", "right_hand_wield", "solid",
+                              "speed", "stamina", "status", "tasks",
+                              "visibility"}) {
+        add(name);
+    }
+}
+
+#endif // COMMON_PROPERTY_KEY_H
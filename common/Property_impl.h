@@ -60,4 +60,10 @@ Property<T> * Property<T>::copy() const
     return new Property<T>(*this);
 }
 
+template <typename T>
+PropertyTypeId Property<T>::typeId() const
+{
+    return propertyTypeId<Property<T>>();
+}
+
 #endif // COMMON_PROPERTY_IMPL_H
@@ -0,0 +1,119 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include "ScriptProfiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+const std::size_t ScriptProfiler::sample_count;
+bool ScriptProfiler::s_enabled = false;
+ScriptProfiler * ScriptProfiler::m_instance = nullptr;
+
+ScriptProfiler * ScriptProfiler::instance()
+{
+    if (m_instance == nullptr) {
+        m_instance = new ScriptProfiler;
+    }
+    return m_instance;
+}
+
+void ScriptProfiler::cleanup()
+{
+    s_enabled = false;
+    delete m_instance;
+    m_instance = nullptr;
+}
+
+void ScriptProfiler::setEnabled(bool enabled)
+{
+    s_enabled = enabled;
+}
+
+void ScriptProfiler::setObjectCounter(const std::function<long()> & counter)
+{
+    m_objectCounter = counter;
+}
+
+long ScriptProfiler::countObjects() const
+{
+    if (m_objectCounter) {
+        return m_objectCounter();
+    }
+    return 0;
+}
+
+void ScriptProfiler::record(const std::string & type,
+                            const std::string & handler,
+                            double seconds,
+                            long objects)
+{
+    Entry & entry = m_entries[std::make_pair(type, handler)];
+    ++entry.calls;
+    entry.seconds += seconds;
+    // The count drops if the collector ran during the call.
+    if (objects > 0) {
+        entry.objects += objects;
+    }
+    if (entry.samples.size() < sample_count) {
+        entry.samples.push_back(seconds);
+    } else {
+        entry.samples[entry.nextSample] = seconds;
+        entry.nextSample = (entry.nextSample + 1) % sample_count;
+    }
+}
+
+void ScriptProfiler::reset()
+{
+    m_entries.clear();
+}
+
+void ScriptProfiler::report(std::ostream & io) const
+{
+    std::vector<const EntryDict::value_type *> sorted;
+    sorted.reserve(m_entries.size());
+    for (auto & entry : m_entries) {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const EntryDict::value_type * lhs, const EntryDict::value_type * rhs) {
+                  return lhs->second.seconds > rhs->second.seconds;
+              });
+
+    io << "# profiling " << (s_enabled ? "enabled" : "disabled") << std::endl;
+    io << "# type handler calls total_ms avg_us p99_us objects" << std::endl;
+    std::vector<double> samples;
+    for (auto entry : sorted) {
+        const Entry & e = entry->second;
+        samples = e.samples;
+        double p99 = 0;
+        if (!samples.empty()) {
+            auto nth = samples.begin() + (samples.size() * 99) / 100;
+            std::nth_element(samples.begin(), nth, samples.end());
+            p99 = *nth;
+        }
+        io << entry->first.first << " " << entry->first.second << " "
+           << e.calls << " "
+           << std::fixed << std::setprecision(3)
+           << e.seconds * 1000. << " "
+           << (e.seconds * 1000000.) / e.calls << " "
+           << p99 * 1000000. << " "
+           << e.objects << std::endl;
+    }
+}
@@ -0,0 +1,123 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef COMMON_SCRIPT_PROFILER_H
+#define COMMON_SCRIPT_PROFILER_H
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+/// \brief Accumulates the time spent in script calls.
+///
+/// Calls are keyed by the script class and the name of the handler called.
+/// Profiling is off by default, and is switched on and off at runtime.
+/// While off, the only cost to a script call is checking the flag.
+class ScriptProfiler {
+  public:
+    /// \brief Number of recent calls kept per handler to estimate the p99
+    static const std::size_t sample_count = 1024;
+
+    struct Entry {
+        long calls = 0;
+        double seconds = 0;
+        long objects = 0;
+        /// \brief Durations of the most recent calls, in seconds
+        std::vector<double> samples;
+        std::size_t nextSample = 0;
+    };
+
+    typedef std::map<std::pair<std::string, std::string>, Entry> EntryDict;
+
+    /// \brief Measures a single script call, if profiling is enabled.
+    ///
+    /// The names are not copied, so must outlive the scope.
+    class Scope {
+      protected:
+        /// \brief The profiler, or null if disabled when the call started
+        ScriptProfiler * const m_profiler;
+        const std::string & m_type;
+        const std::string & m_handler;
+        std::chrono::steady_clock::time_point m_start;
+        long m_objects;
+      public:
+        Scope(const std::string & type, const std::string & handler);
+        ~Scope();
+    };
+
+  protected:
+    static bool s_enabled;
+    static ScriptProfiler * m_instance;
+
+    EntryDict m_entries;
+    /// \brief Counts live script objects, if the script engine allows it
+    std::function<long()> m_objectCounter;
+
+    ScriptProfiler() = default;
+  public:
+    static ScriptProfiler * instance();
+    static void cleanup();
+
+    static bool enabled() {
+        return s_enabled;
+    }
+
+    void setEnabled(bool enabled);
+    void setObjectCounter(const std::function<long()> & counter);
+
+    long countObjects() const;
+
+    void record(const std::string & type,
+                const std::string & handler,
+                double seconds,
+                long objects);
+
+    const EntryDict & entries() const {
+        return m_entries;
+    }
+
+    void reset();
+
+    /// \brief Write a report of all handlers, the most expensive first
+    void report(std::ostream &) const;
+};
+
+inline ScriptProfiler::Scope::Scope(const std::string & type,
+                                    const std::string & handler) :
+    m_profiler(s_enabled ? instance() : nullptr),
+    m_type(type), m_handler(handler), m_objects(0)
+{
+    if (m_profiler != nullptr) {
+        m_objects = m_profiler->countObjects();
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+inline ScriptProfiler::Scope::~Scope()
+{
+    if (m_profiler != nullptr) {
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - m_start;
+        m_profiler->record(m_type, m_handler, duration.count(),
+                           m_profiler->countObjects() - m_objects);
+    }
+}
+
+#endif // COMMON_SCRIPT_PROFILER_H
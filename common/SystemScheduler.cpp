@@ -0,0 +1,200 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include "SystemScheduler.h"
+
+#include "rulesets/LocatedEntity.h"
+#include "const.h"
+#include "compose.hpp"
+#include "log.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+SystemScheduler::SystemScheduler(const std::function<void(const Operation &, LocatedEntity &)> & resultProcessor,
+                                 const std::function<double()> & timeProviderFn)
+    : m_resultProcessor(resultProcessor), m_timeProviderFn(timeProviderFn)
+{
+}
+
+SystemScheduler::~SystemScheduler()
+{
+    clear();
+}
+
+int SystemScheduler::addSystem(const std::string & name,
+                               double interval,
+                               const UpdateFunction & update,
+                               int slices)
+{
+    for (std::size_t i = 0; i < m_systems.size(); ++i) {
+        if (m_systems[i]->name == name) {
+            return (int)i;
+        }
+    }
+    System * system = new System;
+    system->name = name;
+    system->sliceCount = std::max(1, slices);
+    system->nextSlice = 0;
+    system->interval = interval * consts::time_multiplier / system->sliceCount;
+    system->nextRun = m_timeProviderFn() + system->interval;
+    system->update = update;
+    m_systems.emplace_back(system);
+    return (int)m_systems.size() - 1;
+}
+
+bool SystemScheduler::addEntity(int system, LocatedEntity & entity, int slice)
+{
+    System & sys = *m_systems[system];
+    if (!sys.positions.emplace(&entity, sys.entities.size()).second) {
+        return false;
+    }
+    sys.entities.push_back(&entity);
+    sys.slices.push_back(std::abs(slice) % sys.sliceCount);
+    entity.incRef();
+    return true;
+}
+
+bool SystemScheduler::removeEntity(int system, LocatedEntity & entity)
+{
+    System & sys = *m_systems[system];
+    auto I = sys.positions.find(&entity);
+    if (I == sys.positions.end()) {
+        return false;
+    }
+    removeAt(sys, I->second);
+    return true;
+}
+
+bool SystemScheduler::hasEntity(int system, const LocatedEntity & entity) const
+{
+    const System & sys = *m_systems[system];
+    return sys.positions.find(&entity) != sys.positions.end();
+}
+
+std::size_t SystemScheduler::entityCount(int system) const
+{
+    return m_systems[system]->positions.size();
+}
+
+/// \brief Remove the entity at the index by moving the last entity into
+/// its place.
+///
+/// If this happens while the system is running, the moved entity may not
+/// be updated until the next run.
+void SystemScheduler::removeAt(System & system, std::size_t index)
+{
+    LocatedEntity * entity = system.entities[index];
+    system.positions.erase(entity);
+    LocatedEntity * last = system.entities.back();
+    system.entities[index] = last;
+    system.entities.pop_back();
+    system.slices[index] = system.slices.back();
+    system.slices.pop_back();
+    if (last != entity) {
+        system.positions[last] = index;
+    }
+    entity->decRef();
+}
+
+std::size_t SystemScheduler::runSystem(System & system)
+{
+    std::size_t updated = 0;
+    OpVector res;
+    std::size_t i = 0;
+    while (i < system.entities.size()) {
+        LocatedEntity * entity = system.entities[i];
+        if (entity->isDestroyed()) {
+            // Moves an entity not yet updated into this slot.
+            removeAt(system, i);
+            continue;
+        }
+        if (system.slices[i] != system.nextSlice) {
+            ++i;
+            continue;
+        }
+        // Keep the entity alive even if the update removes it.
+        entity->incRef();
+        try {
+            system.update(*entity, res);
+        }
+        catch (const std::exception & ex) {
+            log(ERROR, String::compose("Exception caught in SystemScheduler "
+                                       "while running system \"%1\" on "
+                                       "entity \"%2\": %3",
+                                       system.name, entity->getId(),
+                                       ex.what()));
+        }
+        ++updated;
+        for (auto & op : res) {
+            m_resultProcessor(op, *entity);
+        }
+        res.clear();
+        // If the entity removed itself, its slot now holds another entity.
+        if (i < system.entities.size() && system.entities[i] == entity) {
+            ++i;
+        }
+        entity->decRef();
+    }
+    system.nextSlice = (system.nextSlice + 1) % system.sliceCount;
+    return updated;
+}
+
+std::size_t SystemScheduler::run()
+{
+    std::size_t updated = 0;
+    double now = m_timeProviderFn();
+    // Systems may be added by an update, so iterate by index.
+    for (std::size_t i = 0; i < m_systems.size(); ++i) {
+        System & system = *m_systems[i];
+        if (system.nextRun > now) {
+            continue;
+        }
+        system.nextRun = now + system.interval;
+        updated += runSystem(system);
+    }
+    return updated;
+}
+
+double SystemScheduler::secondsUntilNextRun() const
+{
+    double next = -1;
+    double now = m_timeProviderFn();
+    for (auto & system : m_systems) {
+        if (system->entities.empty()) {
+            continue;
+        }
+        double seconds = std::max(0., system->nextRun - now);
+        if (next < 0 || seconds < next) {
+            next = seconds;
+        }
+    }
+    return next;
+}
+
+void SystemScheduler::clear()
+{
+    for (auto & system : m_systems) {
+        for (LocatedEntity * entity : system->entities) {
+            entity->decRef();
+        }
+        system->entities.clear();
+        system->slices.clear();
+        system->positions.clear();
+    }
+}
@@ -0,0 +1,150 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef COMMON_SYSTEM_SCHEDULER_H
+#define COMMON_SYSTEM_SCHEDULER_H
+
+#include "OperationRouter.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class LocatedEntity;
+
+/// \brief Runs periodic per entity updates in batches.
+///
+/// Periodic simulation such as metabolism and plant growth would otherwise
+/// be driven by one Tick operation per entity, each of which goes through
+/// the operation queue and the full entity dispatch. Instead a system is
+/// registered once with an update function and an interval, entities are
+/// added to it, and every time the interval has passed the update function
+/// is called for all the entities of the system in a single pass.
+///
+/// Any operations resulting from the updates are handed to the result
+/// processor, in the same way as the result of an operation would be.
+///
+/// A system can be split into slices, so that its entities are not all
+/// updated at the same moment. Each run then only updates the entities of
+/// one slice, and every entity is still updated once per interval.
+class SystemScheduler
+{
+    public:
+        /// \brief Function called to update an entity in a system
+        typedef std::function<void(LocatedEntity &, OpVector &)> UpdateFunction;
+
+        /**
+         * @brief Ctor.
+         * @param resultProcessor Called with each operation resulting from an update, and the entity that was updated.
+         * @param timeProviderFn Provides the current time.
+         */
+        SystemScheduler(const std::function<void(const Operation &, LocatedEntity &)> & resultProcessor,
+                        const std::function<double()> & timeProviderFn);
+
+        ~SystemScheduler();
+
+        SystemScheduler(const SystemScheduler &) = delete;
+        SystemScheduler & operator=(const SystemScheduler &) = delete;
+
+        /**
+         * @brief Registers a system.
+         *
+         * If a system with the same name already exists its id is returned,
+         * and the interval and update function are left unchanged.
+         * @param name The name of the system.
+         * @param interval Seconds between each update of the entities.
+         * @param update The function called for each entity.
+         * @param slices The number of slices the entities are spread over.
+         * @return The id of the system.
+         */
+        int addSystem(const std::string & name,
+                      double interval,
+                      const UpdateFunction & update,
+                      int slices = 1);
+
+        /**
+         * @brief Adds an entity to a system.
+         *
+         * A reference to the entity is held until it is removed, or it is
+         * found to be destroyed when the system runs.
+         * @param slice The slice the entity is updated in, modulo the number of slices of the system.
+         * @return True if the entity was added, false if already present.
+         */
+        bool addEntity(int system, LocatedEntity & entity, int slice = 0);
+
+        /**
+         * @brief Removes an entity from a system.
+         * @return True if the entity was removed.
+         */
+        bool removeEntity(int system, LocatedEntity & entity);
+
+        bool hasEntity(int system, const LocatedEntity & entity) const;
+
+        /**
+         * @brief Gets the number of entities in a system.
+         */
+        std::size_t entityCount(int system) const;
+
+        /**
+         * @brief Runs all systems which are due.
+         * @return The number of entities updated.
+         */
+        std::size_t run();
+
+        /**
+         * Gets the number of seconds until the next system needs to run.
+         * @return Seconds, or a negative value if there are no entities in any system.
+         */
+        double secondsUntilNextRun() const;
+
+        /**
+         * @brief Removes all entities from all systems.
+         */
+        void clear();
+
+    protected:
+        struct System {
+            std::string name;
+            /// Seconds between each run, which is the interval divided by the number of slices.
+            double interval;
+            double nextRun;
+            int sliceCount;
+            /// The slice updated by the next run.
+            int nextSlice;
+            UpdateFunction update;
+            /// Entities updated by the system, kept contiguous.
+            std::vector<LocatedEntity *> entities;
+            /// Slice of each entity, parallel to the entities vector.
+            std::vector<int> slices;
+            /// Position of each entity in the entities vector.
+            std::unordered_map<const LocatedEntity *, std::size_t> positions;
+        };
+
+        std::function<void(const Operation &, LocatedEntity &)> m_resultProcessor;
+        const std::function<double()> m_timeProviderFn;
+
+        std::vector<std::unique_ptr<System>> m_systems;
+
+        void removeAt(System & system, std::size_t index);
+
+        std::size_t runSystem(System & system);
+};
+
+#endif // COMMON_SYSTEM_SCHEDULER_H
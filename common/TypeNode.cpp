@@ -56,6 +56,7 @@ void TypeNode::injectProperty(const std::string& name,
         m_defaults.erase(existingI);
     }
     m_defaults.emplace(name, p);
+    updateDelegates(PropertyKey::find(name), p);
     Atlas::Message::Element attributesElement = Atlas::Message::MapType();
     if (m_description->hasAttr("attributes")) {
         attributesElement = m_description->getAttr("attributes");
@@ -69,6 +70,55 @@ void TypeNode::injectProperty(const std::string& name,
     m_description->setAttr("attributes", attributesElement);
 }
 
+/// \brief Point any delegates to a class property at a new property
+///
+/// @param property the new property, or null if the class property has
+/// been removed
+void TypeNode::updateDelegates(const PropertyKey & key,
+                               PropertyBase * property)
+{
+    for (auto & delegates : m_delegates) {
+        for (auto & delegate : delegates) {
+            if (delegate.key == key) {
+                delegate.property = property;
+            }
+        }
+    }
+}
+
+void TypeNode::addDelegate(int class_no, const std::string & name,
+                           PropertyBase * property)
+{
+    if (class_no < 0) {
+        return;
+    }
+    PropertyKey key = PropertyKey::intern(name);
+    if ((std::size_t)class_no >= m_delegates.size()) {
+        m_delegates.resize(class_no + 1);
+    }
+    for (auto & delegate : m_delegates[class_no]) {
+        if (delegate.key == key) {
+            delegate.property = property;
+            return;
+        }
+    }
+    m_delegates[class_no].push_back(PropertyDelegate{key, property});
+}
+
+bool TypeNode::hasDelegate(int class_no, const PropertyKey & key) const
+{
+    const DelegateList * list = delegates(class_no);
+    if (list == nullptr) {
+        return false;
+    }
+    for (auto & delegate : *list) {
+        if (delegate.key == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void TypeNode::addProperties(const MapType & attributes)
 {
     for (auto entry : attributes) {
@@ -79,6 +129,7 @@ void TypeNode::addProperties(const MapType & attributes)
         p->setFlags(flag_class);
         p->install(this, entry.first);
         m_defaults[entry.first] = p;
+        updateDelegates(PropertyKey::find(entry.first), p);
     }
 }
 
@@ -99,6 +150,7 @@ void TypeNode::updateProperties(const MapType & attributes)
     // no longer exist
     for (auto& entry : removed_properties) {
         auto M = m_defaults.find(entry);
+        updateDelegates(PropertyKey::find(M->first), nullptr);
         delete M->second;
         m_defaults.erase(M);
     }
@@ -115,6 +167,7 @@ void TypeNode::updateProperties(const MapType & attributes)
             p->setFlags(flag_class);
             p->install(this, entry.first);
             m_defaults[entry.first] = p;
+            updateDelegates(PropertyKey::find(entry.first), p);
             newProps.emplace(entry.first, p);
         } else {
             p = I->second;
@@ -153,6 +206,14 @@ bool TypeNode::isTypeOf(const std::string & base_type) const
 
 bool TypeNode::isTypeOf(const TypeNode * base_type) const
 {
+    // If both nodes have been numbered in the same tree, this type is a
+    // descendant of the base if its index falls inside the subtree interval
+    // of the base.
+    if (m_treeIndex != -1 && base_type != nullptr &&
+        base_type->m_treeIndex != -1) {
+        return base_type->m_treeIndex <= m_treeIndex &&
+               m_treeIndex <= base_type->m_treeLast;
+    }
     const TypeNode * node = this;
     do {
         if (node == base_type) {
@@ -19,15 +19,24 @@
 #ifndef COMMON_TYPE_NODE_H
 #define COMMON_TYPE_NODE_H
 
+#include "PropertyDict.h"
+
 #include <Atlas/Objects/Root.h>
 #include <Atlas/Objects/SmartPtr.h>
 
 #include <iostream>
 #include <map>
+#include <vector>
 
 class PropertyBase;
 
-typedef std::map<std::string, PropertyBase *> PropertyDict;
+/// \brief A class property which operations of one class are delegated to
+struct PropertyDelegate {
+    PropertyKey key;
+    /// \brief The class property, or null if it has been removed from the type
+    PropertyBase * property;
+};
+
 
 /// \brief Entry in the type hierarchy for in-game entity classes.
 class TypeNode {
@@ -43,7 +52,26 @@ class TypeNode {
 
     /// \brief parent node
     const TypeNode * m_parent;
+
+    /// \brief pre-order index of this node in the inheritance tree
+    ///
+    /// -1 if the tree has not been numbered since this node was added.
+    int m_treeIndex = -1;
+
+    /// \brief highest pre-order index found in the subtree of this node
+    int m_treeLast = -1;
+
+    /// \brief delegates to class properties, indexed by operation class number
+    ///
+    /// Filled in as the class properties are installed on the type, so that
+    /// each delegate is resolved once for the type rather than stored and
+    /// looked up by name on every entity.
+    std::vector<std::vector<PropertyDelegate>> m_delegates;
+
+    void updateDelegates(const PropertyKey & key, PropertyBase * property);
   public:
+    typedef std::vector<PropertyDelegate> DelegateList;
+
     explicit TypeNode(const std::string &);
     TypeNode(const std::string &, const Atlas::Objects::Root &);
     ~TypeNode();
@@ -83,6 +111,27 @@ class TypeNode {
         return m_description;
     }
 
+    /// \brief the class property delegates for an operation class
+    ///
+    /// @return the delegates, or null if there are none
+    const DelegateList * delegates(int class_no) const {
+        if (class_no < 0 || (std::size_t)class_no >= m_delegates.size() ||
+            m_delegates[class_no].empty()) {
+            return nullptr;
+        }
+        return &m_delegates[class_no];
+    }
+
+    /// \brief delegate an operation class to a class property
+    ///
+    /// Called by class properties as they are installed on the type, so
+    /// that the delegate applies to all entities of the type.
+    void addDelegate(int class_no, const std::string & name,
+                     PropertyBase * property);
+
+    /// \brief check if an operation class is delegated to a class property
+    bool hasDelegate(int class_no, const PropertyKey & key) const;
+
     /// \brief const accessor for parent node
     const TypeNode * parent() const {
         return m_parent;
@@ -91,6 +140,26 @@ class TypeNode {
     /// \brief set the parent node
     void setParent(const TypeNode * parent) {
         m_parent = parent;
+        m_treeIndex = m_treeLast = -1;
+    }
+
+    /// \brief const accessor for the pre-order index in the inheritance tree
+    int treeIndex() const {
+        return m_treeIndex;
+    }
+
+    /// \brief const accessor for the last pre-order index in the subtree
+    int treeLast() const {
+        return m_treeLast;
+    }
+
+    /// \brief set the interval of pre-order indices covered by this node
+    ///
+    /// Used by Inheritance when it renumbers the tree, so that isTypeOf()
+    /// can be answered with two comparisons.
+    void setTreeInterval(int index, int last) {
+        m_treeIndex = index;
+        m_treeLast = last;
     }
 };
 
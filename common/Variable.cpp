@@ -18,6 +18,7 @@
 
 #include "Variable.h"
 
+#include <cstdint>
 #include <iostream>
 
 VariableBase::~VariableBase()
@@ -47,6 +48,12 @@ bool Variable<int>::isNumeric() const
     return true;
 }
 
+template <>
+bool Variable<std::int64_t>::isNumeric() const
+{
+    return true;
+}
+
 template <>
 bool Variable<std::string>::isNumeric() const
 {
@@ -60,6 +67,7 @@ bool Variable<const char *>::isNumeric() const
 }
 
 template class Variable<int>;
+template class Variable<std::int64_t>;
 template class Variable<std::string>;
 template class Variable<const char *>;
 
@@ -108,6 +108,17 @@ static const usage_data usage[] = {
     { CYPHESIS, "daemon", "true|false", "false", "Flag to control running the server in daemon mode", S },
     { CYPHESIS, "nice", "<level>", "1", "Reduce the priority level of the server", S },
     { CYPHESIS, "useaiclient", "true|false", "false", "Flag to control whether AI is to be driven by a client", S },
+    { CYPHESIS, "aiworkers", "<count>", "1", "Number of worker processes each AI client runs, each possessing its share of the minds", A },
+    { CYPHESIS, "mindmemory", "<entities>", "0", "Max number of entities each mind remembers, 0 for no limit", A },
+    { CYPHESIS, "aibatchsize", "<count>", "64", "Max number of operations the AI client holds back to send to the server in one write, 1 to send each on its own", A },
+    { CYPHESIS, "aibatchinterval", "<milliseconds>", "20", "Max time the AI client holds back operations to send to the server in one write", A },
+    { CYPHESIS, "aimonitors", "<directory>", "", "Directory in which each AI client worker writes its monitors every ten seconds, to the file cyphesis_aiclient_<worker>.monitors. Defaults to the temporary directory; set to none to disable", A },
+    { CYPHESIS, "navmeshthreads", "<count>", "2", "Number of threads building navmesh tiles for the AI, 0 to build them on the main thread", A },
+    { CYPHESIS, "pathiterations", "<count>", "500", "Max number of path search iterations done for all AI minds sharing a navmesh on each movement tick", A },
+    { CYPHESIS, "mindlod", "<distance>", "0", "Distance to the nearest player within which AI minds think and move at full rate. Farther away they do so less often; 0 runs all minds at full rate", A },
+    { CYPHESIS, "crowdavoidance", "true|false", "false", "Flag to control whether the AI avoids moving obstacles in one pass for all minds in an area, instead of once for each mind", A },
+    { CYPHESIS, "navmeshcache", "<directory>", "", "Directory in which built navmesh tiles are kept between restarts of the AI. Defaults to a directory in the temporary directory; set to none to disable", A },
+    { CYPHESIS, "navmeshcachesize", "<megabytes>", "256", "Max size of the navmesh tiles kept between restarts of the AI. The least recently used tiles are removed when it's exceeded; 0 for no limit", A },
     { CYPHESIS, "dbserver", "<hostname>", "", "Hostname for the PostgreSQL RDBMS", S|D },
     { CYPHESIS, "dbname", "<name>", "\"cyphesis\"", "Name of the database to use", S|D },
     { CYPHESIS, "dbuser", "<dbusername>", "<username>", "Database user name for access", S|D },
@@ -57,6 +57,8 @@
 #include "AwarenessUtils.h"
 
 #include "IHeightProvider.h"
+#include "TileBuildPool.h"
+#include "TileDiskCache.h"
 
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
@@ -81,16 +83,24 @@
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 #include <cstring>
+#include <limits>
 #include <queue>
+#include <unordered_map>
 
 static const bool debug_flag = false;
 
 #define MAX_PATHPOLY      256 // max number of polygons in a path
 #define MAX_PATHVERT      512 // most verts in a path
 #define MAX_OBSTACLES_CIRCLES 4 // max number of circle obstacles to consider when doing avoidance
+#define AVOIDANCE_RADIUS 5 // radius around an agent within which obstacles are considered when doing avoidance
 
 // This value specifies how many layers (or "floors") each navmesh tile is expected to have.
 static const int EXPECTED_LAYERS_PER_TILE = 1;
@@ -139,6 +149,391 @@ struct InputGeometry
         std::vector<WFMath::RotBox<2>> entityAreas;
 };
 
+/**
+ * @brief Everything needed to rasterize a tile.
+ *
+ * This is gathered on the main thread, so that the tile can be rasterized on any thread.
+ */
+struct TileBuildInput
+{
+        int tx;
+        int ty;
+        /**
+         * @brief The config of the tile, including the border.
+         */
+        rcConfig cfg;
+        int heightsXMin;
+        int heightsXMax;
+        int heightsYMin;
+        int heightsYMax;
+        std::vector<float> heights;
+        std::vector<WFMath::RotBox<2>> entityAreas;
+};
+
+/**
+ * @brief A tile rasterized by the tile build pool.
+ */
+struct BuiltTile
+{
+        int tx;
+        int ty;
+        int ntiles;
+        TileCacheData tiles[MAX_LAYERS];
+        std::chrono::steady_clock::time_point queuedTime;
+        std::chrono::steady_clock::duration buildTime;
+        bool fromCache;
+};
+
+struct TileBuildResults
+{
+        std::mutex mutex;
+        std::vector<BuiltTile> tiles;
+
+        ~TileBuildResults()
+        {
+            //Free any tiles which were built after the awareness was destroyed.
+            for (auto& builtTile : tiles) {
+                for (int i = 0; i < builtTile.ntiles; ++i) {
+                    dtFree(builtTile.tiles[i].data);
+                }
+            }
+        }
+};
+
+/**
+ * @brief The state of the path request currently being searched for.
+ */
+struct ActivePathSearch
+{
+        Awareness::PathRequest request;
+        dtPolyRef startRef = 0;
+        dtPolyRef endRef = 0;
+        float startNearest[3];
+        float endNearest[3];
+        std::vector<dtPolyRef> polys;
+        /**
+         * @brief Set when the search has been restarted because the navmesh changed during it.
+         */
+        bool restarted = false;
+        bool cacheHit = false;
+        int result = 0;
+        std::list<WFMath::Point<3>> path;
+};
+
+/**
+ * @brief A small most recently used list of polygon corridors.
+ *
+ * Agents often ask for the same paths again, such as when they replan while still being on the same polygon.
+ * Only corridors which reach all the way to the end polygon are kept.
+ */
+struct PathCorridorCache
+{
+        struct Entry
+        {
+            dtPolyRef startRef;
+            dtPolyRef endRef;
+            std::vector<dtPolyRef> polys;
+        };
+
+        static const size_t MAX_ENTRIES = 32;
+
+        std::list<Entry> entries;
+
+        const std::vector<dtPolyRef>* find(dtPolyRef startRef, dtPolyRef endRef)
+        {
+            for (auto I = entries.begin(); I != entries.end(); ++I) {
+                if (I->startRef == startRef && I->endRef == endRef) {
+                    entries.splice(entries.begin(), entries, I);
+                    return &entries.front().polys;
+                }
+            }
+            return nullptr;
+        }
+
+        void insert(dtPolyRef startRef, dtPolyRef endRef, const std::vector<dtPolyRef>& polys)
+        {
+            entries.push_front(Entry { startRef, endRef, polys });
+            if (entries.size() > MAX_ENTRIES) {
+                entries.pop_back();
+            }
+        }
+};
+
+Awareness::TileBuildStatistics Awareness::s_tileBuildStatistics;
+Awareness::PathStatistics Awareness::s_pathStatistics;
+Awareness::CrowdStatistics Awareness::s_crowdStatistics;
+
+/**
+ * @brief The number of recent path latencies the percentiles are calculated from.
+ */
+static const size_t PATH_LATENCY_SAMPLES = 256;
+static std::vector<float> sPathLatencies;
+static size_t sNextPathLatency = 0;
+
+static void recordPathLatency(std::chrono::steady_clock::duration latency)
+{
+    float milliseconds = std::chrono::duration_cast<std::chrono::microseconds>(latency).count() / 1000.f;
+    if (sPathLatencies.size() < PATH_LATENCY_SAMPLES) {
+        sPathLatencies.push_back(milliseconds);
+    } else {
+        sPathLatencies[sNextPathLatency] = milliseconds;
+        sNextPathLatency = (sNextPathLatency + 1) % PATH_LATENCY_SAMPLES;
+    }
+}
+
+static int latencyPercentile(std::vector<float>& samples, float fraction)
+{
+    auto nth = samples.begin() + std::min(samples.size() - 1, (size_t)(samples.size() * fraction));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return (int)std::ceil(*nth);
+}
+
+static void publishPathLatencies()
+{
+    if (sPathLatencies.empty()) {
+        return;
+    }
+    std::vector<float> samples(sPathLatencies);
+    Awareness::s_pathStatistics.latencyP50Milliseconds = latencyPercentile(samples, 0.5f);
+    Awareness::s_pathStatistics.latencyP90Milliseconds = latencyPercentile(samples, 0.9f);
+    Awareness::s_pathStatistics.latencyP99Milliseconds = latencyPercentile(samples, 0.99f);
+}
+
+/**
+ * @brief Gets the extents used to find the start and end polygons of a path.
+ */
+static void getPathExtents(float agentRadius, float radius, float* startExtent, float* endExtent)
+{
+    //Only extend radius in horizontal plane
+    startExtent[0] = agentRadius * 2.2f;
+    startExtent[1] = 100;
+    startExtent[2] = agentRadius * 2.2f;
+    //To make sure that the agent can move close enough we need to subtract the agent's radius from the destination radius.
+    //We'll also adjust with 0.95 to allow for some padding.
+    float destinationRadius = (radius - agentRadius) * 0.95f;
+    endExtent[0] = destinationRadius;
+    endExtent[1] = 100;
+    endExtent[2] = destinationRadius;
+}
+
+/**
+ * @brief The number of tiles each awareness may have queued for each thread in the pool.
+ *
+ * Keeping this low means that tiles are picked as late as possible, closest to where the agents are at that time.
+ */
+static const size_t TILES_IN_PROGRESS_PER_THREAD = 2;
+
+/**
+ * @brief Adds the time it took to build a tile to the statistics.
+ */
+static void recordTileBuild(std::chrono::steady_clock::duration buildTime, std::chrono::steady_clock::duration latency, bool fromCache)
+{
+    //Sums are kept in microseconds, so that short builds aren't rounded away.
+    static long long buildMicroseconds = 0;
+    static long long latencyMicroseconds = 0;
+    buildMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(buildTime).count();
+    latencyMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    Awareness::s_tileBuildStatistics.built++;
+    if (fromCache) {
+        Awareness::s_tileBuildStatistics.cacheHits++;
+    }
+    Awareness::s_tileBuildStatistics.buildMilliseconds = buildMicroseconds / 1000;
+    Awareness::s_tileBuildStatistics.latencyMilliseconds = latencyMicroseconds / 1000;
+}
+
+/**
+ * @brief A moving entity, projected to where it is at the time avoidance is done.
+ */
+struct AvoidanceObstacle
+{
+        long entityId;
+        WFMath::Point<2> position;
+        float radius;
+        WFMath::Vector<2> velocity;
+};
+
+static bool projectObstacle(const EntityEntry& entity, double currentTimestamp, AvoidanceObstacle& obstacle)
+{
+    double time_diff = currentTimestamp - entity.location.timeStamp();
+
+    Point3D pos = entity.location.pos();
+    if (entity.location.velocity().isValid()) {
+        pos += (entity.location.velocity() * time_diff);
+    }
+
+    if (!pos.isValid()) {
+        return false;
+    }
+
+    obstacle.entityId = entity.entityId;
+    obstacle.position = WFMath::Point<2>(pos.x(), pos.z());
+    obstacle.radius = entity.location.radius();
+    if (entity.location.velocity().isValid()) {
+        obstacle.velocity = WFMath::Vector<2>(entity.location.velocity().x(), entity.location.velocity().z());
+    } else {
+        obstacle.velocity = WFMath::Vector<2>::ZERO();
+    }
+    return true;
+}
+
+static bool isObstacleNear(const WFMath::Ball<2>& agentArea, const AvoidanceObstacle& obstacle)
+{
+    WFMath::Ball<2> obstacleArea(obstacle.position, obstacle.radius);
+    return WFMath::Intersect(agentArea, obstacleArea, false) || WFMath::Contains(agentArea, obstacleArea, false);
+}
+
+/**
+ * @brief Samples a new velocity for an agent, avoiding the nearest of the obstacles.
+ * @param obstacles Obstacles near the agent. These are reordered.
+ * @return True if the velocity had to be changed in order to avoid obstacles.
+ */
+static bool sampleAvoidanceVelocity(dtObstacleAvoidanceQuery& query, const dtObstacleAvoidanceParams& params, float agentRadius, const WFMath::Point<2>& position,
+        const WFMath::Vector<2>& desiredVelocity, std::vector<AvoidanceObstacle>& obstacles, WFMath::Vector<2>& newVelocity)
+{
+    if (obstacles.empty()) {
+        return false;
+    }
+
+    size_t count = std::min(obstacles.size(), (size_t)MAX_OBSTACLES_CIRCLES);
+    std::partial_sort(obstacles.begin(), obstacles.begin() + count, obstacles.end(), [&](const AvoidanceObstacle& a, const AvoidanceObstacle& b) {
+        return WFMath::SquaredDistance(position, a.position) < WFMath::SquaredDistance(position, b.position);
+    });
+
+    query.reset();
+    for (size_t i = 0; i < count; ++i) {
+        auto& obstacle = obstacles[i];
+        float pos[] { obstacle.position.x(), 0, obstacle.position.y() };
+        float vel[] { obstacle.velocity.x(), 0, obstacle.velocity.y() };
+        query.addCircle(pos, obstacle.radius, vel, vel);
+    }
+
+    float pos[] { position.x(), 0, position.y() };
+    float vel[] { desiredVelocity.x(), 0, desiredVelocity.y() };
+    float dvel[] { desiredVelocity.x(), 0, desiredVelocity.y() };
+    float nvel[] { 0, 0, 0 };
+    float desiredSpeed = desiredVelocity.mag();
+
+    int samples = query.sampleVelocityGrid(pos, agentRadius, desiredSpeed, vel, dvel, nvel, &params, nullptr);
+    if (samples > 0) {
+        if (!WFMath::Equal(vel[0], nvel[0]) || !WFMath::Equal(vel[2], nvel[2])) {
+            newVelocity.x() = nvel[0];
+            newVelocity.y() = nvel[2];
+            newVelocity.setValid(true);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief The number of crowd agents handled by each job of a crowd avoidance pass.
+ */
+static const size_t CROWD_AGENTS_PER_CHUNK = 32;
+
+/**
+ * @brief One crowd avoidance pass, shared by the main thread and any threads helping out with it.
+ *
+ * Helpers which start after all chunks have been taken don't touch anything but this, so they
+ * can safely run after the pass is done.
+ */
+struct CrowdPass
+{
+        typedef std::int64_t CellKey;
+
+        std::vector<AvoidanceObstacle> obstacles;
+        /**
+         * @brief Indices into obstacles, bucketed by every cell their areas touch.
+         */
+        std::unordered_map<CellKey, std::vector<size_t>> cells;
+        std::vector<std::pair<long, Awareness::CrowdAgent*>> agents;
+        dtObstacleAvoidanceParams params;
+        float agentRadius;
+
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk { 0 };
+        std::atomic<size_t> completedChunks { 0 };
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        static int cellIndex(float coord)
+        {
+            return (int)std::floor(coord / AVOIDANCE_RADIUS);
+        }
+
+        static CellKey key(int x, int y)
+        {
+            return (CellKey)(((std::uint64_t)(std::uint32_t)x << 32) | (std::uint32_t)y);
+        }
+
+        void addObstacle(const AvoidanceObstacle& obstacle)
+        {
+            size_t index = obstacles.size();
+            obstacles.push_back(obstacle);
+            for (int x = cellIndex(obstacle.position.x() - obstacle.radius); x <= cellIndex(obstacle.position.x() + obstacle.radius); ++x) {
+                for (int y = cellIndex(obstacle.position.y() - obstacle.radius); y <= cellIndex(obstacle.position.y() + obstacle.radius); ++y) {
+                    cells[key(x, y)].push_back(index);
+                }
+            }
+        }
+
+        void avoid(dtObstacleAvoidanceQuery& query, long entityId, Awareness::CrowdAgent& agent, std::vector<size_t>& candidates, std::vector<AvoidanceObstacle>& nearby)
+        {
+            WFMath::Ball<2> agentArea(agent.position, AVOIDANCE_RADIUS);
+
+            candidates.clear();
+            for (int x = cellIndex(agent.position.x() - AVOIDANCE_RADIUS); x <= cellIndex(agent.position.x() + AVOIDANCE_RADIUS); ++x) {
+                for (int y = cellIndex(agent.position.y() - AVOIDANCE_RADIUS); y <= cellIndex(agent.position.y() + AVOIDANCE_RADIUS); ++y) {
+                    auto I = cells.find(key(x, y));
+                    if (I != cells.end()) {
+                        candidates.insert(candidates.end(), I->second.begin(), I->second.end());
+                    }
+                }
+            }
+            //Obstacles spanning more than one cell are found in each of them.
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+            nearby.clear();
+            for (auto index : candidates) {
+                auto& obstacle = obstacles[index];
+                //Don't avoid ourselves.
+                if (obstacle.entityId != entityId && isObstacleNear(agentArea, obstacle)) {
+                    nearby.push_back(obstacle);
+                }
+            }
+
+            agent.avoiding = sampleAvoidanceVelocity(query, params, agentRadius, agent.position, agent.desiredVelocity, nearby, agent.newVelocity);
+        }
+
+        /**
+         * @brief Takes chunks of agents and does avoidance for them until there are none left.
+         * @param query A query to use, or null if one should be allocated if needed.
+         */
+        void run(dtObstacleAvoidanceQuery* query)
+        {
+            dtObstacleAvoidanceQuery* ownQuery = nullptr;
+            std::vector<size_t> candidates;
+            std::vector<AvoidanceObstacle> nearby;
+            size_t chunk;
+            while ((chunk = nextChunk++) < chunkCount) {
+                if (!query) {
+                    ownQuery = dtAllocObstacleAvoidanceQuery();
+                    ownQuery->init(MAX_OBSTACLES_CIRCLES, 0);
+                    query = ownQuery;
+                }
+                size_t end = std::min(agents.size(), (chunk + 1) * CROWD_AGENTS_PER_CHUNK);
+                for (size_t i = chunk * CROWD_AGENTS_PER_CHUNK; i < end; ++i) {
+                    avoid(*query, agents[i].first, *agents[i].second, candidates, nearby);
+                }
+                if (++completedChunks == chunkCount) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    condition.notify_all();
+                }
+            }
+            dtFreeObstacleAvoidanceQuery(ownQuery);
+        }
+};
+
 class AwarenessContext: public rcContext
 {
     protected:
@@ -155,9 +550,9 @@ class AwarenessContext: public rcContext
 
 };
 
-Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize) :
-        mHeightProvider(heightProvider), mDomainEntity(domainEntity), mTalloc(nullptr), mTcomp(nullptr), mTmproc(nullptr), mAgentRadius(agentRadius), mBaseTileAmount(128), mDesiredTilesAmount(128), mCtx(
-                new AwarenessContext()), mTileCache(nullptr), mNavMesh(nullptr), mNavQuery(dtAllocNavMeshQuery()), mFilter(nullptr), mActiveTileList(nullptr), mObserverCount(0)
+Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize, TileBuildPool* tileBuildPool, TileDiskCache* tileDiskCache) :
+        mHeightProvider(heightProvider), mDomainEntity(domainEntity), mTileBuildPool(tileBuildPool), mTileDiskCache(tileDiskCache), mBuildResults(new TileBuildResults()), mTalloc(nullptr), mTcomp(nullptr), mTmproc(nullptr), mAgentRadius(agentRadius), mBaseTileAmount(128), mDesiredTilesAmount(128), mCtx(
+                new AwarenessContext()), mTileCache(nullptr), mNavMesh(nullptr), mNavQuery(dtAllocNavMeshQuery()), mSlicedNavQuery(dtAllocNavMeshQuery()), mPathSearchTimestamp(0), mPathCorridorCache(new PathCorridorCache()), mNextPathRequestId(1), mFilter(nullptr), mCrowdTimestamp(0), mActiveTileList(nullptr), mObserverCount(0)
 {
     debug_print("Creating awareness with extent " << extent << " and agent radius " << agentRadius);
     try {
@@ -274,6 +669,11 @@ Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float
             throw std::runtime_error("buildTiledNavigation: Could not init Detour navmesh query");
         }
 
+        status = mSlicedNavQuery->init(mNavMesh, 2048);
+        if (dtStatusFailed(status)) {
+            throw std::runtime_error("buildTiledNavigation: Could not init Detour sliced navmesh query");
+        }
+
         mObstacleAvoidanceQuery = dtAllocObstacleAvoidanceQuery();
         mObstacleAvoidanceQuery->init(MAX_OBSTACLES_CIRCLES, 0);
 
@@ -295,6 +695,7 @@ Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float
 
         dtFreeNavMesh(mNavMesh);
         dtFreeNavMeshQuery(mNavQuery);
+        dtFreeNavMeshQuery(mSlicedNavQuery);
         delete mFilter;
 
         dtFreeTileCache(mTileCache);
@@ -311,12 +712,16 @@ Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float
 
 Awareness::~Awareness()
 {
+    //Tiles still being built are freed along with the results, once the last job is done.
+    s_tileBuildStatistics.queued -= mTilesInProgress.size();
+    s_pathStatistics.queued -= pendingPathRequests();
 
     delete mObstacleAvoidanceParams;
     dtFreeObstacleAvoidanceQuery(mObstacleAvoidanceQuery);
 
     dtFreeNavMesh(mNavMesh);
     dtFreeNavMeshQuery(mNavQuery);
+    dtFreeNavMeshQuery(mSlicedNavQuery);
     delete mFilter;
 
     dtFreeTileCache(mTileCache);
@@ -397,7 +802,7 @@ void Awareness::removeEntity(const MemEntity& observer, const LocatedEntity& ent
                     for (auto& entry : areas) {
                         markTilesAsDirty(entry.second.boundingBox());
                     }
-                    mEntityAreas.erase(entityEntry.get());
+                    removeEntityArea(*entityEntry);
                 }
                 mObservedEntities.erase(I);
             }
@@ -449,7 +854,7 @@ void Awareness::processEntityMovementChange(EntityEntry& entityEntry, const Loca
             for (auto& entry : areas) {
                 markTilesAsDirty(entry.second.boundingBox());
             }
-            mEntityAreas.erase(&entityEntry);
+            removeEntityArea(entityEntry);
 
         } else {
 
@@ -471,7 +876,7 @@ void Awareness::processEntityMovementChange(EntityEntry& entityEntry, const Loca
                     if (existingI != mEntityAreas.end()) {
                         //The entity already was registered; mark those tiles where the entity previously were as dirty.
                         markTilesAsDirty(existingI->second.boundingBox());
-                        mEntityAreas.erase(&entityEntry);
+                        removeEntityArea(entityEntry);
                     }
                 } else {
                     std::map<const EntityEntry*, WFMath::RotBox<2>> areas;
@@ -484,9 +889,15 @@ void Awareness::processEntityMovementChange(EntityEntry& entityEntry, const Loca
                         if (existingI != mEntityAreas.end()) {
                             //The entity already was registered; mark both those tiles where the entity previously were as well as the new tiles as dirty.
                             markTilesAsDirty(existingI->second.boundingBox());
-                            existingI->second = entry.second;
-                        } else {
-                            mEntityAreas.insert(entry);
+                        }
+                        setEntityArea(*entry.first, entry.second);
+                    }
+                    if (areas.empty()) {
+                        //The entity no longer has an area, for example because it isn't solid anymore.
+                        auto existingI = mEntityAreas.find(&entityEntry);
+                        if (existingI != mEntityAreas.end()) {
+                            markTilesAsDirty(existingI->second.boundingBox());
+                            removeEntityArea(entityEntry);
                         }
                     }
                     debug_print(
@@ -499,18 +910,10 @@ void Awareness::processEntityMovementChange(EntityEntry& entityEntry, const Loca
 
 bool Awareness::avoidObstacles(long avatarEntityId, const WFMath::Point<2>& position, const WFMath::Vector<2>& desiredVelocity, WFMath::Vector<2>& newVelocity, double currentTimestamp) const
 {
-    struct EntityCollisionEntry
-    {
-            float distance;
-            const EntityEntry* entity;
-            WFMath::Point<2> viewPosition;
-            WFMath::Ball<2> viewRadius;
-    };
+    WFMath::Ball<2> agentArea(position, AVOIDANCE_RADIUS);
+    std::vector<AvoidanceObstacle> obstacles;
 
-    auto comp = []( EntityCollisionEntry& a, EntityCollisionEntry& b ) {return a.distance < b.distance;};
-    std::priority_queue<EntityCollisionEntry, std::vector<EntityCollisionEntry>, decltype( comp )> nearestEntities(comp);
-
-    WFMath::Ball<2> playerRadius(position, 5);
+    std::lock_guard<std::mutex> lock(mNavMeshMutex);
 
     for (auto& entity : mMovingEntities) {
 
@@ -521,59 +924,87 @@ bool Awareness::avoidObstacles(long avatarEntityId, const WFMath::Point<2>& posi
             continue;
         }
 
-        double time_diff = currentTimestamp - entity->location.timeStamp();
-
-        // Update location
-        Point3D pos = entity->location.pos();
-        if (entity->location.velocity().isValid()) {
-            pos += (entity->location.velocity() * time_diff);
+        AvoidanceObstacle obstacle;
+        if (projectObstacle(*entity, currentTimestamp, obstacle) && isObstacleNear(agentArea, obstacle)) {
+            obstacles.push_back(obstacle);
         }
+    }
 
-        if (!pos.isValid()) {
-            continue;
-        }
+    return sampleAvoidanceVelocity(*mObstacleAvoidanceQuery, *mObstacleAvoidanceParams, mAgentRadius, position, desiredVelocity, obstacles, newVelocity);
+}
 
-        WFMath::Point<2> entityView2dPos(pos.x(), pos.z());
-        WFMath::Ball<2> entityViewRadius(entityView2dPos, entity->location.radius());
+void Awareness::setCrowdAgent(long avatarEntityId, const WFMath::Point<2>& position, const WFMath::Vector<2>& desiredVelocity)
+{
+    auto& agent = mCrowdAgents[avatarEntityId];
+    agent.position = position;
+    agent.desiredVelocity = desiredVelocity;
+}
 
-        if (WFMath::Intersect(playerRadius, entityViewRadius, false) || WFMath::Contains(playerRadius, entityViewRadius, false)) {
-            nearestEntities.push(EntityCollisionEntry( { WFMath::Distance(position, entityView2dPos), entity, entityView2dPos, entityViewRadius }));
-        }
+void Awareness::removeCrowdAgent(long avatarEntityId)
+{
+    mCrowdAgents.erase(avatarEntityId);
+}
 
+bool Awareness::updateCrowd(double currentTimestamp, double minInterval)
+{
+    //Every agent sharing this awareness calls this on its tick, but only one of them needs to do the pass.
+    if (mCrowdAgents.empty() || (currentTimestamp >= mCrowdTimestamp && currentTimestamp - mCrowdTimestamp < minInterval)) {
+        return false;
     }
+    mCrowdTimestamp = currentTimestamp;
 
-    if (!nearestEntities.empty()) {
-        mObstacleAvoidanceQuery->reset();
-        int i = 0;
-        while (!nearestEntities.empty() && i < MAX_OBSTACLES_CIRCLES) {
-            const EntityCollisionEntry& entry = nearestEntities.top();
-            auto& entity = entry.entity;
-            float pos[] { entry.viewPosition.x(), 0, entry.viewPosition.y() };
-            float vel[] { entity->location.velocity().x(), 0, entity->location.velocity().z() };
-            mObstacleAvoidanceQuery->addCircle(pos, entry.viewRadius.radius(), vel, vel);
-            nearestEntities.pop();
-            ++i;
-        }
+    auto start = std::chrono::steady_clock::now();
 
-        float pos[] { position.x(), 0, position.y() };
-        float vel[] { desiredVelocity.x(), 0, desiredVelocity.y() };
-        float dvel[] { desiredVelocity.x(), 0, desiredVelocity.y() };
-        float nvel[] { 0, 0, 0 };
-        float desiredSpeed = desiredVelocity.mag();
-
-        int samples = mObstacleAvoidanceQuery->sampleVelocityGrid(pos, mAgentRadius, desiredSpeed, vel, dvel, nvel, mObstacleAvoidanceParams, nullptr);
-        if (samples > 0) {
-            if (!WFMath::Equal(vel[0], nvel[0]) || !WFMath::Equal(vel[2], nvel[2])) {
-                newVelocity.x() = nvel[0];
-                newVelocity.y() = nvel[2];
-                newVelocity.setValid(true);
-                return true;
-            }
+    //Moving entities are projected and bucketed once, instead of once for every agent.
+    auto pass = std::make_shared<CrowdPass>();
+    pass->obstacles.reserve(mMovingEntities.size());
+    for (auto& entity : mMovingEntities) {
+        AvoidanceObstacle obstacle;
+        if (projectObstacle(*entity, currentTimestamp, obstacle)) {
+            pass->addObstacle(obstacle);
+        }
+    }
+    pass->agents.reserve(mCrowdAgents.size());
+    for (auto& entry : mCrowdAgents) {
+        pass->agents.emplace_back(entry.first, &entry.second);
+    }
+    pass->params = *mObstacleAvoidanceParams;
+    pass->agentRadius = mAgentRadius;
+    pass->chunkCount = (pass->agents.size() + CROWD_AGENTS_PER_CHUNK - 1) / CROWD_AGENTS_PER_CHUNK;
+
+    if (mTileBuildPool && pass->chunkCount > 1) {
+        //The main thread takes chunks too, so the pass never waits on tiles queued before the helpers.
+        size_t helpers = std::min((size_t)mTileBuildPool->getThreadCount(), pass->chunkCount - 1);
+        for (size_t i = 0; i < helpers; ++i) {
+            mTileBuildPool->post([pass]() {
+                pass->run(nullptr);
+            });
         }
+    }
+    pass->run(mObstacleAvoidanceQuery);
+    {
+        std::unique_lock<std::mutex> lock(pass->mutex);
+        pass->condition.wait(lock, [&]() {return pass->completedChunks == pass->chunkCount;});
+    }
 
+    s_crowdStatistics.agents = (int)pass->agents.size();
+    s_crowdStatistics.passMicroseconds = (int)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool Awareness::getCrowdAvoidance(long avatarEntityId, WFMath::Vector<2>& newVelocity) const
+{
+    auto I = mCrowdAgents.find(avatarEntityId);
+    if (I != mCrowdAgents.end() && I->second.avoiding) {
+        newVelocity = I->second.newVelocity;
+        return true;
     }
     return false;
+}
 
+size_t Awareness::crowdAgentCount() const
+{
+    return mCrowdAgents.size();
 }
 
 void Awareness::markTilesAsDirty(const WFMath::AxisBox<2>& area)
@@ -607,23 +1038,113 @@ void Awareness::markTilesAsDirty(int tileMinXIndex, int tileMaxXIndex, int tileM
 
 size_t Awareness::rebuildDirtyTile()
 {
-    if (!mDirtyAwareTiles.empty()) {
-        debug_print("Rebuilding aware tiles. Number of dirty aware tiles: " << mDirtyAwareTiles.size());
-        const auto tileIndexI = mDirtyAwareOrderedTiles.begin();
-        const auto& tileIndex = *tileIndexI;
+    if (!mTileBuildPool) {
+        auto tileIndexI = findNextDirtyTile();
+        if (tileIndexI != mDirtyAwareOrderedTiles.end()) {
+            debug_print("Rebuilding aware tiles. Number of dirty aware tiles: " << mDirtyAwareTiles.size());
+            auto tileIndex = *tileIndexI;
+            mDirtyAwareTiles.erase(tileIndex);
+            mDirtyAwareOrderedTiles.erase(tileIndexI);
+            rebuildTile(tileIndex.first, tileIndex.second);
+        }
+        return mDirtyAwareTiles.size();
+    }
 
-        float tilesize = mCfg.tileSize * mCfg.cs;
-        WFMath::AxisBox<2> adjustedArea(WFMath::Point<2>(mCfg.bmin[0] + (tileIndex.first * tilesize), mCfg.bmin[2] + (tileIndex.second * tilesize)),
-                WFMath::Point<2>(mCfg.bmin[0] + ((tileIndex.first + 1) * tilesize), mCfg.bmin[2] + ((tileIndex.second + 1) * tilesize)));
+    collectBuiltTiles();
 
-        std::vector<WFMath::RotBox<2>> entityAreas;
-        findEntityAreas(adjustedArea, entityAreas);
-
-        rebuildTile(tileIndex.first, tileIndex.second, entityAreas);
+    const size_t maxTilesInProgress = std::max(1u, mTileBuildPool->getThreadCount()) * TILES_IN_PROGRESS_PER_THREAD;
+    while (mTilesInProgress.size() < maxTilesInProgress) {
+        auto tileIndexI = findNextDirtyTile();
+        if (tileIndexI == mDirtyAwareOrderedTiles.end()) {
+            break;
+        }
+        auto tileIndex = *tileIndexI;
         mDirtyAwareTiles.erase(tileIndex);
         mDirtyAwareOrderedTiles.erase(tileIndexI);
+
+        std::shared_ptr<TileBuildInput> input(new TileBuildInput());
+        prepareTile(tileIndex.first, tileIndex.second, *input);
+
+        mTilesInProgress.insert(tileIndex);
+        s_tileBuildStatistics.queued++;
+
+        auto results = mBuildResults;
+        auto tileDiskCache = mTileDiskCache;
+        auto queuedTime = std::chrono::steady_clock::now();
+        mTileBuildPool->post([input, results, tileDiskCache, queuedTime]() {
+            BuiltTile builtTile;
+            memset(builtTile.tiles, 0, sizeof(builtTile.tiles));
+            builtTile.tx = input->tx;
+            builtTile.ty = input->ty;
+            builtTile.queuedTime = queuedTime;
+
+            auto start = std::chrono::steady_clock::now();
+            AwarenessContext ctx;
+            builtTile.ntiles = buildTileLayers(ctx, tileDiskCache, *input, builtTile.tiles, MAX_LAYERS, builtTile.fromCache);
+            builtTile.buildTime = std::chrono::steady_clock::now() - start;
+
+            std::lock_guard<std::mutex> lock(results->mutex);
+            results->tiles.push_back(builtTile);
+        });
+    }
+    return mDirtyAwareTiles.size() + mTilesInProgress.size();
+}
+
+size_t Awareness::tilesInProgress() const
+{
+    return mTilesInProgress.size();
+}
+
+std::list<std::pair<int, int>>::iterator Awareness::findNextDirtyTile()
+{
+    float tilesize = mCfg.tileSize * mCfg.cs;
+    auto bestI = mDirtyAwareOrderedTiles.end();
+    float bestDistance = 0;
+    for (auto I = mDirtyAwareOrderedTiles.begin(); I != mDirtyAwareOrderedTiles.end(); ++I) {
+        if (mTilesInProgress.find(*I) != mTilesInProgress.end()) {
+            continue;
+        }
+        if (mAwareAreaAgents.empty()) {
+            //Without agents the order of the list is used.
+            return I;
+        }
+        WFMath::Point<2> tileCenter(mCfg.bmin[0] + ((I->first + 0.5f) * tilesize), mCfg.bmin[2] + ((I->second + 0.5f) * tilesize));
+        float distance = std::numeric_limits<float>::max();
+        for (auto& entry : mAwareAreaAgents) {
+            distance = std::min(distance, (float)WFMath::SquaredDistance(entry.second, tileCenter));
+        }
+        //Ties are resolved by the order of the list, which puts tiles along the focus line first.
+        if (bestI == mDirtyAwareOrderedTiles.end() || distance < bestDistance) {
+            bestI = I;
+            bestDistance = distance;
+        }
+    }
+    return bestI;
+}
+
+void Awareness::collectBuiltTiles()
+{
+    std::vector<BuiltTile> builtTiles;
+    {
+        std::lock_guard<std::mutex> lock(mBuildResults->mutex);
+        builtTiles.swap(mBuildResults->tiles);
+    }
+    auto now = std::chrono::steady_clock::now();
+    for (auto& builtTile : builtTiles) {
+        std::pair<int, int> index(builtTile.tx, builtTile.ty);
+        mTilesInProgress.erase(index);
+        s_tileBuildStatistics.queued--;
+        if (mAwareTiles.find(index) == mAwareTiles.end()) {
+            //The tile has left the awareness area while being built, so it's treated as if it was never built.
+            for (int i = 0; i < builtTile.ntiles; ++i) {
+                dtFree(builtTile.tiles[i].data);
+            }
+            mDirtyUnwareTiles.insert(index);
+            continue;
+        }
+        addTileLayers(builtTile.tx, builtTile.ty, builtTile.tiles, builtTile.ntiles);
+        recordTileBuild(builtTile.buildTime, now - builtTile.queuedTime, builtTile.fromCache);
     }
-    return mDirtyAwareTiles.size();
 }
 
 void Awareness::pruneTiles()
@@ -635,18 +1156,26 @@ void Awareness::pruneTiles()
             std::pair<int, int> entry = mActiveTileList->pop_back();
 
             dtCompressedTileRef tilesRefs[MAX_LAYERS];
-            const int ntiles = mTileCache->getTilesAt(entry.first, entry.second, tilesRefs, MAX_LAYERS);
+            int removed[MAX_LAYERS][3];
+            int ntiles;
+            {
+                std::lock_guard<std::mutex> lock(mNavMeshMutex);
+                ntiles = mTileCache->getTilesAt(entry.first, entry.second, tilesRefs, MAX_LAYERS);
+                for (int i = 0; i < ntiles; ++i) {
+                    const dtCompressedTile* tile = mTileCache->getTileByRef(tilesRefs[i]);
+                    int tx = tile->header->tx;
+                    int ty = tile->header->ty;
+                    int tlayer = tile->header->tlayer;
+                    mTileCache->removeTile(tilesRefs[i], nullptr, nullptr);
+                    mNavMesh->removeTile(mNavMesh->getTileRefAt(tx, ty, tlayer), 0, 0);
+                    removed[i][0] = tx;
+                    removed[i][1] = ty;
+                    removed[i][2] = tlayer;
+                }
+                mPathCorridorCache->entries.clear();
+            }
             for (int i = 0; i < ntiles; ++i) {
-                const dtCompressedTile* tile = mTileCache->getTileByRef(tilesRefs[i]);
-                float min[3];
-                int tx = tile->header->tx;
-                int ty = tile->header->ty;
-                int tlayer = tile->header->tlayer;
-                rcVcopy(min, tile->header->bmin);
-                mTileCache->removeTile(tilesRefs[i], nullptr, nullptr);
-                mNavMesh->removeTile(mNavMesh->getTileRefAt(tx, ty, tlayer), 0, 0);
-
-                EventTileRemoved(tx, ty, tlayer);
+                EventTileRemoved(removed[i][0], removed[i][1], removed[i][2]);
             }
 
         }
@@ -719,11 +1248,9 @@ int Awareness::findPath(const WFMath::Point<3>& start, const WFMath::Point<3>& e
 
     float pStartPos[] { start.x(), start.y(), start.z() };
     float pEndPos[] { end.x(), end.y(), end.z() };
-    float startExtent[] { mAgentRadius * 2.2f, 100, mAgentRadius  * 2.2f}; //Only extend radius in horizontal plane
-    //To make sure that the agent can move close enough we need to subtract the agent's radius from the destination radius.
-    //We'll also adjust with 0.95 to allow for some padding.
-    float destinationRadius = (radius - mAgentRadius) * 0.95f;
-    float endExtent[] { destinationRadius, 100, destinationRadius}; //Only extend radius in horizontal plane
+    float startExtent[3];
+    float endExtent[3];
+    getPathExtents(mAgentRadius, radius, startExtent, endExtent);
 
 
     dtStatus status;
@@ -736,6 +1263,8 @@ int Awareness::findPath(const WFMath::Point<3>& start, const WFMath::Point<3>& e
     float StraightPath[MAX_PATHVERT * 3];
     int nVertCount = 0;
 
+    std::lock_guard<std::mutex> lock(mNavMeshMutex);
+
 // find the start polygon
     status = mNavQuery->findNearestPoly(pStartPos, startExtent, mFilter, &StartPoly, StartNearest);
     if ((status & DT_FAILURE) || StartPoly == 0)
@@ -766,8 +1295,176 @@ int Awareness::findPath(const WFMath::Point<3>& start, const WFMath::Point<3>& e
     return nVertCount;
 }
 
+long Awareness::requestPath(const WFMath::Point<3>& start, const WFMath::Point<3>& end, float radius, PathCallback callback)
+{
+    long id = mNextPathRequestId++;
+    mPathRequests.push_back(PathRequest { id, start, end, radius, std::move(callback), std::chrono::steady_clock::now() });
+    s_pathStatistics.queued++;
+    return id;
+}
+
+void Awareness::cancelPathRequest(long requestId)
+{
+    if (mActivePathSearch && mActivePathSearch->request.id == requestId) {
+        //Any state left in the sliced query is reset when the next search is started.
+        mActivePathSearch.reset();
+        s_pathStatistics.queued--;
+        return;
+    }
+    auto I = std::find_if(mPathRequests.begin(), mPathRequests.end(), [&](const PathRequest& request) {return request.id == requestId;});
+    if (I != mPathRequests.end()) {
+        mPathRequests.erase(I);
+        s_pathStatistics.queued--;
+    }
+}
+
+size_t Awareness::pendingPathRequests() const
+{
+    return mPathRequests.size() + (mActivePathSearch ? 1 : 0);
+}
+
+bool Awareness::processPathRequests(int maxIterations, double currentTimestamp, double minInterval)
+{
+    //Every agent sharing this awareness calls this on its tick, but the budget is for the awareness.
+    if ((mPathRequests.empty() && !mActivePathSearch) || (currentTimestamp >= mPathSearchTimestamp && currentTimestamp - mPathSearchTimestamp < minInterval)) {
+        return false;
+    }
+    mPathSearchTimestamp = currentTimestamp;
+
+    std::vector<std::unique_ptr<ActivePathSearch>> completed;
+    {
+        std::lock_guard<std::mutex> lock(mNavMeshMutex);
+        int iterations = maxIterations;
+        while (iterations > 0) {
+            if (!mActivePathSearch) {
+                if (mPathRequests.empty()) {
+                    break;
+                }
+                mActivePathSearch.reset(new ActivePathSearch());
+                mActivePathSearch->request = std::move(mPathRequests.front());
+                mPathRequests.pop_front();
+                //Finding the end polygons is counted as one iteration, so that a queue of failing requests can't stall us.
+                iterations--;
+                if (beginPathSearch(*mActivePathSearch)) {
+                    completed.push_back(std::move(mActivePathSearch));
+                }
+                continue;
+            }
+
+            int doneIterations = 0;
+            dtStatus status = mSlicedNavQuery->updateSlicedFindPath(iterations, &doneIterations);
+            iterations -= std::max(doneIterations, 1);
+            if (dtStatusInProgress(status)) {
+                continue;
+            }
+            if (dtStatusFailed(status) && !mActivePathSearch->restarted) {
+                //The navmesh has most likely been changed under the search, so start it over.
+                mActivePathSearch->restarted = true;
+                if (beginPathSearch(*mActivePathSearch)) {
+                    completed.push_back(std::move(mActivePathSearch));
+                }
+                continue;
+            }
+            finishPathSearch(*mActivePathSearch);
+            completed.push_back(std::move(mActivePathSearch));
+        }
+    }
+
+    //Callbacks are called without the lock held, since they might make new requests.
+    auto now = std::chrono::steady_clock::now();
+    for (auto& search : completed) {
+        s_pathStatistics.queued--;
+        s_pathStatistics.completed++;
+        if (search->cacheHit) {
+            s_pathStatistics.cacheHits++;
+        }
+        recordPathLatency(now - search->request.queuedTime);
+        search->request.callback(search->result, search->path);
+    }
+    if (!completed.empty()) {
+        publishPathLatencies();
+    }
+    return true;
+}
+
+bool Awareness::beginPathSearch(ActivePathSearch& search)
+{
+    const auto& request = search.request;
+    float startPos[] { request.start.x(), request.start.y(), request.start.z() };
+    float endPos[] { request.end.x(), request.end.y(), request.end.z() };
+    float startExtent[3];
+    float endExtent[3];
+    getPathExtents(mAgentRadius, request.radius, startExtent, endExtent);
+
+    dtStatus status = mSlicedNavQuery->findNearestPoly(startPos, startExtent, mFilter, &search.startRef, search.startNearest);
+    if (dtStatusFailed(status) || search.startRef == 0) {
+        search.result = -1;
+        return true;
+    }
+    status = mSlicedNavQuery->findNearestPoly(endPos, endExtent, mFilter, &search.endRef, search.endNearest);
+    if (dtStatusFailed(status) || search.endRef == 0) {
+        search.result = -2;
+        return true;
+    }
+
+    auto cachedPolys = mPathCorridorCache->find(search.startRef, search.endRef);
+    if (cachedPolys) {
+        search.polys = *cachedPolys;
+        search.cacheHit = true;
+        straightenPath(search);
+        return true;
+    }
+
+    status = mSlicedNavQuery->initSlicedFindPath(search.startRef, search.endRef, search.startNearest, search.endNearest, mFilter);
+    if (dtStatusFailed(status)) {
+        search.result = -3;
+        return true;
+    }
+    return false;
+}
+
+void Awareness::finishPathSearch(ActivePathSearch& search)
+{
+    dtPolyRef polys[MAX_PATHPOLY];
+    int npolys = 0;
+    dtStatus status = mSlicedNavQuery->finalizeSlicedFindPath(polys, &npolys, MAX_PATHPOLY);
+    if (dtStatusFailed(status)) {
+        search.result = -3;
+        return;
+    }
+    if (npolys == 0) {
+        search.result = -4;
+        return;
+    }
+    search.polys.assign(polys, polys + npolys);
+    if (!dtStatusDetail(status, DT_PARTIAL_RESULT)) {
+        mPathCorridorCache->insert(search.startRef, search.endRef, search.polys);
+    }
+    straightenPath(search);
+}
+
+void Awareness::straightenPath(ActivePathSearch& search)
+{
+    float straightPath[MAX_PATHVERT * 3];
+    int nVertCount = 0;
+    dtStatus status = mSlicedNavQuery->findStraightPath(search.startNearest, search.endNearest, search.polys.data(), (int)search.polys.size(), straightPath, nullptr, nullptr, &nVertCount, MAX_PATHVERT);
+    if (dtStatusFailed(status)) {
+        search.result = -5;
+        return;
+    }
+    if (nVertCount == 0) {
+        search.result = -6;
+        return;
+    }
+    for (int nVert = 0; nVert < nVertCount; nVert++) {
+        search.path.emplace_back(straightPath[nVert * 3], straightPath[(nVert * 3) + 1], straightPath[(nVert * 3) + 2]);
+    }
+    search.result = nVertCount;
+}
+
 bool Awareness::projectPosition(int entityId, WFMath::Point<3>& pos, double currentServerTimestamp)
 {
+    std::lock_guard<std::mutex> lock(mNavMeshMutex);
     auto entityI = mObservedEntities.find(entityId);
     if (entityI != mObservedEntities.end()) {
         auto& entityEntry = entityI->second;
@@ -787,6 +1484,13 @@ void Awareness::setAwarenessArea(const std::string& areaId, const WFMath::RotBox
 
     auto& awareAreaSet = mAwareAreas[areaId];
 
+    //The focus line starts at the agent.
+    if (focusLine.isValid()) {
+        mAwareAreaAgents[areaId] = focusLine.endpoint(0);
+    } else {
+        mAwareAreaAgents[areaId] = area.getCenter();
+    }
+
     std::set<std::pair<int, int>> newAwareAreaSet;
 
     WFMath::AxisBox<2> axisbox = area.boundingBox();
@@ -863,8 +1567,12 @@ void Awareness::setAwarenessArea(const std::string& areaId, const WFMath::RotBox
                     }
                 } else {
                     //The tile wasn't marked as dirty in any set, but it might be that it hasn't been processed before.
-                    auto tile = mTileCache->getTileAt(tx, tz, 0);
-                    if (!tile) {
+                    const dtCompressedTile* tile;
+                    {
+                        std::lock_guard<std::mutex> lock(mNavMeshMutex);
+                        tile = mTileCache->getTileAt(tx, tz, 0);
+                    }
+                    if (!tile && mTilesInProgress.find(index) == mTilesInProgress.end()) {
                         if (focusLine.isValid() && WFMath::Intersect(focusLine, tileBounds, false)) {
                             insertFront = true;
                         } else {
@@ -940,6 +1648,7 @@ void Awareness::removeAwarenessArea(const std::string& areaId)
     }
 
     returnAwareTiles(I->second);
+    mAwareAreaAgents.erase(areaId);
 }
 
 
@@ -953,7 +1662,7 @@ size_t Awareness::unawareTilesInArea(const std::string& areaId) const
     size_t count = 0;
     auto& tileSet = I->second;
     for (auto& entry : tileSet) {
-        if (mDirtyAwareTiles.find(entry) == tileSet.end()) {
+        if (mDirtyAwareTiles.find(entry) != mDirtyAwareTiles.end() || mTilesInProgress.find(entry) != mTilesInProgress.end()) {
             ++count;
         }
     }
@@ -961,13 +1670,28 @@ size_t Awareness::unawareTilesInArea(const std::string& areaId) const
 }
 
 
-void Awareness::rebuildTile(int tx, int ty, const std::vector<WFMath::RotBox<2>>& entityAreas)
+void Awareness::rebuildTile(int tx, int ty)
 {
+    auto start = std::chrono::steady_clock::now();
+
+    TileBuildInput input;
+    prepareTile(tx, ty, input);
+
     TileCacheData tiles[MAX_LAYERS];
     memset(tiles, 0, sizeof(tiles));
 
-    int ntiles = rasterizeTileLayers(entityAreas, tx, ty, tiles, MAX_LAYERS);
+    bool fromCache;
+    int ntiles = buildTileLayers(*mCtx, mTileDiskCache, input, tiles, MAX_LAYERS, fromCache);
+
+    addTileLayers(tx, ty, tiles, ntiles);
 
+    auto buildTime = std::chrono::steady_clock::now() - start;
+    recordTileBuild(buildTime, buildTime, fromCache);
+}
+
+void Awareness::addTileLayers(int tx, int ty, TileCacheData* tiles, int ntiles)
+{
+    std::unique_lock<std::mutex> lock(mNavMeshMutex);
     for (int j = 0; j < ntiles; ++j) {
         TileCacheData* tile = &tiles[j];
 
@@ -989,6 +1713,8 @@ void Awareness::rebuildTile(int tx, int ty, const std::vector<WFMath::RotBox<2>>
     if (dtStatusFailed(status)) {
         log(WARNING, String::compose("Failed to build nav mesh tile in awareness. x: %1 y: %2 Reason: %3", tx, ty, status));
     }
+    mPathCorridorCache->entries.clear();
+    lock.unlock();
 
     EventTileUpdated(tx, ty);
 
@@ -1036,26 +1762,81 @@ void Awareness::buildEntityAreas(const EntityEntry& entity, std::map<const Entit
 
 void Awareness::findEntityAreas(const WFMath::AxisBox<2>& extent, std::vector<WFMath::RotBox<2> >& areas)
 {
-    for (auto& entry : mEntityAreas) {
-        auto& rotbox = entry.second;
+    int tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex;
+    findAffectedTiles(extent, tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex);
+
+    //Areas spanning more than one tile are found in each of them.
+    std::vector<const EntityEntry*> entities;
+    for (int tx = tileMinXIndex; tx <= tileMaxXIndex; ++tx) {
+        auto I = mEntityAreaTiles.lower_bound(std::make_pair(tx, tileMinYIndex));
+        for (; I != mEntityAreaTiles.end() && I->first.first == tx && I->first.second <= tileMaxYIndex; ++I) {
+            entities.insert(entities.end(), I->second.begin(), I->second.end());
+        }
+    }
+    std::sort(entities.begin(), entities.end());
+    entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+
+    for (auto entity : entities) {
+        auto& rotbox = mEntityAreas.find(entity)->second;
         if (WFMath::Contains(extent, rotbox, false) || WFMath::Intersect(extent, rotbox, false)) {
             areas.push_back(rotbox);
         }
     }
 }
 
-int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityAreas, const int tx, const int ty, TileCacheData* tiles, const int maxTiles)
+void Awareness::setEntityArea(const EntityEntry& entity, const WFMath::RotBox<2>& area)
 {
-    std::vector<float> vertsVector;
-    std::vector<int> trisVector;
+    removeEntityArea(entity);
+    mEntityAreas.insert(std::make_pair(&entity, area));
 
-    FastLZCompressor comp;
-    RasterizationContext rc;
+    int tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex;
+    findAffectedTiles(area.boundingBox(), tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex);
+    for (int tx = tileMinXIndex; tx <= tileMaxXIndex; ++tx) {
+        for (int ty = tileMinYIndex; ty <= tileMaxYIndex; ++ty) {
+            mEntityAreaTiles[std::make_pair(tx, ty)].push_back(&entity);
+        }
+    }
+}
+
+bool Awareness::removeEntityArea(const EntityEntry& entity)
+{
+    auto I = mEntityAreas.find(&entity);
+    if (I == mEntityAreas.end()) {
+        return false;
+    }
+
+    //The tiles are found the same way as when the area was set, since the config never changes.
+    int tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex;
+    findAffectedTiles(I->second.boundingBox(), tileMinXIndex, tileMaxXIndex, tileMinYIndex, tileMaxYIndex);
+    for (int tx = tileMinXIndex; tx <= tileMaxXIndex; ++tx) {
+        for (int ty = tileMinYIndex; ty <= tileMaxYIndex; ++ty) {
+            auto J = mEntityAreaTiles.find(std::make_pair(tx, ty));
+            if (J != mEntityAreaTiles.end()) {
+                auto& entities = J->second;
+                auto K = std::find(entities.begin(), entities.end(), &entity);
+                if (K != entities.end()) {
+                    *K = entities.back();
+                    entities.pop_back();
+                }
+                if (entities.empty()) {
+                    mEntityAreaTiles.erase(J);
+                }
+            }
+        }
+    }
+    mEntityAreas.erase(I);
+    return true;
+}
+
+void Awareness::prepareTile(int tx, int ty, TileBuildInput& input)
+{
+    input.tx = tx;
+    input.ty = ty;
 
 // Tile bounds.
     const float tcs = mCfg.tileSize * mCfg.cs;
 
-    rcConfig tcfg;
+    rcConfig& tcfg = input.cfg;
     memcpy(&tcfg, &mCfg, sizeof(tcfg));
 
     tcfg.bmin[0] = mCfg.bmin[0] + tx * tcs;
@@ -1069,19 +1850,109 @@ int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityA
     tcfg.bmax[0] += tcfg.borderSize * tcfg.cs;
     tcfg.bmax[2] += tcfg.borderSize * tcfg.cs;
 
-//First define all vertices. Get one extra vertex in each direction so that there's no cutoff at the tile's edges.
-    int heightsXMin = std::floor(tcfg.bmin[0]) - 1;
-    int heightsXMax = std::ceil(tcfg.bmax[0]) + 1;
-    int heightsYMin = std::floor(tcfg.bmin[2]) - 1;
-    int heightsYMax = std::ceil(tcfg.bmax[2]) + 1;
-    int sizeX = heightsXMax - heightsXMin;
-    int sizeY = heightsYMax - heightsYMin;
+    WFMath::AxisBox<2> tileArea(WFMath::Point<2>(mCfg.bmin[0] + (tx * tcs), mCfg.bmin[2] + (ty * tcs)),
+            WFMath::Point<2>(mCfg.bmin[0] + ((tx + 1) * tcs), mCfg.bmin[2] + ((ty + 1) * tcs)));
+    findEntityAreas(tileArea, input.entityAreas);
+
+//Get one extra vertex in each direction so that there's no cutoff at the tile's edges.
+    input.heightsXMin = std::floor(tcfg.bmin[0]) - 1;
+    input.heightsXMax = std::ceil(tcfg.bmax[0]) + 1;
+    input.heightsYMin = std::floor(tcfg.bmin[2]) - 1;
+    input.heightsYMax = std::ceil(tcfg.bmax[2]) + 1;
+    int sizeX = input.heightsXMax - input.heightsXMin;
+    int sizeY = input.heightsYMax - input.heightsYMin;
 
 //Blit height values with 1 meter interval
-    std::vector<float> heights(sizeX * sizeY);
-    mHeightProvider.blitHeights(heightsXMin, heightsXMax, heightsYMin, heightsYMax, heights);
+    input.heights.resize(sizeX * sizeY);
+    mHeightProvider.blitHeights(input.heightsXMin, input.heightsXMax, input.heightsYMin, input.heightsYMax, input.heights);
+}
+
+/**
+ * @brief Hashes everything which goes into building a tile, for use as its key in the disk cache.
+ *
+ * The hash is 64 bit FNV-1a. The check value is 64 bit FNV-1, which multiplies before rather than after combining
+ * each byte, so inputs whose hashes collide are still told apart.
+ *
+ * Increase TILE_INPUT_VERSION whenever the way tiles are built changes, so that old entries aren't used.
+ */
+static TileDiskCache::Key hashTileInput(const TileBuildInput& input)
+{
+    static const std::uint32_t TILE_INPUT_VERSION = 1;
+
+    auto add = [](TileDiskCache::Key key, const void* data, size_t size) {
+        auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            key.hash ^= bytes[i];
+            key.hash *= 1099511628211ULL;
+            key.check *= 1099511628211ULL;
+            key.check ^= bytes[i];
+        }
+        return key;
+    };
+    const TileDiskCache::Key offsetBasis{14695981039346656037ULL, 14695981039346656037ULL};
+
+    TileDiskCache::Key key = add(offsetBasis, &TILE_INPUT_VERSION, sizeof(TILE_INPUT_VERSION));
+    key = add(key, &input.tx, sizeof(input.tx));
+    key = add(key, &input.ty, sizeof(input.ty));
+    key = add(key, &input.cfg, sizeof(input.cfg));
+    int heightBounds[] = { input.heightsXMin, input.heightsXMax, input.heightsYMin, input.heightsYMax };
+    key = add(key, heightBounds, sizeof(heightBounds));
+    key = add(key, input.heights.data(), input.heights.size() * sizeof(float));
+
+    //The areas come in the order of the entity entries in memory, which differs between runs, so they are combined in an order independent way.
+    TileDiskCache::Key areasKey{input.entityAreas.size(), input.entityAreas.size()};
+    for (auto& area : input.entityAreas) {
+        float values[] = { (float)area.corner0().x(), (float)area.corner0().y(), (float)area.size().x(), (float)area.size().y(),
+                (float)area.orientation().elem(0, 0), (float)area.orientation().elem(0, 1), (float)area.orientation().elem(1, 0), (float)area.orientation().elem(1, 1) };
+        TileDiskCache::Key areaKey = add(offsetBasis, values, sizeof(values));
+        areasKey.hash += areaKey.hash;
+        areasKey.check += areaKey.check;
+    }
+    return add(key, &areasKey, sizeof(areasKey));
+}
+
+int Awareness::buildTileLayers(rcContext& ctx, TileDiskCache* tileDiskCache, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles, bool& fromCache)
+{
+    fromCache = false;
+    if (!tileDiskCache) {
+        return rasterizeTileLayers(ctx, input, tiles, maxTiles);
+    }
+
+    TileDiskCache::Key key = hashTileInput(input);
+    int ntiles = tileDiskCache->load(key, tiles, maxTiles);
+    if (ntiles >= 0) {
+        fromCache = true;
+        return ntiles;
+    }
+
+    ntiles = rasterizeTileLayers(ctx, input, tiles, maxTiles);
+    //Tiles without any layers are most likely the result of errors, which shouldn't be made permanent.
+    if (ntiles > 0) {
+        tileDiskCache->store(key, tiles, ntiles);
+    }
+    return ntiles;
+}
+
+int Awareness::rasterizeTileLayers(rcContext& ctx, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles)
+{
+    std::vector<float> vertsVector;
+    std::vector<int> trisVector;
+
+    FastLZCompressor comp;
+    RasterizationContext rc;
+
+    const rcConfig& tcfg = input.cfg;
+    const int tx = input.tx;
+    const int ty = input.ty;
+    const int heightsXMin = input.heightsXMin;
+    const int heightsXMax = input.heightsXMax;
+    const int heightsYMin = input.heightsYMin;
+    const int heightsYMax = input.heightsYMax;
+    int sizeX = heightsXMax - heightsXMin;
+    int sizeY = heightsYMax - heightsYMin;
 
-    float* heightData = heights.data();
+//First define all vertices.
+    const float* heightData = input.heights.data();
     for (int y = heightsYMin; y < heightsYMax; ++y) {
         for (int x = heightsXMin; x < heightsXMax; ++x) {
             vertsVector.push_back(x);
@@ -1114,25 +1985,25 @@ int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityA
 // Allocate voxel heightfield where we rasterize our input data to.
     rc.solid = rcAllocHeightfield();
     if (!rc.solid) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Out of memory 'solid'.");
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Out of memory 'solid'.");
         return 0;
     }
-    if (!rcCreateHeightfield(mCtx, *rc.solid, tcfg.width, tcfg.height, tcfg.bmin, tcfg.bmax, tcfg.cs, tcfg.ch)) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Could not create solid heightfield.");
+    if (!rcCreateHeightfield(&ctx, *rc.solid, tcfg.width, tcfg.height, tcfg.bmin, tcfg.bmax, tcfg.cs, tcfg.ch)) {
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Could not create solid heightfield.");
         return 0;
     }
 
 // Allocate array that can hold triangle flags.
     rc.triareas = new unsigned char[ntris];
     if (!rc.triareas) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Out of memory 'm_triareas' (%d).", ntris / 3);
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Out of memory 'm_triareas' (%d).", ntris / 3);
         return 0;
     }
 
     memset(rc.triareas, 0, ntris * sizeof(unsigned char));
-    rcMarkWalkableTriangles(mCtx, tcfg.walkableSlopeAngle, verts, nverts, tris, ntris, rc.triareas);
+    rcMarkWalkableTriangles(&ctx, tcfg.walkableSlopeAngle, verts, nverts, tris, ntris, rc.triareas);
 
-    rcRasterizeTriangles(mCtx, verts, nverts, tris, rc.triareas, ntris, *rc.solid, tcfg.walkableClimb);
+    rcRasterizeTriangles(&ctx, verts, nverts, tris, rc.triareas, ntris, *rc.solid, tcfg.walkableClimb);
 
 // Once all geometry is rasterized, we do initial pass of filtering to
 // remove unwanted overhangs caused by the conservative rasterization
@@ -1146,22 +2017,22 @@ int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityA
 
     rc.chf = rcAllocCompactHeightfield();
     if (!rc.chf) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Out of memory 'chf'.");
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Out of memory 'chf'.");
         return 0;
     }
-    if (!rcBuildCompactHeightfield(mCtx, tcfg.walkableHeight, tcfg.walkableClimb, *rc.solid, *rc.chf)) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Could not build compact data.");
+    if (!rcBuildCompactHeightfield(&ctx, tcfg.walkableHeight, tcfg.walkableClimb, *rc.solid, *rc.chf)) {
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Could not build compact data.");
         return 0;
     }
 
 // Erode the walkable area by agent radius.
-    if (!rcErodeWalkableArea(mCtx, tcfg.walkableRadius, *rc.chf)) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Could not erode.");
+    if (!rcErodeWalkableArea(&ctx, tcfg.walkableRadius, *rc.chf)) {
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Could not erode.");
         return 0;
     }
 
 // Mark areas.
-    for (auto& rotbox : entityAreas) {
+    for (auto& rotbox : input.entityAreas) {
         float verts[3 * 4];
 
         verts[0] = rotbox.getCorner(1).x();
@@ -1180,16 +2051,16 @@ int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityA
         verts[10] = 0;
         verts[11] = rotbox.getCorner(0).y();
 
-        rcMarkConvexPolyArea(mCtx, verts, 4, tcfg.bmin[1], tcfg.bmax[1], DT_TILECACHE_NULL_AREA, *rc.chf);
+        rcMarkConvexPolyArea(&ctx, verts, 4, tcfg.bmin[1], tcfg.bmax[1], DT_TILECACHE_NULL_AREA, *rc.chf);
     }
 
     rc.lset = rcAllocHeightfieldLayerSet();
     if (!rc.lset) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Out of memory 'lset'.");
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Out of memory 'lset'.");
         return 0;
     }
-    if (!rcBuildHeightfieldLayers(mCtx, *rc.chf, tcfg.borderSize, tcfg.walkableHeight, *rc.lset)) {
-        mCtx->log(RC_LOG_ERROR, "buildNavigation: Could not build heighfield layers.");
+    if (!rcBuildHeightfieldLayers(&ctx, *rc.chf, tcfg.borderSize, tcfg.walkableHeight, *rc.lset)) {
+        ctx.log(RC_LOG_ERROR, "buildNavigation: Could not build heighfield layers.");
         return 0;
     }
 
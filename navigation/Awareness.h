@@ -37,6 +37,10 @@
 #include <map>
 #include <unordered_map>
 #include <functional>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 class MemEntity;
 class LocatedEntity;
@@ -53,12 +57,18 @@ class dtObstacleAvoidanceQuery;
 struct dtObstacleAvoidanceParams;
 
 class IHeightProvider;
+class TileBuildPool;
+class TileDiskCache;
 
 template <typename T>
 class MRUList;
 
 struct TileCacheData;
 struct InputGeometry;
+struct TileBuildInput;
+struct ActivePathSearch;
+struct PathCorridorCache;
+struct TileBuildResults;
 
 enum PolyAreas
 {
@@ -118,19 +128,110 @@ struct EntityEntry {
  */
 class Awareness
 {
+	friend struct ActivePathSearch;
 public:
 	/**
 	 * A callback function for processing tiles.
 	 */
 	typedef std::function<void(unsigned int, dtTileCachePolyMesh&, float* origin, float cellsize, float cellheight, dtTileCacheLayer& layer)> TileProcessor;
 
+	/**
+	 * @brief Statistics for the building of tiles in all awarenesses.
+	 */
+	struct TileBuildStatistics
+	{
+		/**
+		 * @brief The number of tiles queued for, or being built on, the worker threads.
+		 */
+		int queued = 0;
+		int built = 0;
+		/**
+		 * @brief The total time spent rasterizing tiles, in milliseconds.
+		 */
+		int buildMilliseconds = 0;
+		/**
+		 * @brief The total time from tiles being queued until they were added to the navmesh, in milliseconds.
+		 */
+		int latencyMilliseconds = 0;
+		/**
+		 * @brief The number of built tiles which were loaded from the disk cache instead of being rasterized.
+		 */
+		int cacheHits = 0;
+	};
+
+	static TileBuildStatistics s_tileBuildStatistics;
+
+	/**
+	 * @brief Statistics for the path requests of all awarenesses.
+	 */
+	struct PathStatistics
+	{
+		/**
+		 * @brief The number of requests waiting for, or being searched for, a path.
+		 */
+		int queued = 0;
+		int completed = 0;
+		/**
+		 * @brief The number of requests which could reuse a recently found polygon corridor.
+		 */
+		int cacheHits = 0;
+		/**
+		 * @brief Percentiles of the time from recent requests being made until their paths were delivered, in milliseconds.
+		 */
+		int latencyP50Milliseconds = 0;
+		int latencyP90Milliseconds = 0;
+		int latencyP99Milliseconds = 0;
+	};
+
+	static PathStatistics s_pathStatistics;
+
+	/**
+	 * @brief Statistics for the crowd avoidance passes of all awarenesses.
+	 */
+	struct CrowdStatistics
+	{
+		/**
+		 * @brief The number of agents in the last pass.
+		 */
+		int agents = 0;
+		/**
+		 * @brief The time spent on the last pass, in microseconds.
+		 */
+		int passMicroseconds = 0;
+	};
+
+	static CrowdStatistics s_crowdStatistics;
+
+	/**
+	 * @brief An agent taking part in crowd avoidance.
+	 */
+	struct CrowdAgent
+	{
+		WFMath::Point<2> position;
+		WFMath::Vector<2> desiredVelocity;
+		/**
+		 * @brief The velocity found in the last pass; only valid if avoiding is true.
+		 */
+		WFMath::Vector<2> newVelocity;
+		bool avoiding = false;
+	};
+
+	/**
+	 * @brief Called with the result of a path request.
+	 *
+	 * The arguments are the same as the return value and path of findPath().
+	 */
+	typedef std::function<void(int, std::list<WFMath::Point<3>>&)> PathCallback;
+
 	/**
 	 * @brief Ctor.
 	 * @param domainEntity The entity holding the domain of the awareness.
 	 * @param heightProvider A height provider, used for getting terrain height data.
 	 * @param tileSize The size, in voxels, of one side of a tile. The larger this is the longer each tile takes to generate, but the overhead of managing tiles is decreased.
+	 * @param tileBuildPool An optional pool of threads on which tiles are rasterized. If none is supplied tiles are built on the calling thread.
+	 * @param tileDiskCache An optional cache of built tiles, which is checked before any tile is rasterized.
 	 */
-	Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize = 64);
+	Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize = 64, TileBuildPool* tileBuildPool = nullptr, TileDiskCache* tileDiskCache = nullptr);
 	virtual ~Awareness();
 
 	/**
@@ -148,12 +249,23 @@ public:
 
 	/**
 	 * @brief Rebuilds a dirty tile if any such exists.
-	 * @return The number of dirty tiles remaining.
+	 *
+	 * The dirty tile closest to any of the agents which have set an awareness area is
+	 * picked first. If there's a tile build pool, tiles are instead handed to it a few
+	 * at a time, and tiles it has finished are added to the navmesh.
+	 * @return The number of dirty tiles remaining, including those being built.
 	 */
 	size_t rebuildDirtyTile();
 
+	/**
+	 * @brief Returns the number of tiles being built on the tile build pool.
+	 */
+	size_t tilesInProgress() const;
+
 	/**
 	 * @brief Finds a path from the start to the finish.
+	 *
+	 * This is safe to call from any thread.
 	 * @param start A starting position.
 	 * @param end A finish position.
 	 * @param radius The radius of the horizontal search area (kinda; it's not a circle but an axis aligned box)
@@ -162,6 +274,42 @@ public:
 	 */
 	int findPath(const WFMath::Point<3>& start, const WFMath::Point<3>& end, float radius, std::list<WFMath::Point<3>>& path) const;
 
+	/**
+	 * @brief Queues a request for a path from the start to the finish.
+	 *
+	 * The search is done in slices by processPathRequests(), so that many agents replanning at
+	 * once don't stall the client. Requests are handled in the order they were made.
+	 * @param start A starting position.
+	 * @param end A finish position.
+	 * @param radius The radius of the horizontal search area, as in findPath().
+	 * @param callback Called from processPathRequests() with the result. It's never called if the request is cancelled.
+	 * @return An id for the request, which can be used to cancel it. Never 0.
+	 */
+	long requestPath(const WFMath::Point<3>& start, const WFMath::Point<3>& end, float radius, PathCallback callback);
+
+	/**
+	 * @brief Cancels a path request.
+	 *
+	 * Requests must be cancelled by anyone who goes away before their callback has been called.
+	 * @param requestId The id of a request; unknown or completed ids are ignored.
+	 */
+	void cancelPathRequest(long requestId);
+
+	/**
+	 * @brief Searches for the paths of queued requests, calling the callbacks of those which are completed.
+	 * @param maxIterations The maximum number of Detour search iterations to do in this call.
+	 * @param currentTimestamp The current timestamp.
+	 * @param minInterval Nothing is done if there was a search less than this many seconds ago, so that all agents sharing the awareness can call this
+	 * and still only spend one budget of iterations.
+	 * @return True if requests were searched for.
+	 */
+	bool processPathRequests(int maxIterations, double currentTimestamp, double minInterval);
+
+	/**
+	 * @brief Gets the number of path requests which haven't been completed.
+	 */
+	size_t pendingPathRequests() const;
+
 	/**
 	 * @brief Process the tile at the specified index.
 	 * @param tx X index.
@@ -194,6 +342,46 @@ public:
 	 */
 	bool avoidObstacles(long avatarEntityId, const WFMath::Point<2>& position, const WFMath::Vector<2>& desiredVelocity, WFMath::Vector<2>& newVelocity, double currentTimestamp) const;
 
+	/**
+	 * @brief Adds an agent to crowd avoidance, or updates it if it's already added.
+	 *
+	 * Instead of each agent calling avoidObstacles(), which scans all moving entities, the agents
+	 * report where they want to go and read the result of the last pass done by updateCrowd().
+	 * @param avatarEntityId The entity id of the avatar.
+	 * @param position The position of the avatar.
+	 * @param desiredVelocity The desired velocity.
+	 */
+	void setCrowdAgent(long avatarEntityId, const WFMath::Point<2>& position, const WFMath::Vector<2>& desiredVelocity);
+
+	/**
+	 * @brief Removes an agent from crowd avoidance.
+	 *
+	 * Agents must be removed when they stop steering.
+	 * @param avatarEntityId The entity id of the avatar.
+	 */
+	void removeCrowdAgent(long avatarEntityId);
+
+	/**
+	 * @brief Calculates avoidance velocities for all crowd agents in one pass.
+	 *
+	 * Moving entities are bucketed in a grid, so that each agent only looks at those near it. If
+	 * there's a tile build pool the agents are split among its threads and the calling thread.
+	 * @param currentTimestamp The current timestamp. Used to determine positions of moving entities.
+	 * @param minInterval Nothing is done if there was a pass less than this many seconds ago, so that all agents sharing the awareness can call this.
+	 * @return True if a pass was done.
+	 */
+	bool updateCrowd(double currentTimestamp, double minInterval);
+
+	/**
+	 * @brief Gets the result of the last crowd avoidance pass for an agent.
+	 * @param avatarEntityId The entity id of the avatar.
+	 * @param newVelocity The calculated new velocity.
+	 * @return True if the velocity had to be changed in order to avoid obstacles.
+	 */
+	bool getCrowdAvoidance(long avatarEntityId, WFMath::Vector<2>& newVelocity) const;
+
+	size_t crowdAgentCount() const;
+
 	/**
 	 * @brief Prunes a tile if possible and needed.
 	 *
@@ -287,6 +475,30 @@ protected:
 	 */
     const LocatedEntity& mDomainEntity;
 
+	/**
+	 * @brief Pool on which tiles are rasterized, or null if tiles are built synchronously.
+	 */
+	TileBuildPool* mTileBuildPool;
+
+	/**
+	 * @brief Cache of built tiles kept between restarts, or null if not used.
+	 */
+	TileDiskCache* mTileDiskCache;
+
+	/**
+	 * @brief Tiles built by the pool, waiting to be added to the navmesh.
+	 *
+	 * This is shared with the jobs, since they might outlive this instance.
+	 */
+	std::shared_ptr<TileBuildResults> mBuildResults;
+
+	/**
+	 * @brief Tiles which are being built by the pool.
+	 *
+	 * These aren't in the dirty sets, but a tile can't be rebuilt until it's done.
+	 */
+	std::set<std::pair<int, int>> mTilesInProgress;
+
 	struct LinearAllocator* mTalloc;
 	struct FastLZCompressor* mTcomp;
 	struct MeshProcess* mTmproc;
@@ -337,10 +549,73 @@ protected:
 	 */
 	dtNavMesh* mNavMesh;
 	dtNavMeshQuery* mNavQuery;
+
+	/**
+	 * @brief A query object used only for the sliced searches of path requests.
+	 *
+	 * A sliced search keeps its state in the query object, so it can't share one with findPath().
+	 */
+	dtNavMeshQuery* mSlicedNavQuery;
+
+	/**
+	 * @brief Guards the tile cache, the navmesh and the query objects.
+	 *
+	 * Path queries may be run without the Python GIL, and thus concurrently with
+	 * tiles being rebuilt or pruned, or with other path queries.
+	 */
+	mutable std::mutex mNavMeshMutex;
+
+	/**
+	 * @brief A queued path request.
+	 */
+	struct PathRequest
+	{
+		long id;
+		WFMath::Point<3> start;
+		WFMath::Point<3> end;
+		float radius;
+		PathCallback callback;
+		std::chrono::steady_clock::time_point queuedTime;
+	};
+
+	/**
+	 * @brief Requests waiting for their search to be started.
+	 */
+	std::deque<PathRequest> mPathRequests;
+
+	/**
+	 * @brief The request currently being searched for, if any.
+	 */
+	std::unique_ptr<ActivePathSearch> mActivePathSearch;
+
+	/**
+	 * @brief The timestamp of the last call to processPathRequests() which searched for paths.
+	 */
+	double mPathSearchTimestamp;
+
+	/**
+	 * @brief Recently found polygon corridors, keyed by their start and end polygons.
+	 *
+	 * This is cleared whenever the navmesh changes.
+	 */
+	std::unique_ptr<PathCorridorCache> mPathCorridorCache;
+
+	long mNextPathRequestId;
+
 	dtQueryFilter* mFilter;
 	dtObstacleAvoidanceQuery* mObstacleAvoidanceQuery;
 	dtObstacleAvoidanceParams* mObstacleAvoidanceParams;
 
+	/**
+	 * @brief The agents taking part in crowd avoidance, keyed by their entity ids.
+	 */
+	std::map<long, CrowdAgent> mCrowdAgents;
+
+	/**
+	 * @brief The timestamp of the last crowd avoidance pass.
+	 */
+	double mCrowdTimestamp;
+
 	/**
 	 * @brief A map of all of the tiles that currently are inside our awareness area.
 	 * The value corresponds to the number of observers for the specific tile.
@@ -379,6 +654,14 @@ protected:
 	 */
 	std::map<const EntityEntry*, WFMath::RotBox<2>> mEntityAreas;
 
+	/**
+	 * @brief The entities in mEntityAreas, bucketed by the index of each tile their areas touch.
+	 *
+	 * This lets a tile be rebuilt by only looking at the areas near it. Always use setEntityArea()
+	 * and removeEntityArea() to alter mEntityAreas, so that this is kept in sync.
+	 */
+	std::map<std::pair<int, int>, std::vector<const EntityEntry*>> mEntityAreaTiles;
+
 	/**
 	 * @brief Keeps track of all currently observed entities.
 	 */
@@ -401,6 +684,13 @@ protected:
 	 */
 	std::unordered_map<std::string, std::set<std::pair<int, int>>> mAwareAreas;
 
+	/**
+	 * @brief The position of the agent of each awareness area.
+	 *
+	 * Dirty tiles closest to these are built first.
+	 */
+	std::unordered_map<std::string, WFMath::Point<2>> mAwareAreaAgents;
+
 	/**
 	 * @brief A Most Recently Used list of active tiles.
 	 *
@@ -422,9 +712,63 @@ protected:
 	 * @brief Rebuild the tile at the specific index.
 	 * @param tx X index.
 	 * @param ty Y index.
-	 * @param entityAreas A list of entities, projected as 2d rotation boxes, which affects the tile.
 	 */
-	void rebuildTile(int tx, int ty, const std::vector<WFMath::RotBox<2>>& entityAreas);
+	void rebuildTile(int tx, int ty);
+
+	/**
+	 * @brief Gathers everything needed for rasterizing a tile.
+	 *
+	 * This must be done on the main thread, as the height provider and entities are accessed.
+	 * @param tx X index.
+	 * @param ty Y index.
+	 * @param input Out parameter for the input.
+	 */
+	void prepareTile(int tx, int ty, TileBuildInput& input);
+
+	/**
+	 * @brief Adds rasterized tile layers to the tile cache and the navmesh.
+	 * @param tx X index.
+	 * @param ty Y index.
+	 * @param tiles The tile layers. Ownership of the data is transferred.
+	 * @param ntiles The number of tile layers.
+	 */
+	void addTileLayers(int tx, int ty, TileCacheData* tiles, int ntiles);
+
+	/**
+	 * @brief Finds the dirty tile which should be built next.
+	 * @return An iterator into mDirtyAwareOrderedTiles, which is end() if there's no tile that can be built.
+	 */
+	std::list<std::pair<int, int>>::iterator findNextDirtyTile();
+
+	/**
+	 * @brief Adds tiles built by the pool to the navmesh.
+	 */
+	void collectBuiltTiles();
+
+	/**
+	 * @brief Finds the end polygons of a path search, and either starts a sliced search or completes it at once.
+	 *
+	 * Must be called with mNavMeshMutex held.
+	 * @param search The search.
+	 * @return True if the search was completed, either because it failed or because a cached corridor was used.
+	 */
+	bool beginPathSearch(ActivePathSearch& search);
+
+	/**
+	 * @brief Completes a sliced path search which is no longer in progress.
+	 *
+	 * Must be called with mNavMeshMutex held.
+	 * @param search The search.
+	 */
+	void finishPathSearch(ActivePathSearch& search);
+
+	/**
+	 * @brief Creates the waypoints of a path search from its polygon corridor.
+	 *
+	 * Must be called with mNavMeshMutex held.
+	 * @param search The search.
+	 */
+	void straightenPath(ActivePathSearch& search);
 
 	/**
 	 * @brief Calculates the 2d rotbox area of the entity and adds it to the supplied map of areas.
@@ -441,15 +785,44 @@ protected:
 	void findEntityAreas(const WFMath::AxisBox<2>& extent, std::vector<WFMath::RotBox<2> >& areas);
 
 	/**
-	 * @brief Rasterizes the tile at the specified index.
-	 * @param entityAreas The entity areas that affects the tile.
-	 * @param tx X index.
-	 * @param ty Y index.
+	 * @brief Sets the area of an entity, replacing any existing area.
+	 * @param entity An entity.
+	 * @param area The area of the entity.
+	 */
+	void setEntityArea(const EntityEntry& entity, const WFMath::RotBox<2>& area);
+
+	/**
+	 * @brief Removes the area of an entity.
+	 * @param entity An entity.
+	 * @return True if the entity had an area.
+	 */
+	bool removeEntityArea(const EntityEntry& entity);
+
+	/**
+	 * @brief Rasterizes a tile.
+	 *
+	 * This doesn't touch any shared state, and can be called from any thread.
+	 * @param ctx A Recast context, which must not be used by other threads.
+	 * @param input The input prepared by prepareTile().
+	 * @param tiles Out parameter for the tiles.
+	 * @param maxTiles The maximum number of tile layers to create.
+	 * @return The number of tile layers that were created.
+	 */
+	static int rasterizeTileLayers(rcContext& ctx, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles);
+
+	/**
+	 * @brief Gets the layers of a tile from the disk cache, or rasterizes them and stores them in the cache.
+	 *
+	 * Like rasterizeTileLayers() this can be called from any thread.
+	 * @param ctx A Recast context, which must not be used by other threads.
+	 * @param tileDiskCache A disk cache, or null.
+	 * @param input The input prepared by prepareTile().
 	 * @param tiles Out parameter for the tiles.
 	 * @param maxTiles The maximum number of tile layers to create.
+	 * @param fromCache Set to true if the layers were loaded from the cache.
 	 * @return The number of tile layers that were created.
 	 */
-	int rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityAreas, const int tx, const int ty, TileCacheData* tiles, const int maxTiles);
+	static int buildTileLayers(rcContext& ctx, TileDiskCache* tileDiskCache, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles, bool& fromCache);
 
 	/**
 	 * @brief Applies the supplied processor on the supplied tiles.
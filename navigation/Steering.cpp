@@ -44,6 +44,8 @@ Steering::Steering(MemEntity& avatar) :
         mDesiredSpeed(0.5),
         mExpectingServerMovement(false),
         mPathResult(0),
+        mPathRequestId(0),
+        mCrowdAvoidance(false),
         mAvatarHorizRadius(0.4)
 {
     auto speedGroundProp = avatar.getPropertyType<double>("speed-ground");
@@ -53,6 +55,12 @@ Steering::Steering(MemEntity& avatar) :
 
 }
 
+Steering::~Steering()
+{
+    cancelPathRequest();
+    leaveCrowd();
+}
+
 void Steering::setAwareness(Awareness* awareness)
 {
     auto& bbox = mAvatar.m_location.bBox();
@@ -63,6 +71,8 @@ void Steering::setAwareness(Awareness* awareness)
                                   square(bbox.highCorner().z()));
         mAvatarHorizRadius = std::sqrt(squareHorizRadius);
     }
+    cancelPathRequest();
+    leaveCrowd();
     mAwareness = awareness;
     mTileListenerConnection.disconnect();
     if (mAwareness) {
@@ -101,6 +111,8 @@ void Steering::setDestination(int entityId, const WFMath::Point<3>& entityRelati
             mViewDestination = finalPosition;
             mDestinationRadius = finalRadius;
             mUpdateNeeded = true;
+            //Any pending path leads to the old destination.
+            cancelPathRequest();
 
             setAwarenessArea();
             mAvatarPositionLastUpdate = currentAvatarPos;
@@ -165,6 +177,47 @@ void Steering::updateDestination(double currentServerTimestamp, int entityId, WF
 
 int Steering::updatePath(const WFMath::Point<3>& currentAvatarPosition)
 {
+    PathQuery query;
+    int result = preparePathQuery(currentAvatarPosition, query);
+    if (result != 0) {
+        return result;
+    }
+    std::list<WFMath::Point<3>> path;
+    result = runPathQuery(query, path);
+    return applyPathQuery(result, path);
+}
+
+int Steering::updatePath(double currentTimestamp)
+{
+    PathQuery query;
+    int result = preparePathQuery(currentTimestamp, query);
+    if (result != 0) {
+        return result;
+    }
+    std::list<WFMath::Point<3>> path;
+    result = runPathQuery(query, path);
+    return applyPathQuery(result, path);
+}
+
+int Steering::preparePathQuery(double currentTimestamp, PathQuery& query)
+{
+    if (!mAwareness) {
+        return -1;
+    }
+    auto currentEntityPos = mAvatar.m_location.m_pos;
+    if (mAvatar.m_location.m_velocity.isValid()) {
+        currentEntityPos += (mAvatar.m_location.m_velocity * (currentTimestamp - mAvatar.m_location.timeStamp()));
+    }
+
+    updateDestination(currentTimestamp, mDestinationEntityId, mViewDestination);
+
+    return preparePathQuery(currentEntityPos, query);
+}
+
+int Steering::preparePathQuery(const WFMath::Point<3>& currentAvatarPosition, PathQuery& query)
+{
+    //The path is found right away, so any queued request would just overwrite it later.
+    cancelPathRequest();
     mPath.clear();
     if (!mAwareness) {
         mPathResult = -7;
@@ -174,26 +227,59 @@ int Steering::updatePath(const WFMath::Point<3>& currentAvatarPosition)
         mPathResult = -8;
         return mPathResult;
     }
-    mPathResult = mAwareness->findPath(currentAvatarPosition, mViewDestination, mDestinationRadius, mPath);
+    query.awareness = mAwareness;
+    query.start = currentAvatarPosition;
+    query.destination = mViewDestination;
+    query.radius = mDestinationRadius;
+    return 0;
+}
+
+int Steering::runPathQuery(const PathQuery& query, std::list<WFMath::Point<3>>& path)
+{
+    return query.awareness->findPath(query.start, query.destination, query.radius, path);
+}
+
+int Steering::applyPathQuery(int result, std::list<WFMath::Point<3>>& path)
+{
+    mPath = std::move(path);
+    mPathResult = result;
     //debug_print("Updating path, size of new path: " << result << ". Pos: " << currentAvatarPosition);
     EventPathUpdated();
     mUpdateNeeded = false;
     return mPathResult;
 }
 
-int Steering::updatePath(double currentTimestamp)
+void Steering::requestPathUpdate(const WFMath::Point<3>& currentAvatarPosition)
 {
-    if (!mAwareness) {
-        return -1;
+    if (mPathRequestId != 0) {
+        return;
     }
-    auto currentEntityPos = mAvatar.m_location.m_pos;
-    if (mAvatar.m_location.m_velocity.isValid()) {
-        currentEntityPos += (mAvatar.m_location.m_velocity * (currentTimestamp - mAvatar.m_location.timeStamp()));
+    if (!mViewDestination.isValid()) {
+        mPath.clear();
+        mPathResult = -8;
+        return;
     }
+    mPathRequestId = mAwareness->requestPath(currentAvatarPosition, mViewDestination, mDestinationRadius, [this](int result, std::list<WFMath::Point<3>>& path) {
+        mPathRequestId = 0;
+        applyPathQuery(result, path);
+    });
+}
 
-    updateDestination(currentTimestamp, mDestinationEntityId, mViewDestination);
+void Steering::cancelPathRequest()
+{
+    if (mPathRequestId != 0) {
+        if (mAwareness) {
+            mAwareness->cancelPathRequest(mPathRequestId);
+        }
+        mPathRequestId = 0;
+    }
+}
 
-    return updatePath(currentEntityPos);
+void Steering::leaveCrowd()
+{
+    if (mAwareness) {
+        mAwareness->removeCrowdAgent(mAvatar.getIntId());
+    }
 }
 
 void Steering::requestUpdate()
@@ -201,6 +287,14 @@ void Steering::requestUpdate()
     mUpdateNeeded = true;
 }
 
+void Steering::setCrowdAvoidance(bool enabled)
+{
+    if (!enabled) {
+        leaveCrowd();
+    }
+    mCrowdAvoidance = enabled;
+}
+
 void Steering::startSteering()
 {
     mSteeringEnabled = true;
@@ -215,6 +309,8 @@ void Steering::stopSteering()
     mSteeringEnabled = false;
     mExpectingServerMovement = false;
     mLastSentVelocity = WFMath::Vector<2>();
+    cancelPathRequest();
+    leaveCrowd();
 
     //reset path
     mPath = std::list<WFMath::Point<3>>();
@@ -233,6 +329,11 @@ const std::list<WFMath::Point<3>>& Steering::getPath() const
     return mPath;
 }
 
+bool Steering::hasPendingPathRequest() const
+{
+    return mPathRequestId != 0;
+}
+
 WFMath::Point<3> Steering::getCurrentAvatarPosition(double currentTimestamp)
 {
     auto currentEntityPos = mAvatar.m_location.m_pos;
@@ -251,7 +352,7 @@ SteeringResult Steering::update(double currentTimestamp)
 
         //if (mUpdateNeeded) {
             updateDestination(currentTimestamp, mDestinationEntityId, mViewDestination);
-            updatePath(currentEntityPos);
+            requestPathUpdate(currentEntityPos);
         //}
         if (!mPath.empty()) {
             const auto& finalDestination = mPath.back();
@@ -290,7 +391,14 @@ SteeringResult Steering::update(double currentTimestamp)
 
                 //Check if we need to divert in order to avoid colliding.
                 WFMath::Vector<2> newVelocity;
-                bool avoiding = mAwareness->avoidObstacles(mAvatar.getIntId(), entityPosition, velocity * mMaxSpeed, newVelocity, currentTimestamp);
+                bool avoiding;
+                if (mCrowdAvoidance) {
+                    //Use what was found in the last crowd pass, and tell the next one where we want to go.
+                    mAwareness->setCrowdAgent(mAvatar.getIntId(), entityPosition, velocity * mMaxSpeed);
+                    avoiding = mAwareness->getCrowdAvoidance(mAvatar.getIntId(), newVelocity);
+                } else {
+                    avoiding = mAwareness->avoidObstacles(mAvatar.getIntId(), entityPosition, velocity * mMaxSpeed, newVelocity, currentTimestamp);
+                }
                 if (avoiding) {
                     auto newMag = newVelocity.mag();
                     auto relativeMag = mMaxSpeed / newMag;
@@ -337,6 +445,7 @@ SteeringResult Steering::update(double currentTimestamp)
         } else {
             //We are steering, but the path is empty, which means we can't find any path. If we're moving we should stop movement.
             //But we won't stop steering; perhaps we'll find a path later.
+            leaveCrowd();
             if (mLastSentVelocity != WFMath::Vector<2>::ZERO()) {
                 result.direction = WFMath::Vector<3>::ZERO();
                 mLastSentVelocity = WFMath::Vector<2>::ZERO();
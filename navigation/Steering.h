@@ -70,10 +70,19 @@ class Steering: public virtual sigc::trackable
 {
 public:
 	explicit Steering(MemEntity& avatar);
-	virtual ~Steering() = default;
+	virtual ~Steering();
 
 	void setAwareness(Awareness* awareness);
 
+	/**
+	 * @brief Sets whether obstacles should be avoided through the crowd avoidance of the awareness.
+	 *
+	 * If so, the avoidance is calculated for all agents at once in Awareness::updateCrowd(), which
+	 * must be called regularly, and each update uses the result of the last such pass.
+	 * @param enabled True to use crowd avoidance.
+	 */
+	void setCrowdAvoidance(bool enabled);
+
 	/**
 	 * @brief Sets a new destination, in view position.
 	 * Note that this won't start steering; you need to call startSteering() separately.
@@ -95,6 +104,54 @@ public:
      */
     int updatePath(double currentTimestamp);
 
+	/**
+	 * @brief The data needed to find a path, copied out of the steering so the search can run without holding any locks.
+	 */
+	struct PathQuery
+	{
+		Awareness* awareness;
+		WFMath::Point<3> start;
+		WFMath::Point<3> destination;
+		float radius;
+	};
+
+	/**
+	 * @brief Prepares a path query from the current avatar position.
+	 *
+	 * Together with runPathQuery() and applyPathQuery() this splits updatePath() into steps, so that the search itself
+	 * can be done while the Python GIL is released.
+	 * @param currentTimestamp The current server time.
+	 * @param query Filled in with the query to run.
+	 * @return 0 if the query should be run, otherwise the result of the path update.
+	 */
+	int preparePathQuery(double currentTimestamp, PathQuery& query);
+
+	/**
+	 * @brief Prepares a path query from the supplied position.
+	 * @param currentAvatarPosition The current position of the avatar entity.
+	 * @param query Filled in with the query to run.
+	 * @return 0 if the query should be run, otherwise the result of the path update.
+	 */
+	int preparePathQuery(const WFMath::Point<3>& currentAvatarPosition, PathQuery& query);
+
+	/**
+	 * @brief Runs a prepared path query.
+	 *
+	 * This doesn't touch any steering state, and is safe to call from any thread.
+	 * @param query The prepared query.
+	 * @param path The resulting path.
+	 * @return The result of the path search.
+	 */
+	static int runPathQuery(const PathQuery& query, std::list<WFMath::Point<3>>& path);
+
+	/**
+	 * @brief Applies the result of a path query.
+	 * @param result The result returned by runPathQuery().
+	 * @param path The resulting path, which will be moved into the steering.
+	 * @return The path result.
+	 */
+	int applyPathQuery(int result, std::list<WFMath::Point<3>>& path);
+
     /**
 	 * @brief Requests an update of the path.
 	 *
@@ -131,6 +188,11 @@ public:
 	 */
 	const std::list<WFMath::Point<3>>& getPath() const;
 
+	/**
+	 * @brief Returns true if a path has been requested from the awareness, but hasn't been delivered yet.
+	 */
+	bool hasPendingPathRequest() const;
+
 	/**
 	 * @brief Returns true if we've just sent a movement update to the server and thus expect an update in return.
 	 *
@@ -148,7 +210,8 @@ public:
 	/**
 	 * @brief Updates the steering.
 	 *
-	 * Call this often when steering is enabled.
+	 * Call this often when steering is enabled. New paths are requested from the awareness, and the
+	 * current path is kept until the awareness delivers a new one in Awareness::processPathRequests().
 	 */
 	SteeringResult update(double currentTimestamp);
 
@@ -234,6 +297,16 @@ private:
 
 	int mPathResult;
 
+	/**
+	 * @brief The id of the path request waiting for a result from the awareness, or 0 if there's none.
+	 */
+	long mPathRequestId;
+
+	/**
+	 * @brief True if obstacles are avoided through the crowd avoidance of the awareness.
+	 */
+	bool mCrowdAvoidance;
+
 	/**
 	 * Horizontal radius of the avatar, i.e. radius using only x and y.
 	 * Used to determine how close the avatar should be to things.
@@ -261,6 +334,22 @@ private:
 	 */
 	void setAwarenessArea();
 
+	/**
+	 * @brief Requests a new path from the awareness, unless there already is a request waiting for a result.
+	 * @param currentAvatarPosition The current position of the avatar entity.
+	 */
+	void requestPathUpdate(const WFMath::Point<3>& currentAvatarPosition);
+
+	/**
+	 * @brief Cancels any path request waiting for a result.
+	 */
+	void cancelPathRequest();
+
+	/**
+	 * @brief Removes the avatar from the crowd avoidance of the awareness, if it's taking part in it.
+	 */
+	void leaveCrowd();
+
 	/**
 	 * @brief Listen to tiles being updated, and request updates.
 	 * @param tx
@@ -0,0 +1,70 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "TileBuildPool.h"
+
+TileBuildPool::TileBuildPool(unsigned int threadCount) :
+        mShutdown(false)
+{
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        mThreads.emplace_back([this]() {run();});
+    }
+}
+
+TileBuildPool::~TileBuildPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShutdown = true;
+    }
+    mCondition.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+void TileBuildPool::post(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJobs.push_back(std::move(job));
+    }
+    mCondition.notify_one();
+}
+
+unsigned int TileBuildPool::getThreadCount() const
+{
+    return mThreads.size();
+}
+
+void TileBuildPool::run()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() {return mShutdown || !mJobs.empty();});
+            if (mJobs.empty()) {
+                return;
+            }
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+        job();
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef TILEBUILDPOOL_H_
+#define TILEBUILDPOOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A pool of worker threads on which navmesh tiles are rasterized.
+ *
+ * Jobs are run in the order they are posted. Any prioritization is done by
+ * the code posting them, which should only post a few jobs at a time.
+ *
+ * Jobs must not touch any state which is used by the main thread without
+ * locking it. Any pending jobs are run before the pool is destroyed.
+ */
+class TileBuildPool
+{
+    public:
+        explicit TileBuildPool(unsigned int threadCount);
+
+        ~TileBuildPool();
+
+        /**
+         * @brief Queues a job to be run on one of the worker threads.
+         * @param job A job.
+         */
+        void post(std::function<void()> job);
+
+        unsigned int getThreadCount() const;
+
+    private:
+        std::vector<std::thread> mThreads;
+        std::deque<std::function<void()>> mJobs;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mShutdown;
+
+        void run();
+};
+
+#endif /* TILEBUILDPOOL_H_ */
@@ -0,0 +1,246 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "TileDiskCache.h"
+#include "Awareness.h"
+#include "AwarenessUtils.h"
+
+#include "common/log.h"
+#include "common/compose.hpp"
+
+#include "DetourAlloc.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+    const std::uint32_t ENTRY_MAGIC = 'W' << 24 | 'F' << 16 | 'N' << 8 | 'T';
+    const std::uint32_t ENTRY_VERSION = 2;
+
+    /**
+     * @brief Temporary files older than this, in seconds, were left behind by a process which crashed while storing.
+     */
+    const std::time_t TEMPORARY_MAX_AGE = 60 * 60;
+
+    /**
+     * @brief Guards against corrupt entries allocating absurd amounts of memory.
+     */
+    const std::int32_t MAX_LAYER_SIZE = 16 * 1024 * 1024;
+
+    template<typename T>
+    bool readValue(std::istream& stream, T& value)
+    {
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        return stream.good();
+    }
+
+    template<typename T>
+    void writeValue(std::ostream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+const std::uintmax_t TileDiskCache::DEFAULT_MAX_SIZE;
+
+TileDiskCache::TileDiskCache(std::string directory, std::uintmax_t maxSize) :
+        mDirectory(std::move(directory)), mDisabled(false), mTemporaryCounter(0), mMaxSize(maxSize), mStoredSincePrune(0)
+{
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(mDirectory, ec);
+    if (ec) {
+        log(WARNING, String::compose("Could not create navmesh cache directory \"%1\": %2. Navmesh tiles will not be cached.", mDirectory, ec.message()));
+        mDisabled = true;
+    }
+    prune();
+}
+
+const std::string& TileDiskCache::getDirectory() const
+{
+    return mDirectory;
+}
+
+std::string TileDiskCache::entryPath(const Key& key) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.tile", (unsigned long long)key.hash);
+    return mDirectory + "/" + name;
+}
+
+int TileDiskCache::load(const Key& key, TileCacheData* tiles, int maxTiles) const
+{
+    if (mDisabled) {
+        return -1;
+    }
+    std::string path = entryPath(key);
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) {
+        return -1;
+    }
+
+    std::uint32_t magic, version;
+    std::uint64_t storedHash, storedCheck;
+    std::int32_t ntiles;
+    if (!readValue(stream, magic) || !readValue(stream, version) || !readValue(stream, storedHash) || !readValue(stream, storedCheck)
+            || !readValue(stream, ntiles)) {
+        return -1;
+    }
+    if (magic != ENTRY_MAGIC || version != ENTRY_VERSION || storedHash != key.hash || storedCheck != key.check || ntiles < 0
+            || ntiles > maxTiles) {
+        return -1;
+    }
+
+    for (int i = 0; i < ntiles; ++i) {
+        std::int32_t dataSize;
+        unsigned char* data = nullptr;
+        if (readValue(stream, dataSize) && dataSize > 0 && dataSize <= MAX_LAYER_SIZE) {
+            data = static_cast<unsigned char*>(dtAlloc(dataSize, DT_ALLOC_PERM));
+            if (data) {
+                stream.read(reinterpret_cast<char*>(data), dataSize);
+            }
+        }
+        if (!data || !stream.good()) {
+            dtFree(data);
+            for (int j = 0; j < i; ++j) {
+                dtFree(tiles[j].data);
+                tiles[j].data = nullptr;
+                tiles[j].dataSize = 0;
+            }
+            return -1;
+        }
+        tiles[i].data = data;
+        tiles[i].dataSize = dataSize;
+    }
+
+    //Mark the entry as recently used, so it's kept when pruning.
+    boost::system::error_code ec;
+    boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+    return ntiles;
+}
+
+void TileDiskCache::store(const Key& key, const TileCacheData* tiles, int ntiles)
+{
+    if (mDisabled) {
+        return;
+    }
+    std::string path = entryPath(key);
+    std::string temporaryPath = String::compose("%1.%2.%3", path, getpid(), mTemporaryCounter++);
+    std::uintmax_t size = 0;
+    {
+        std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open()) {
+            return;
+        }
+        writeValue(stream, ENTRY_MAGIC);
+        writeValue(stream, ENTRY_VERSION);
+        writeValue(stream, key.hash);
+        writeValue(stream, key.check);
+        writeValue(stream, (std::int32_t)ntiles);
+        for (int i = 0; i < ntiles; ++i) {
+            size += tiles[i].dataSize;
+            writeValue(stream, (std::int32_t)tiles[i].dataSize);
+            stream.write(reinterpret_cast<const char*>(tiles[i].data), tiles[i].dataSize);
+        }
+        stream.flush();
+        if (!stream.good()) {
+            stream.close();
+            std::remove(temporaryPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        return;
+    }
+    if (mMaxSize != 0 && (mStoredSincePrune += size) > mMaxSize / 10) {
+        mStoredSincePrune = 0;
+        prune();
+    }
+}
+
+std::size_t TileDiskCache::prune()
+{
+    if (mDisabled || mMaxSize == 0) {
+        return 0;
+    }
+    //Another thread is already at it.
+    std::unique_lock<std::mutex> lock(mPruneMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return 0;
+    }
+
+    struct Entry
+    {
+        boost::filesystem::path path;
+        std::time_t time;
+        std::uintmax_t size;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t totalSize = 0;
+    std::size_t removed = 0;
+    std::time_t now = std::time(nullptr);
+
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator I(mDirectory, ec), Iend;
+    for (; !ec && I != Iend; I.increment(ec)) {
+        //Other processes sharing the directory may remove files at any time, so errors for single files are ignored.
+        boost::system::error_code fileEc;
+        const boost::filesystem::path& path = I->path();
+        std::time_t time = boost::filesystem::last_write_time(path, fileEc);
+        if (fileEc) {
+            continue;
+        }
+        std::uintmax_t size = boost::filesystem::file_size(path, fileEc);
+        if (fileEc) {
+            continue;
+        }
+        if (path.extension() == ".tile") {
+            entries.push_back(Entry{path, time, size});
+            totalSize += size;
+        } else if (path.filename().string().find(".tile.") != std::string::npos && now - time > TEMPORARY_MAX_AGE) {
+            if (boost::filesystem::remove(path, fileEc)) {
+                ++removed;
+            }
+        }
+    }
+
+    if (totalSize > mMaxSize) {
+        //Go down to a bit below the limit, so this isn't done again right away.
+        std::uintmax_t targetSize = mMaxSize - mMaxSize / 10;
+        std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            return lhs.time < rhs.time;
+        });
+        for (auto& entry : entries) {
+            if (totalSize <= targetSize) {
+                break;
+            }
+            boost::system::error_code fileEc;
+            if (boost::filesystem::remove(entry.path, fileEc)) {
+                ++removed;
+            }
+            totalSize -= entry.size;
+        }
+    }
+    return removed;
+}
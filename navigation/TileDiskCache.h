@@ -0,0 +1,122 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef TILEDISKCACHE_H_
+#define TILEDISKCACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+struct TileCacheData;
+
+/**
+ * @brief Keeps built navmesh tiles on disk, so that they don't need to be rebuilt when the AI client is restarted.
+ *
+ * Each entry contains the compressed layers of one tile, keyed by a hash of everything that went into building it.
+ * Since the key covers all inputs there's never any need to invalidate entries; a tile with changed terrain or
+ * obstacles simply gets a new key. Entries which are no longer used are instead removed once the total size of the
+ * cache exceeds its limit, least recently used first.
+ *
+ * The cache can be used from multiple threads at once. Entries are written to a temporary file which is then
+ * renamed, so that a crash or another process reading at the same time never sees a partially written entry.
+ */
+class TileDiskCache
+{
+    public:
+        /**
+         * @brief Identifies the inputs a tile was built from.
+         *
+         * Entries are named after the hash. The check value is calculated from the same inputs in a different way,
+         * and is stored in the entry and compared on load, so inputs whose hashes collide never share an entry.
+         */
+        struct Key
+        {
+            std::uint64_t hash;
+            std::uint64_t check;
+        };
+
+        /**
+         * @brief The default max total size of the entries, in bytes.
+         */
+        static const std::uintmax_t DEFAULT_MAX_SIZE = 256 * 1024 * 1024;
+
+        /**
+         * @param directory The directory in which entries are stored. It's created if it doesn't exist.
+         * @param maxSize The max total size of the entries, in bytes. Zero for no limit.
+         */
+        explicit TileDiskCache(std::string directory, std::uintmax_t maxSize = DEFAULT_MAX_SIZE);
+
+        /**
+         * @brief Loads the layers of a tile.
+         * @param key The key of the tile.
+         * @param tiles An array into which the layers are loaded. The data is allocated with dtAlloc.
+         * @param maxTiles The size of the array.
+         * @return The number of layers loaded, or -1 if there was no valid entry for the key.
+         */
+        int load(const Key& key, TileCacheData* tiles, int maxTiles) const;
+
+        /**
+         * @brief Stores the layers of a tile.
+         * @param key The key of the tile.
+         * @param tiles The layers.
+         * @param ntiles The number of layers.
+         */
+        void store(const Key& key, const TileCacheData* tiles, int ntiles);
+
+        /**
+         * @brief Removes the least recently used entries if the cache is larger than its limit.
+         *
+         * This is done when the cache is created, and whenever a tenth of the limit has been stored since the
+         * last time. Temporary files left behind by processes which crashed while storing are removed too.
+         * @return The number of files removed.
+         */
+        std::size_t prune();
+
+        const std::string& getDirectory() const;
+
+    private:
+        std::string mDirectory;
+
+        /**
+         * @brief Set if the directory couldn't be created, in which case nothing is stored.
+         */
+        bool mDisabled;
+
+        /**
+         * @brief Used to give each temporary file a unique name.
+         */
+        std::atomic<unsigned int> mTemporaryCounter;
+
+        std::uintmax_t mMaxSize;
+
+        /**
+         * @brief The number of bytes stored since the cache was last pruned.
+         */
+        std::atomic<std::uintmax_t> mStoredSincePrune;
+
+        /**
+         * @brief Held while pruning, so that only one thread does it at a time.
+         */
+        std::mutex mPruneMutex;
+
+        std::string entryPath(const Key& key) const;
+};
+
+#endif /* TILEDISKCACHE_H_ */
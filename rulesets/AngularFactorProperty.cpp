@@ -75,3 +75,8 @@ AngularFactorProperty * AngularFactorProperty::copy() const
     return new AngularFactorProperty(*this);
 }
 
+PropertyTypeId AngularFactorProperty::typeId() const
+{
+    return propertyTypeId<AngularFactorProperty>();
+}
+
@@ -36,6 +36,7 @@ class AngularFactorProperty: public PropertyBase
         static const std::string property_atlastype;
 
         AngularFactorProperty * copy() const override;
+        PropertyTypeId typeId() const override;
 
         const WFMath::Vector<3> & data() const { return m_data; }
         WFMath::Vector<3> & data() { return m_data; }
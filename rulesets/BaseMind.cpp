@@ -54,7 +54,7 @@ BaseMind::BaseMind(const std::string & id, long intId) :
 BaseMind::~BaseMind()
 {
     m_map.m_entities.erase(getIntId());
-    // FIXME Remove this once MemMap uses parent refcounting
+    // Parents aren't reference counted by their children in memory
     m_location.m_loc = 0;
     // debug(std::cout << getId() << ":" << getType() << " flushing mind with "
                     // << m_map.getEntities().size() << " entities in it"
@@ -101,6 +101,10 @@ void BaseMind::sightDeleteOperation(const Operation & op, OpVector & res)
         return;
     }
     const std::string & id = obj->getId();
+    if (id == getId()) {
+        // The memory doesn't own this mind, so it can't be deleted from it
+        return;
+    }
     if (!id.empty()) {
         m_map.del(obj->getId());
     } else {
@@ -337,6 +341,9 @@ void BaseMind::UnseenOperation(const Operation & op, OpVector & res)
         log(ERROR, "BaseMind: Unseen op has no arg ID");
         return;
     }
+    if (arg->getId() == getId()) {
+        return;
+    }
     m_map.del(arg->getId());
 }
 
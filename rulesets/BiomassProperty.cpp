@@ -21,6 +21,7 @@
 #include "rulesets/LocatedEntity.h"
 
 #include "common/debug.h"
+#include "common/TypeNode.h"
 
 #include "common/Eat.h"
 #include "common/Nourish.h"
@@ -41,6 +42,11 @@ void BiomassProperty::install(LocatedEntity * owner, const std::string & name)
     owner->installDelegate(Atlas::Objects::Operation::EAT_NO, name);
 }
 
+void BiomassProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::EAT_NO, name, this);
+}
+
 void BiomassProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::EAT_NO, name);
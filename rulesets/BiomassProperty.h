@@ -29,6 +29,7 @@ class BiomassProperty : public Property<double>
 {
     public:
         void install(LocatedEntity*, const std::string&) override;
+        void install(TypeNode*, const std::string&) override;
 
         void remove(LocatedEntity*, const std::string&) override;
 
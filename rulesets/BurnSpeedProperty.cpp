@@ -22,6 +22,7 @@
 #include "rulesets/StatusProperty.h"
 
 #include "common/debug.h"
+#include "common/TypeNode.h"
 
 #include "common/Burn.h"
 #include "common/Nourish.h"
@@ -44,6 +45,11 @@ void BurnSpeedProperty::install(LocatedEntity * owner, const std::string & name)
     owner->installDelegate(Atlas::Objects::Operation::BURN_NO, name);
 }
 
+void BurnSpeedProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::BURN_NO, name, this);
+}
+
 void BurnSpeedProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::BURN_NO, name);
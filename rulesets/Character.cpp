@@ -27,6 +27,7 @@
 #include "StatusProperty.h"
 #include "TasksProperty.h"
 #include "Domain.h"
+#include "Script.h"
 
 #include "common/BaseWorld.h"
 #include "common/op_switch.h"
@@ -36,6 +37,7 @@
 #include "common/Link.h"
 #include "common/TypeNode.h"
 #include "common/PropertyManager.h"
+#include "common/SystemScheduler.h"
 
 #include "common/Actuate.h"
 #include "common/Attack.h"
@@ -106,6 +108,12 @@ static const std::string STAMINA = "stamina";
 static const std::string STATUS = "status";
 static const std::string TASKS = "tasks";
 
+static const PropertyKey FOOD_KEY(PropertyKey::key_food);
+static const PropertyKey MASS_KEY(PropertyKey::key_mass);
+static const PropertyKey STAMINA_KEY(PropertyKey::key_stamina);
+static const PropertyKey STATUS_KEY(PropertyKey::key_status);
+static const PropertyKey TASKS_KEY(PropertyKey::key_tasks);
+
 /// \brief Calculate how the Characters metabolism has affected it in the
 /// last tick
 ///
@@ -122,43 +130,44 @@ void Character::metabolise(OpVector & res, double ammount)
     // Currently handles energy
     // We should probably call this whenever the entity performs a movement.
 
-    StatusProperty * status_prop = modPropertyClass<StatusProperty>(STATUS);
+    StatusProperty * status_prop = modPropertyClass<StatusProperty>(STATUS_KEY);
     bool status_changed = false;
     if (status_prop == nullptr) {
         // FIXME Probably don't do enough here to set up the property.
         status_prop = new StatusProperty;
         assert(status_prop != 0);
-        m_properties[STATUS] = status_prop;
+        m_properties[STATUS_KEY] = status_prop;
         status_prop->set(1.f);
         status_changed = true;
     }
     double & status = status_prop->data();
     status_prop->setFlags(flag_unsent);
 
-    Property<double> * food_prop = modPropertyType<double>(FOOD);
+    // Food, mass and stamina are read through the shared class default
+    // where there is one, and only copied to the instance when changed.
+    const Property<double> * food_read = getPropertyType<double>(FOOD_KEY);
     // DIGEST
-    if (food_prop != nullptr) {
+    if (food_read != nullptr && food_read->data() >= foodConsumption && status < 2) {
+        Property<double> * food_prop = modPropertyType<double>(FOOD_KEY);
         double & food = food_prop->data();
-        if (food >= foodConsumption && status < 2) {
-            // It is important that the metabolise bit is done next, as this
-            // handles the status change
-            status += foodConsumption;
-            status_changed = true;
-            food -= foodConsumption;
-
-            food_prop->setFlags(flag_unsent);
-            food_prop->apply(this);
-            propertyApplied(FOOD, *food_prop);
+        // It is important that the metabolise bit is done next, as this
+        // handles the status change
+        status += foodConsumption;
+        status_changed = true;
+        food -= foodConsumption;
 
-        }
+        food_prop->setFlags(flag_unsent);
+        food_prop->apply(this);
+        propertyApplied(FOOD, *food_prop);
     }
 
-    Property<double> * mass_prop = modPropertyType<double>(MASS);
+    const Property<double> * mass_read = getPropertyType<double>(MASS_KEY);
     // If status is very high, we gain weight
     if (status > (1.5 + energyLaidDown)) {
         status -= energyLaidDown;
         status_changed = true;
-        if (mass_prop != nullptr) {
+        if (mass_read != nullptr) {
+            Property<double> * mass_prop = modPropertyType<double>(MASS_KEY);
             double & mass = mass_prop->data();
             mass += weightGain;
             mass_prop->setFlags(flag_unsent);
@@ -174,16 +183,16 @@ void Character::metabolise(OpVector & res, double ammount)
         double energy_used = energyConsumption * ammount;
         status -= energy_used;
         status_changed = true;
-        if (mass_prop != nullptr) {
-            double & mass = mass_prop->data();
-            double weight_used = weightConsumption * mass * ammount;
-            if (status <= 0.5 && mass > weight_used) {
+        if (mass_read != nullptr) {
+            double weight_used = weightConsumption * mass_read->data() * ammount;
+            if (status <= 0.5 && mass_read->data() > weight_used) {
                 // Drain away a little less energy and lose some weight
                 // This ensures there is a long term penalty to allowing
                 // something to starve
+                Property<double> * mass_prop = modPropertyType<double>(MASS_KEY);
                 status += (energy_used / 2);
                 status_changed = true;
-                mass -= weight_used;
+                mass_prop->data() -= weight_used;
                 mass_prop->setFlags(flag_unsent);
                 mass_prop->apply(this);
                 propertyApplied(MASS, *mass_prop);
@@ -191,18 +200,16 @@ void Character::metabolise(OpVector & res, double ammount)
         }
     }
     // FIXME Stamina property?
-    auto tp = getPropertyClass<TasksProperty>(TASKS);
+    auto tp = getPropertyClass<TasksProperty>(TASKS_KEY);
     if ((tp == nullptr || !tp->busy())) {
 
-        Property<double> * stamina_prop = modPropertyType<double>(STAMINA);
-        if (stamina_prop != nullptr) {
-            double & stamina = stamina_prop->data();
-            if (stamina < 1.f) {
-                stamina = 1.f;
-                stamina_prop->setFlags(flag_unsent);
-                stamina_prop->apply(this);
-                propertyApplied(STAMINA, *stamina_prop);
-            }
+        const Property<double> * stamina_read = getPropertyType<double>(STAMINA_KEY);
+        if (stamina_read != nullptr && stamina_read->data() < 1.f) {
+            Property<double> * stamina_prop = modPropertyType<double>(STAMINA_KEY);
+            stamina_prop->data() = 1.f;
+            stamina_prop->setFlags(flag_unsent);
+            stamina_prop->apply(this);
+            propertyApplied(STAMINA, *stamina_prop);
         }
     }
 
@@ -295,7 +302,7 @@ Character::~Character()
     delete m_externalMind;
 }
 
-int Character::linkExternal(Link * link)
+int Character::linkExternal(Link * link, bool possessed)
 {
     if (m_externalMind == nullptr) {
         m_externalMind = new ExternalMind(*this);
@@ -312,6 +319,12 @@ int Character::linkExternal(Link * link)
         ep->apply(this);
     }
 
+    // Minds use this to tell how close they are to any player.
+    PropertyBase * player_prop = setAttr("player", possessed ? 0 : 1);
+    if (player_prop != nullptr) {
+        player_prop->setFlags(per_ephem);
+    }
+
     Anonymous update_arg;
     update_arg->setId(getId());
     update_arg->setAttr("external", 1);
@@ -375,6 +388,14 @@ int Character::unlinkExternal(Link * link)
     m_externalMind->linkUp(nullptr);
     externalLinkChanged.emit();
 
+    if (getProperty("player") != nullptr) {
+        setAttr("player", 0);
+
+        Update update;
+        update->setTo(getId());
+        sendWorld(update);
+    }
+
     //If the entity is marked as "transient" we should remove it from the world once it's not controlled anymore.
     if (getProperty("transient")) {
         log(INFO, "Removing entity marked as transient when mind disconnected. " + describeEntity());
@@ -506,6 +527,24 @@ void Character::TickOperation(const Operation & op, OpVector & res)
         }
     } else {
         // METABOLISE
+        SystemScheduler * systems = BaseWorld::instance().getSystems();
+        // A script which handles Tick relies on the Tick chain to be
+        // called again, so such characters keep it.
+        if (systems != nullptr &&
+            (m_script == nullptr || !m_script->handlesOperation(op->getParent(), op->getClassNo()))) {
+            // Metabolism of all characters is run in one batch by the
+            // world, so the Tick only needs to add this character to it.
+            int metabolism = systems->addSystem("metabolism",
+                                                consts::basic_tick * 30,
+                                                [](LocatedEntity & entity, OpVector & res) {
+                                                    static_cast<Character &>(entity).metabolise(res);
+                                                });
+            if (systems->addEntity(metabolism, *this)) {
+                metabolise(res);
+            }
+            return;
+        }
+
         metabolise(res);
 
         // TICK
@@ -571,8 +610,7 @@ void Character::UseOperation(const Operation & op, OpVector & res)
         return;
     }
 
-    // Are we going to modify this really?
-    EntityProperty * rhw = modPropertyClass<EntityProperty>(RIGHT_HAND_WIELD);
+    const EntityProperty * rhw = getPropertyClass<EntityProperty>(RIGHT_HAND_WIELD);
     if (rhw == nullptr) {
         error(op, "Character::UseOp No tool wielded, no right_hand_wield property found", res, getId());
         return;
@@ -878,7 +916,7 @@ void Character::AttackOperation(const Operation & op, OpVector & res)
         return;
     }
 
-    const TasksProperty * atp = attacker->getPropertyClass<TasksProperty>(TASKS);
+    const TasksProperty * atp = attacker->getPropertyClass<TasksProperty>(TASKS_KEY);
     if (atp != nullptr && atp->busy()) {
         log(ERROR, String::compose("AttackOperation: Attack op aborted "
                 "because attacker %1(%2) busy.", attacker->getId(), attacker->getType()));
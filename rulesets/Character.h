@@ -117,7 +117,11 @@ class Character : public Thing, public virtual sigc::trackable {
     explicit Character(const std::string & id, long intId);
     virtual ~Character();
 
-    int linkExternal(Link *);
+    /// \brief Link the character to an external mind
+    ///
+    /// @param possessed true if the link is an AI client possessing the
+    /// character, rather than a player
+    int linkExternal(Link *, bool possessed = false);
     int unlinkExternal(Link *);
 
     int startTask(Task *, const Operation & op, OpVector &);
@@ -21,6 +21,7 @@
 #include "rulesets/LocatedEntity.h"
 
 #include "common/debug.h"
+#include "common/TypeNode.h"
 
 #include <Atlas/Objects/Anonymous.h>
 #include <Atlas/Objects/Operation.h>
@@ -39,6 +40,11 @@ void DecaysProperty::install(LocatedEntity * owner, const std::string & name)
     owner->installDelegate(Atlas::Objects::Operation::DELETE_NO, name);
 }
 
+void DecaysProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::DELETE_NO, name, this);
+}
+
 void DecaysProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::DELETE_NO, name);
@@ -30,6 +30,7 @@ class DecaysProperty : public Property<std::string>
 {
     public:
         void install(LocatedEntity*, const std::string&) override;
+        void install(TypeNode*, const std::string&) override;
 
         void remove(LocatedEntity*, const std::string&) override;
 
@@ -53,9 +53,11 @@ void DensityProperty::updateMass(LocatedEntity *entity) const
 
         double mass = volume * m_data;
 
-        auto massProp = entity->requirePropertyClass<Property<double>>("mass");
+        //Only make the mass an instance property if it needs to change.
+        auto massRead = entity->getPropertyType<double>("mass");
 
-        if (massProp->data() != mass) {
+        if (massRead == nullptr || massRead->data() != mass) {
+            auto massProp = entity->requirePropertyClass<Property<double>>("mass");
             massProp->set(mass);
             massProp->apply(entity);
             massProp->resetFlags(per_clean);
@@ -71,3 +73,8 @@ DensityProperty * DensityProperty::copy() const
     return new DensityProperty(*this);
 }
 
+PropertyTypeId DensityProperty::typeId() const
+{
+    return propertyTypeId<DensityProperty>();
+}
+
@@ -37,6 +37,7 @@ class DensityProperty: public Property<double>
         void apply(LocatedEntity *) override;
 
         DensityProperty * copy() const override;
+        PropertyTypeId typeId() const override;
 
         void updateMass(LocatedEntity *entity) const;
 
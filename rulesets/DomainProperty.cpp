@@ -28,6 +28,7 @@
 
 #include "common/const.h"
 #include "common/Tick.h"
+#include "common/TypeNode.h"
 
 #include <Atlas/Objects/Anonymous.h>
 #include <common/BaseWorld.h>
@@ -44,6 +45,11 @@ void DomainProperty::install(LocatedEntity* entity, const std::string& name)
     entity->installDelegate(Atlas::Objects::Operation::TICK_NO, name);
 }
 
+void DomainProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::TICK_NO, name, this);
+}
+
 void DomainProperty::remove(LocatedEntity* entity, const std::string& name)
 {
     sInstanceState.removeState(entity);
@@ -88,6 +94,11 @@ DomainProperty* DomainProperty::copy() const
     return new DomainProperty(*this);
 }
 
+PropertyTypeId DomainProperty::typeId() const
+{
+    return propertyTypeId<DomainProperty>();
+}
+
 Domain* DomainProperty::getDomain(const LocatedEntity* entity) const
 {
     return sInstanceState.getState(entity);
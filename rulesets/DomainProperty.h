@@ -47,10 +47,12 @@ class DomainProperty: public Property<std::string> {
         DomainProperty(const DomainProperty& rhs) = default;
 
         void install(LocatedEntity *, const std::string &) override;
+        void install(TypeNode *, const std::string &) override;
 
         void remove(LocatedEntity *, const std::string &) override;
 
         DomainProperty * copy() const override;
+        PropertyTypeId typeId() const override;
 
         void apply(LocatedEntity *) override;
 
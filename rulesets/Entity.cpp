@@ -43,6 +43,8 @@
 #include <Atlas/Objects/Operation.h>
 #include <Atlas/Objects/Anonymous.h>
 
+#include <algorithm>
+
 using Atlas::Message::Element;
 using Atlas::Message::MapType;
 using Atlas::Message::ListType;
@@ -127,7 +129,8 @@ PropertyBase * Entity::setAttr(const std::string & name, const Element & attr)
 {
     PropertyBase * prop;
     // If it is an existing property, just update the value.
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyKey key = PropertyKey::intern(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         prop = I->second;
         // Mark it as unclean
@@ -135,8 +138,9 @@ PropertyBase * Entity::setAttr(const std::string & name, const Element & attr)
     } else {
         PropertyDict::const_iterator I;
         if (m_type != 0 &&
-            (I = m_type->defaults().find(name)) != m_type->defaults().end()) {
+            (I = m_type->defaults().find(key)) != m_type->defaults().end()) {
             prop = I->second->copy();
+            ++propertyDefaultCopies();
         } else {
             // This is an entirely new property, not just a modification of
             // one in defaults, so we need to install it to this Entity.
@@ -145,7 +149,7 @@ PropertyBase * Entity::setAttr(const std::string & name, const Element & attr)
             prop->install(this, name);
         }
         assert(prop != 0);
-        m_properties[name] = prop;
+        m_properties[key] = prop;
     }
 
     prop->set(attr);
@@ -158,14 +162,14 @@ PropertyBase * Entity::setAttr(const std::string & name, const Element & attr)
     return prop;
 }
 
-const PropertyBase * Entity::getProperty(const std::string & name) const
+const PropertyBase * Entity::getProperty(const PropertyKey & key) const
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second;
     }
     if (m_type != 0) {
-        I = m_type->defaults().find(name);
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             return I->second;
         }
@@ -173,24 +177,26 @@ const PropertyBase * Entity::getProperty(const std::string & name) const
     return 0;
 }
 
-PropertyBase * Entity::modProperty(const std::string & name, const Atlas::Message::Element& def_val)
+PropertyBase * Entity::modProperty(const PropertyKey & key, const Atlas::Message::Element& def_val)
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second;
     }
     if (m_type != nullptr) {
-        I = m_type->defaults().find(name);
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             // We have a default for this property. Create a new instance
             // property with the same value.
+            const std::string & name = key.name();
             PropertyBase * new_prop = I->second->copy();
+            ++propertyDefaultCopies();
             if (!def_val.isNone()) {
                 new_prop->set(def_val);
             }
             I->second->remove(this, name);
             new_prop->flags() &= ~flag_class;
-            m_properties[name] = new_prop;
+            m_properties[key] = new_prop;
             new_prop->apply(this);
             propertyApplied(name, *new_prop);
             new_prop->install(this, name);
@@ -261,14 +267,37 @@ void Entity::addToEntity(const RootEntity & ent) const
 /// @param delegate The name of the property to delegate it to.
 void Entity::installDelegate(int class_no, const std::string & delegate)
 {
-    m_delegates.insert(std::make_pair(class_no, delegate));
+    auto entry = std::make_pair(class_no, PropertyKey::intern(delegate));
+    // Delegates to class properties are installed once, on the type.
+    if (m_type != 0 && m_type->hasDelegate(class_no, entry.second)) {
+        m_removedDelegates.erase(std::remove(m_removedDelegates.begin(),
+                                             m_removedDelegates.end(),
+                                             entry),
+                                 m_removedDelegates.end());
+        return;
+    }
+    if (std::find(m_delegates.begin(), m_delegates.end(), entry) == m_delegates.end()) {
+        m_delegates.push_back(entry);
+    }
 }
 
 void Entity::removeDelegate(int class_no, const std::string & delegate)
 {
-    auto I = m_delegates.find(class_no);
-    if (I != m_delegates.end() && I->second == delegate) {
+    auto entry = std::make_pair(class_no, PropertyKey::find(delegate));
+    auto I = std::find(m_delegates.begin(), m_delegates.end(), entry);
+    if (I != m_delegates.end()) {
         m_delegates.erase(I);
+        return;
+    }
+    const TypeNode::DelegateList * typeDelegates = m_type != 0 ? m_type->delegates(class_no) : nullptr;
+    if (typeDelegates != nullptr &&
+        std::find(m_removedDelegates.begin(), m_removedDelegates.end(), entry) == m_removedDelegates.end()) {
+        for (auto & typeDelegate : *typeDelegates) {
+            if (typeDelegate.key == entry.second) {
+                m_removedDelegates.push_back(entry);
+                break;
+            }
+        }
     }
 }
 
@@ -531,16 +560,46 @@ void Entity::operation(const Operation & op, OpVector & res)
         return;
     }
 
-    auto J = m_delegates.equal_range(op->getClassNo());
+    int class_no = op->getClassNo();
     HandlerResult hr = OPERATION_IGNORED;
-    for (;J.first != J.second; ++J.first) {
-        HandlerResult hr_call = callDelegate(J.first->second, op, res);
+    auto record = [&hr](HandlerResult hr_call) {
         //We'll record the most blocking of the different results only.
         if (hr != OPERATION_BLOCKED) {
             if (hr_call != OPERATION_IGNORED) {
                 hr = hr_call;
             }
         }
+    };
+    const TypeNode::DelegateList * typeDelegates = m_type != 0 ? m_type->delegates(class_no) : nullptr;
+    if (typeDelegates != nullptr) {
+        for (auto & delegate : *typeDelegates) {
+            if (!m_removedDelegates.empty() &&
+                std::find(m_removedDelegates.begin(), m_removedDelegates.end(),
+                          std::make_pair(class_no, delegate.key)) != m_removedDelegates.end()) {
+                continue;
+            }
+            // A copy of the class property in the instance takes precedence.
+            PropertyBase * p = delegate.property;
+            if (!m_properties.empty()) {
+                auto I = m_properties.find(delegate.key);
+                if (I != m_properties.end()) {
+                    p = I->second;
+                }
+            }
+            if (p != 0) {
+                record(p->operation(this, op, res));
+            }
+        }
+    }
+    for (auto & entry : m_delegates) {
+        if (entry.first != class_no) {
+            continue;
+        }
+        // The type may have gained the delegate after it was installed here.
+        if (typeDelegates != nullptr && m_type->hasDelegate(class_no, entry.second)) {
+            continue;
+        }
+        record(callDelegate(entry.second, op, res));
         // How to access the property? We need a non-const pointer to call
         // operation, but to get this easily we need to force instantiation
         // from the type dict, making properties way less efficient.
@@ -563,13 +622,20 @@ void Entity::operation(const Operation & op, OpVector & res)
 HandlerResult Entity::callDelegate(const std::string & name,
                                    const Operation & op,
                                    OpVector & res)
+{
+    return callDelegate(PropertyKey::find(name), op, res);
+}
+
+HandlerResult Entity::callDelegate(const PropertyKey & key,
+                                   const Operation & op,
+                                   OpVector & res)
 {
     PropertyBase * p = 0;
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         p = I->second;
     } else if (m_type != 0) {
-        I = m_type->defaults().find(name); 
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             p = I->second;
         }
@@ -21,6 +21,8 @@
 
 #include "LocatedEntity.h"
 
+#include "common/ObjectPool.h"
+
 #include <iostream>
 #include <unordered_map>
 
@@ -32,12 +34,18 @@
 /// transparently without needing to know which are which.
 /// This is now also intended to be the base for in-game persistance.
 /// It implements the basic types required for persistance.
+/// Instances of this class and its subclasses are pool allocated.
 /// \ingroup EntityClasses
-class Entity : public LocatedEntity {
+class Entity : public LocatedEntity, public PoolAllocated<Entity> {
   protected:
 
-    /// Map of delegate properties.
-    std::multimap<int, std::string> m_delegates;
+    /// Delegates of operation classes to properties which are not class
+    /// properties of the type. Delegates to class properties are held by
+    /// the TypeNode, and shared by all entities of the type.
+    std::vector<std::pair<int, PropertyKey>> m_delegates;
+
+    /// Delegates of the type which have been removed from this entity.
+    std::vector<std::pair<int, PropertyKey>> m_removedDelegates;
 
     /// A static map tracking the number of existing entities per type.
     /// A monitor by the name of "entity_count{type=*}" will be created
@@ -50,10 +58,22 @@ class Entity : public LocatedEntity {
 
     void setType(const TypeNode * t) override;
 
+    /// \brief Number of class default properties copied to instances.
+    ///
+    /// Instances share the property of their type until a value is
+    /// changed, so this counts the copies made for modification.
+    static int & propertyDefaultCopies()
+    {
+        static int s_count = 0;
+        return s_count;
+    }
+
     PropertyBase * setAttr(const std::string & name, const Atlas::Message::Element &) override;
-    const PropertyBase * getProperty(const std::string & name) const override;
+    using LocatedEntity::getProperty;
+    const PropertyBase * getProperty(const PropertyKey & key) const override;
 
-    PropertyBase * modProperty(const std::string & name, const Atlas::Message::Element& def_val = Atlas::Message::Element()) override;
+    using LocatedEntity::modProperty;
+    PropertyBase * modProperty(const PropertyKey & key, const Atlas::Message::Element& def_val = Atlas::Message::Element()) override;
     PropertyBase * setProperty(const std::string & name, PropertyBase * prop) override;
 
     void addToMessage(Atlas::Message::MapType &) const override;
@@ -91,6 +111,9 @@ class Entity : public LocatedEntity {
     HandlerResult callDelegate(const std::string &,
                                const Operation &,
                                OpVector &);
+    HandlerResult callDelegate(const PropertyKey &,
+                               const Operation &,
+                               OpVector &);
     void callOperation(const Operation &, OpVector &);
 
     void installDelegate(int, const std::string &) override;
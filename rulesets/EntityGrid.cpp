@@ -0,0 +1,125 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include "EntityGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/// \brief Cell coordinates are clamped to this, so far away or broken
+/// positions end up in the outermost cells instead of overflowing.
+static const WFMath::CoordType max_cell_index = 1 << 30;
+
+EntityGrid::EntityGrid(WFMath::CoordType cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize > 0);
+}
+
+int EntityGrid::cellIndex(WFMath::CoordType coord) const
+{
+    WFMath::CoordType index = std::floor(coord / m_cellSize);
+    if (!(index > -max_cell_index)) {
+        // Also catches NaN
+        return -(int)max_cell_index;
+    }
+    if (index > max_cell_index) {
+        return (int)max_cell_index;
+    }
+    return (int)index;
+}
+
+void EntityGrid::removeFromCell(LocatedEntity * entity, CellKey cell)
+{
+    auto I = m_cells.find(cell);
+    assert(I != m_cells.end());
+    std::vector<LocatedEntity *> & entities = I->second;
+    auto J = std::find(entities.begin(), entities.end(), entity);
+    assert(J != entities.end());
+    *J = entities.back();
+    entities.pop_back();
+    if (entities.empty()) {
+        m_cells.erase(I);
+    }
+}
+
+void EntityGrid::update(LocatedEntity * entity, const Point3D & pos)
+{
+    CellKey cell = key(cellIndex(pos.x()), cellIndex(pos.z()));
+    auto I = m_cellOf.find(entity);
+    if (I != m_cellOf.end()) {
+        if (I->second == cell) {
+            return;
+        }
+        removeFromCell(entity, I->second);
+        I->second = cell;
+    } else {
+        m_cellOf.emplace(entity, cell);
+    }
+    m_cells[cell].push_back(entity);
+}
+
+bool EntityGrid::remove(LocatedEntity * entity)
+{
+    auto I = m_cellOf.find(entity);
+    if (I == m_cellOf.end()) {
+        return false;
+    }
+    removeFromCell(entity, I->second);
+    m_cellOf.erase(I);
+    return true;
+}
+
+void EntityGrid::clear()
+{
+    m_cells.clear();
+    m_cellOf.clear();
+}
+
+void EntityGrid::collect(const Point3D & centre, WFMath::CoordType radius,
+                         std::vector<LocatedEntity *> & res) const
+{
+    int minX = cellIndex(centre.x() - radius);
+    int maxX = cellIndex(centre.x() + radius);
+    int minZ = cellIndex(centre.z() - radius);
+    int maxZ = cellIndex(centre.z() + radius);
+
+    // For large radii it's cheaper to go through the cells which exist
+    // than to look up every cell the circle covers.
+    std::int64_t covered = ((std::int64_t)maxX - minX + 1) * ((std::int64_t)maxZ - minZ + 1);
+    if (covered > (std::int64_t)m_cells.size()) {
+        for (auto & entry : m_cells) {
+            std::uint64_t cell = (std::uint64_t)entry.first;
+            int x = (std::int32_t)(std::uint32_t)(cell >> 32);
+            int z = (std::int32_t)(std::uint32_t)cell;
+            if (x >= minX && x <= maxX && z >= minZ && z <= maxZ) {
+                res.insert(res.end(), entry.second.begin(), entry.second.end());
+            }
+        }
+        return;
+    }
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int z = minZ; z <= maxZ; ++z) {
+            auto I = m_cells.find(key(x, z));
+            if (I != m_cells.end()) {
+                res.insert(res.end(), I->second.begin(), I->second.end());
+            }
+        }
+    }
+}
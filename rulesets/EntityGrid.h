@@ -0,0 +1,81 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef RULESETS_ENTITY_GRID_H
+#define RULESETS_ENTITY_GRID_H
+
+#include "physics/Vector3D.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class LocatedEntity;
+
+/// \brief Uniform grid of entities, bucketed by their horizontal position
+///
+/// Used by the memory of a mind to find the children of a location near a
+/// point without looking at every child. Only the x and z axes are used.
+class EntityGrid {
+  public:
+    explicit EntityGrid(WFMath::CoordType cellSize = 16.f);
+
+    /// \brief Insert an entity, or move it if it's already in the grid
+    void update(LocatedEntity * entity, const Point3D & pos);
+
+    /// \brief Remove an entity
+    ///
+    /// @return true if the entity was in the grid
+    bool remove(LocatedEntity * entity);
+
+    void clear();
+
+    /// \brief Collect the entities in all cells overlapping a circle
+    ///
+    /// This is a superset of the entities within the radius, so the
+    /// caller must still check the distance of each entity.
+    void collect(const Point3D & centre, WFMath::CoordType radius,
+                 std::vector<LocatedEntity *> & res) const;
+
+    std::size_t size() const {
+        return m_cellOf.size();
+    }
+
+    std::size_t cellCount() const {
+        return m_cells.size();
+    }
+
+  private:
+    typedef std::int64_t CellKey;
+
+    WFMath::CoordType m_cellSize;
+    std::unordered_map<CellKey, std::vector<LocatedEntity *>> m_cells;
+    /// \brief The cell each entity is in
+    std::unordered_map<LocatedEntity *, CellKey> m_cellOf;
+
+    int cellIndex(WFMath::CoordType coord) const;
+
+    static CellKey key(int x, int z) {
+        return static_cast<CellKey>((static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+                                    static_cast<std::uint32_t>(z));
+    }
+
+    void removeFromCell(LocatedEntity * entity, CellKey cell);
+};
+
+#endif // RULESETS_ENTITY_GRID_H
@@ -112,3 +112,8 @@ EntityProperty * EntityProperty::copy() const
 {
     return new EntityProperty(*this);
 }
+
+PropertyTypeId EntityProperty::typeId() const
+{
+    return propertyTypeId<EntityProperty>();
+}
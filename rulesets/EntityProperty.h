@@ -47,6 +47,7 @@ class EntityProperty : public PropertyBase
         void add(const std::string& val, const Atlas::Objects::Entity::RootEntity& ent) const override;
 
         EntityProperty* copy() const override;
+        PropertyTypeId typeId() const override;
 };
 
 #endif // RULESETS_ENTITY_PROPERTY_H
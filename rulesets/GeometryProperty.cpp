@@ -340,6 +340,11 @@ GeometryProperty* GeometryProperty::copy() const
     return new GeometryProperty(*this);
 }
 
+PropertyTypeId GeometryProperty::typeId() const
+{
+    return propertyTypeId<GeometryProperty>();
+}
+
 
 void GeometryProperty::install(TypeNode* typeNode, const std::string&)
 {
@@ -74,6 +74,7 @@ class GeometryProperty : public Property<Atlas::Message::MapType>
         void install(TypeNode*, const std::string&) override;
 
         GeometryProperty* copy() const override;
+        PropertyTypeId typeId() const override;
 
         /**
          * Creates a new shape instance for the supplied bounding box, and setting the center of mass offset.
@@ -22,6 +22,8 @@
 #include "ImmortalProperty.h"
 #include "LocatedEntity.h"
 
+#include "common/TypeNode.h"
+
 #include <Atlas/Objects/Operation.h>
 
 static const bool debug_flag = false;
@@ -31,6 +33,11 @@ void ImmortalProperty::install(LocatedEntity * owner, const std::string & name)
     owner->installDelegate(Atlas::Objects::Operation::DELETE_NO, name);
 }
 
+void ImmortalProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::DELETE_NO, name, this);
+}
+
 void ImmortalProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::DELETE_NO, name);
@@ -32,6 +32,7 @@ class ImmortalProperty : public Property<int>
     public:
 
         void install(LocatedEntity *, const std::string &) override;
+        void install(TypeNode *, const std::string &) override;
 
         void remove(LocatedEntity *, const std::string &) override;
 
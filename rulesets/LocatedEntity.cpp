@@ -99,12 +99,13 @@ void LocatedEntity::setType(const TypeNode* t)
 /// false otherwise
 bool LocatedEntity::hasAttr(const std::string& name) const
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyKey key = PropertyKey::find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return true;
     }
     if (m_type != 0) {
-        I = m_type->defaults().find(name);
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             return true;
         }
@@ -121,12 +122,13 @@ bool LocatedEntity::hasAttr(const std::string& name) const
 int LocatedEntity::getAttr(const std::string& name,
                            Element& attr) const
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyKey key = PropertyKey::find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second->get(attr);
     }
     if (m_type != 0) {
-        I = m_type->defaults().find(name);
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             return I->second->get(attr);
         }
@@ -144,12 +146,13 @@ int LocatedEntity::getAttrType(const std::string& name,
                                Element& attr,
                                int type) const
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyKey key = PropertyKey::find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second->get(attr) || (attr.getType() == type ? 0 : 1);
     }
     if (m_type != 0) {
-        I = m_type->defaults().find(name);
+        I = m_type->defaults().find(key);
         if (I != m_type->defaults().end()) {
             return I->second->get(attr) || (attr.getType() == type ? 0 : 1);
         }
@@ -164,31 +167,32 @@ int LocatedEntity::getAttrType(const std::string& name,
 PropertyBase* LocatedEntity::setAttr(const std::string& name,
                                      const Element& attr)
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyKey key = PropertyKey::intern(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         I->second->set(attr);
         return I->second;
     }
-    return m_properties[name] = new SoftProperty(attr);
+    return m_properties[key] = new SoftProperty(attr);
 }
 
 /// \brief Get the property object for a given attribute
 ///
-/// @param name name of the attribute for which the property is required.
+/// @param key interned name of the attribute for which the property is required.
 /// @return a pointer to the property, or zero if the attributes does
 /// not exist, or is not stored using a property object.
-const PropertyBase* LocatedEntity::getProperty(const std::string& name) const
+const PropertyBase* LocatedEntity::getProperty(const PropertyKey& key) const
 {
-    auto I = m_properties.find(name);
+    auto I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second;
     }
     return nullptr;
 }
 
-PropertyBase* LocatedEntity::modProperty(const std::string& name, const Atlas::Message::Element & def_val)
+PropertyBase* LocatedEntity::modProperty(const PropertyKey& key, const Atlas::Message::Element & def_val)
 {
-    auto I = m_properties.find(name);
+    auto I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second;
     }
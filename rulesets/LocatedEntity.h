@@ -22,6 +22,7 @@
 #include "modules/Location.h"
 
 #include "common/Property.h"
+#include "common/PropertyDict.h"
 #include "common/Router.h"
 #include "common/log.h"
 #include "common/compose.hpp"
@@ -42,7 +43,6 @@ template <typename T>
 class Property;
 
 typedef std::set<LocatedEntity *> LocatedEntitySet;
-typedef std::map<std::string, PropertyBase *> PropertyDict;
 
 /// \brief Flag indicating entity has been written to permanent store
 /// \ingroup EntityFlags
@@ -199,10 +199,24 @@ class LocatedEntity : public Router {
                             int type) const;
     virtual PropertyBase* setAttr(const std::string & name,
                                   const Atlas::Message::Element &);
-    virtual const PropertyBase * getProperty(const std::string & name) const;
+    virtual const PropertyBase * getProperty(const PropertyKey & key) const;
     // FIXME These should be de-virtualised and, and implementations moved
     // from Entity to here.
-    virtual PropertyBase * modProperty(const std::string & name, const Atlas::Message::Element& def_val = Atlas::Message::Element());
+    /// \brief Get a property for modification.
+    ///
+    /// A property only present as a class default is copied to the instance,
+    /// so use getProperty() where the value is only read.
+    virtual PropertyBase * modProperty(const PropertyKey & key, const Atlas::Message::Element& def_val = Atlas::Message::Element());
+
+    /// \brief Get the property object for a given attribute name
+    const PropertyBase * getProperty(const std::string & name) const {
+        return getProperty(PropertyKey::find(name));
+    }
+
+    /// \brief Get a modifiable property object for a given attribute name
+    PropertyBase * modProperty(const std::string & name, const Atlas::Message::Element& def_val = Atlas::Message::Element()) {
+        return modProperty(PropertyKey::find(name), def_val);
+    }
     virtual PropertyBase * setProperty(const std::string & name, PropertyBase * prop);
 
     virtual void installDelegate(int, const std::string &);
@@ -269,13 +283,32 @@ class LocatedEntity : public Router {
      */
     bool isVisibleForOtherEntity(const LocatedEntity* watcher) const;
 
+    /// \brief Get the key for the "property_name" trait of a class.
+    template <class PropertyT>
+    static const PropertyKey & propertyKeyFixed()
+    {
+        static const PropertyKey s_key = PropertyKey::intern(PropertyT::property_name);
+        return s_key;
+    }
+
     /// \brief Get a property that is required to of a given type.
     template <class PropertyT>
     const PropertyT * getPropertyClass(const std::string & name) const
     {
         const PropertyBase * p = getProperty(name);
         if (p != 0) {
-            return dynamic_cast<const PropertyT *>(p);
+            return property_cast<PropertyT>(p);
+        }
+        return 0;
+    }
+
+    /// \brief Get a property that is required to of a given type.
+    template <class PropertyT>
+    const PropertyT * getPropertyClass(const PropertyKey & key) const
+    {
+        const PropertyBase * p = getProperty(key);
+        if (p != 0) {
+            return property_cast<PropertyT>(p);
         }
         return 0;
     }
@@ -283,10 +316,11 @@ class LocatedEntity : public Router {
     /// \brief Get a property that is required to of a given type.
     ///
     /// The specified class must present the "property_name" trait.
+    /// The key for the name is resolved once per class.
     template <class PropertyT>
     const PropertyT * getPropertyClassFixed() const
     {
-        return this->getPropertyClass<PropertyT>(PropertyT::property_name);
+        return this->getPropertyClass<PropertyT>(propertyKeyFixed<PropertyT>());
     }
 
     /// \brief Get a property that is a generic property of a given type
@@ -295,7 +329,18 @@ class LocatedEntity : public Router {
     {
         const PropertyBase * p = getProperty(name);
         if (p != 0) {
-            return dynamic_cast<const Property<T> *>(p);
+            return property_cast<Property<T>>(p);
+        }
+        return 0;
+    }
+
+    /// \brief Get a property that is a generic property of a given type
+    template <typename T>
+    const Property<T> * getPropertyType(const PropertyKey & key) const
+    {
+        const PropertyBase * p = getProperty(key);
+        if (p != 0) {
+            return property_cast<Property<T>>(p);
         }
         return 0;
     }
@@ -306,7 +351,18 @@ class LocatedEntity : public Router {
     {
         PropertyBase * p = modProperty(name);
         if (p != 0) {
-            return dynamic_cast<PropertyT *>(p);
+            return property_cast<PropertyT>(p);
+        }
+        return 0;
+    }
+
+    /// \brief Get a property that is required to of a given type.
+    template <class PropertyT>
+    PropertyT * modPropertyClass(const PropertyKey & key)
+    {
+        PropertyBase * p = modProperty(key);
+        if (p != 0) {
+            return property_cast<PropertyT>(p);
         }
         return 0;
     }
@@ -317,7 +373,7 @@ class LocatedEntity : public Router {
     template <class PropertyT>
     PropertyT * modPropertyClassFixed()
     {
-        return this->modPropertyClass<PropertyT>(PropertyT::property_name);
+        return this->modPropertyClass<PropertyT>(propertyKeyFixed<PropertyT>());
     }
 
     /// \brief Get a modifiable property that is a generic property of a type
@@ -330,7 +386,18 @@ class LocatedEntity : public Router {
     {
         PropertyBase * p = modProperty(name);
         if (p != 0) {
-            return dynamic_cast<Property<T> *>(p);
+            return property_cast<Property<T>>(p);
+        }
+        return 0;
+    }
+
+    /// \brief Get a modifiable property that is a generic property of a type
+    template <typename T>
+    Property<T> * modPropertyType(const PropertyKey & key)
+    {
+        PropertyBase * p = modProperty(key);
+        if (p != 0) {
+            return property_cast<Property<T>>(p);
         }
         return 0;
     }
@@ -350,7 +417,7 @@ class LocatedEntity : public Router {
         PropertyBase * p = modProperty(name, def_val);
         PropertyT * sp = 0;
         if (p != 0) {
-            sp = dynamic_cast<PropertyT *>(p);
+            sp = property_cast<PropertyT>(p);
             //Assert that the stored property is of the correct type. If not,
             //it needs to be installed into CorePropertyManager.
             //We want to do this here, because allowing for properties to be
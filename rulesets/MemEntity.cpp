@@ -51,7 +51,8 @@ void MemEntity::destroy()
          assert(ent_loc->m_contains != 0);
          ent_loc->m_contains->erase(this);
      }
-     // FIXME This is required until MemMap uses parent refcounting
+     // Children don't hold a reference to their parent in the memory of a
+     // mind, so LOC must not outlive removal from the memory.
      this->m_location.m_loc = 0;
 
      if (this->m_contains != 0) {
@@ -67,6 +68,8 @@ void MemEntity::destroy()
                  ent_loc->m_contains->insert(child_ent);
              }
          }
+         // Scripts may keep this entity around for a while
+         this->m_contains->clear();
      }
      m_flags |= entity_destroyed;
 }
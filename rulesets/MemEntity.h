@@ -21,13 +21,16 @@
 
 #include "rulesets/LocatedEntity.h"
 
+#include "common/ObjectPool.h"
+
 /// \brief This class is used to represent entities inside MemMap used
 /// by the mind of an AI.
 ///
 /// It adds a flag to indicate if this entity is currently visible, and
 /// a means of tracking when it was last seen, so garbage entities can
-/// be cleaned up.
-class MemEntity : public LocatedEntity {
+/// be cleaned up. Instances are pool allocated, as a mind may create and
+/// discard a large number of them.
+class MemEntity : public LocatedEntity, public PoolAllocated<MemEntity> {
   protected:
     double m_lastSeen;
   public:
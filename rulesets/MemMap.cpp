@@ -29,6 +29,8 @@
 #include <Atlas/Objects/Operation.h>
 #include <Atlas/Objects/Anonymous.h>
 
+#include <algorithm>
+
 static const bool debug_flag = false;
 
 using Atlas::Message::Element;
@@ -41,6 +43,13 @@ using String::compose;
 
 const TypeNode * MemMap::m_entity_type = 0;
 
+MemMap::Statistics MemMap::s_statistics;
+
+std::size_t MemMap::s_defaultBudget = 0;
+
+/// \brief Entities not seen for this long are forgotten, if a budget is set
+static const double forget_time = 600;
+
 MemEntity * MemMap::addEntity(MemEntity * entity)
 {
     assert(entity != 0);
@@ -54,6 +63,7 @@ MemEntity * MemMap::addEntity(MemEntity * entity)
         next = m_checkIterator->first;
     }
     m_entities[entity->getIntId()] = entity;
+    m_entitiesByType[entity->getType()][entity->getIntId()] = entity;
     m_checkIterator = m_entities.find(next);
 
     if (m_script != 0) {
@@ -80,6 +90,12 @@ void MemMap::readEntity(MemEntity * entity, const RootEntity & ent, double times
         if (entity->getType() == m_entity_type) {
             const TypeNode * type = Inheritance::instance().getType(parent);
             if (type != 0) {
+                // New entities are read before they are added to the map.
+                auto I = m_entities.find(entity->getIntId());
+                if (I != m_entities.end() && I->second == entity) {
+                    m_entitiesByType[entity->getType()].erase(entity->getIntId());
+                    m_entitiesByType[type][entity->getIntId()] = entity;
+                }
                 entity->setType(type);
             }
         } else if (entity->getType()->name() != parent) {
@@ -108,10 +124,55 @@ void MemMap::readEntity(MemEntity * entity, const RootEntity & ent, double times
         }
         entity->m_location.readFromEntity(ent);
         entity->m_location.update(timestamp);
+        if (!m_grids.empty()) {
+            updateGrid(entity, old_loc);
+        }
     }
     addContents(ent);
 }
 
+EntityGrid * MemMap::getGrid(LocatedEntity * place)
+// Get the spatial index of a location, building it if needed
+{
+    auto I = m_grids.find(place);
+    if (I != m_grids.end()) {
+        return &I->second;
+    }
+    // Only locations in this memory can be indexed, as the index is kept
+    // up to date through updates to the memory.
+    auto J = m_entities.find(place->getIntId());
+    if (J == m_entities.end() || J->second != place || place->m_contains == 0) {
+        return nullptr;
+    }
+    EntityGrid & grid = m_grids[place];
+    for (LocatedEntity * child : *place->m_contains) {
+        if (child != 0 && child->m_location.pos().isValid()) {
+            grid.update(child, child->m_location.pos());
+        }
+    }
+    return &grid;
+}
+
+void MemMap::updateGrid(MemEntity * entity, LocatedEntity * old_loc)
+// Keep the spatial indices up to date after an entity has moved
+{
+    LocatedEntity * new_loc = entity->m_location.m_loc;
+    if (old_loc != 0 && old_loc != new_loc) {
+        auto I = m_grids.find(old_loc);
+        if (I != m_grids.end()) {
+            I->second.remove(entity);
+        }
+    }
+    auto I = m_grids.find(new_loc);
+    if (I != m_grids.end()) {
+        if (entity->m_location.pos().isValid()) {
+            I->second.update(entity, entity->m_location.pos());
+        } else {
+            I->second.remove(entity);
+        }
+    }
+}
+
 void MemMap::updateEntity(MemEntity * entity, const RootEntity & ent, double timestamp)
 // Update contents of entity an Atlas message.
 {
@@ -149,7 +210,12 @@ MemEntity * MemMap::newEntity(const std::string & id, long int_id,
     return addEntity(entity);
 }
 
-MemMap::MemMap(Script *& s) : m_checkIterator(m_entities.begin()), m_script(s), m_listener(nullptr)
+MemMap::MemMap(Script *& s) : m_checkIterator(m_entities.begin()),
+                               m_script(s),
+                               m_listener(nullptr),
+                               m_budget(s_defaultBudget),
+                               m_evictionThreshold(s_defaultBudget),
+                               m_reportedEntities(0)
 {
     if (m_entity_type == 0) {
         // m_entity_type = Inheritance::instance().getType("game_entity");
@@ -157,6 +223,14 @@ MemMap::MemMap(Script *& s) : m_checkIterator(m_entities.begin()), m_script(s),
         m_entity_type = new TypeNode("");
         assert(m_entity_type != 0);
     }
+    ++s_statistics.memories;
+}
+
+MemMap::~MemMap()
+{
+    --s_statistics.memories;
+    s_statistics.entities -= m_reportedEntities;
+    s_statistics.pendingRelease -= m_pendingRelease.size();
 }
 
 void MemMap::sendLooks(OpVector & res)
@@ -199,26 +273,9 @@ void MemMap::del(const std::string & id)
         MemEntity * ent = I->second;
         assert(ent != 0);
 
-        //HACK: We currently do refcounting for Locations kept in the mind as knowledge.
-        //The result is that if an entity is removed here, it will be deleted, and any
-        //knowledge or goal referring to it will point to an invalid pointer.
-        //Then result is a segfault whenever the mind is queried.
-        //To prevent this we'll add this interim fix, where we exit from the method.
-        //This is an interim solution until we've better dealt with Locations in goals and knowledge.
-
-        long next = -1;
-        if (m_checkIterator != m_entities.end()) {
-            next = m_checkIterator->first;
-        }
-        m_entities.erase(I);
+        unlink(ent);
 
-        ent->destroy(); // should probably go here, but maybe earlier
-
-        if (next != -1) {
-            m_checkIterator = m_entities.find(next);
-        } else {
-            m_checkIterator = m_entities.begin();
-        }
+        ent->destroy();
 
         if (m_script != 0) {
             std::vector<std::string>::const_iterator J = m_deleteHooks.begin();
@@ -232,10 +289,152 @@ void MemMap::del(const std::string & id)
             m_listener->entityDeleted(*ent);
         }
 
-//        ent->decRef();
+        release(ent);
     }
 }
 
+void MemMap::unlink(MemEntity * ent)
+// Remove an entity from the lookup tables, keeping the check iterator valid
+{
+    long int_id = ent->getIntId();
+
+    long next = -1;
+    if (m_checkIterator != m_entities.end()) {
+        next = m_checkIterator->first;
+        if (next == int_id) {
+            auto N = m_checkIterator;
+            ++N;
+            next = N != m_entities.end() ? N->first : -1;
+        }
+    }
+    m_entities.erase(int_id);
+    auto J = m_entitiesByType.find(ent->getType());
+    if (J != m_entitiesByType.end()) {
+        J->second.erase(int_id);
+        if (J->second.empty()) {
+            m_entitiesByType.erase(J);
+        }
+    }
+
+    if (!m_grids.empty()) {
+        LocatedEntity * loc = ent->m_location.m_loc;
+        if (loc != 0) {
+            auto K = m_grids.find(loc);
+            if (K != m_grids.end()) {
+                if (ent->m_contains != 0 && !ent->m_contains->empty()) {
+                    // The children are moved to the parent, so it has
+                    // to be indexed again.
+                    m_grids.erase(K);
+                } else {
+                    K->second.remove(ent);
+                }
+            }
+        }
+        m_grids.erase(ent);
+    }
+
+    if (next != -1) {
+        m_checkIterator = m_entities.find(next);
+    } else {
+        m_checkIterator = m_entities.begin();
+    }
+}
+
+void MemMap::release(MemEntity * ent)
+// Drop the reference held by this memory on a removed entity
+{
+    // Scripts may still hold on to the entity through its wrapper, which
+    // refers to it by pointer, so it's kept until they let go.
+    if (ent->script() != 0 && ent->script()->isReferenced()) {
+        m_pendingRelease.push_back(ent);
+        ++s_statistics.pendingRelease;
+        return;
+    }
+    ent->decRef();
+}
+
+void MemMap::releasePending()
+{
+    auto end = std::remove_if(m_pendingRelease.begin(), m_pendingRelease.end(), [](MemEntity * ent) {
+        if (ent->script() != 0 && ent->script()->isReferenced()) {
+            return false;
+        }
+        ent->decRef();
+        return true;
+    });
+    s_statistics.pendingRelease -= m_pendingRelease.end() - end;
+    m_pendingRelease.erase(end, m_pendingRelease.end());
+}
+
+bool MemMap::isEvictable(const MemEntity * me) const
+{
+    // Locations which only Python code refers to are fine, as they hold a
+    // reference, but entity wrappers don't.
+    return !me->isVisible() &&
+           (me->m_contains == 0 || me->m_contains->empty()) &&
+           !(me->script() != 0 && me->script()->isReferenced());
+}
+
+void MemMap::evict(MemEntity * me)
+// Forget an entity. Unlike del() this isn't a change in the world, so no
+// script hooks are called.
+{
+    debug(std::cout << me->getId() << "|" << me->getType()->name()
+                    << " is a waste of space" << std::endl << std::flush;);
+    unlink(me);
+    me->destroy();
+    if (m_listener) {
+        m_listener->entityDeleted(*me);
+    }
+    ++s_statistics.evicted;
+    me->decRef();
+}
+
+void MemMap::enforceBudget()
+// Forget the entities which have gone unseen the longest, until the memory
+// is comfortably within budget
+{
+    std::vector<MemEntity *> candidates;
+    for (auto & entry : m_entities) {
+        if (isEvictable(entry.second)) {
+            candidates.push_back(entry.second);
+        }
+    }
+    // Evict a tenth more than needed, so this isn't done on every update.
+    std::size_t target = m_budget - m_budget / 10;
+    std::size_t excess = m_entities.size() > target ? m_entities.size() - target : 0;
+    excess = std::min(excess, candidates.size());
+    if (excess > 0) {
+        std::nth_element(candidates.begin(), candidates.begin() + (excess - 1), candidates.end(),
+                         [](const MemEntity * lhs, const MemEntity * rhs) {
+                             return lhs->lastSeen() < rhs->lastSeen();
+                         });
+        for (std::size_t i = 0; i < excess; ++i) {
+            evict(candidates[i]);
+        }
+    }
+    // If too much is in use to get within budget, wait for the memory to
+    // grow a bit before trying again.
+    if (m_entities.size() > m_budget) {
+        m_evictionThreshold = m_entities.size() + std::max<std::size_t>(m_budget / 10, 1);
+    } else {
+        m_evictionThreshold = m_budget;
+    }
+}
+
+void MemMap::reportStatistics()
+{
+    s_statistics.entities += (int)m_entities.size() - (int)m_reportedEntities;
+    m_reportedEntities = m_entities.size();
+}
+
+void MemMap::setBudget(std::size_t budget)
+{
+    m_budget = budget;
+    m_evictionThreshold = budget;
+}
+
+
 MemEntity * MemMap::get(const std::string & id) const
 // Get an entity from memory
 {
@@ -363,17 +562,46 @@ const std::map<std::string, std::map<std::string, Element>>& MemMap::getEntityRe
 }
 
 
-EntityVector MemMap::findByType(const std::string & what)
+void MemMap::getEntitiesOfTypes(const TypeNode * type, bool includeSubtypes,
+                                std::vector<const MemEntityDict *> & res) const
+{
+    if (!includeSubtypes) {
+        const MemEntityDict * entities = getEntitiesOfType(type);
+        if (entities != nullptr) {
+            res.push_back(entities);
+        }
+        return;
+    }
+    // There are far fewer types than entities in a memory, and checking
+    // a type is cheap once the inheritance tree has been numbered.
+    for (auto & entry : m_entitiesByType) {
+        if (entry.first != nullptr && entry.first->isTypeOf(type)) {
+            res.push_back(&entry.second);
+        }
+    }
+}
+
+EntityVector MemMap::findByType(const std::string & what, bool includeSubtypes)
 // Find an entity in our memory of a certain type
 {
     EntityVector res;
-    
-    MemEntityDict::const_iterator Iend = m_entities.end();
-    for (MemEntityDict::const_iterator I = m_entities.begin(); I != Iend; ++I) {
-        MemEntity * item = I->second;
-        debug( std::cout << "F" << what << ":" << item->getType() << ":" << item->getId() << std::endl << std::flush;);
-        if (item->isVisible() && item->getType()->name() == what) {
-            res.push_back(I->second);
+
+    // Resolve the name once, so each entity is matched on the node rather
+    // than by comparing type names.
+    const TypeNode * type = Inheritance::instance().getType(what);
+    if (type == nullptr) {
+        return res;
+    }
+
+    std::vector<const MemEntityDict *> groups;
+    getEntitiesOfTypes(type, includeSubtypes, groups);
+    for (const MemEntityDict * entities : groups) {
+        for (auto & entry : *entities) {
+            MemEntity * item = entry.second;
+            debug( std::cout << "F" << what << ":" << item->getType() << ":" << item->getId() << std::endl << std::flush;);
+            if (item->isVisible()) {
+                res.push_back(item);
+            }
         }
     }
     return res;
@@ -381,7 +609,8 @@ EntityVector MemMap::findByType(const std::string & what)
 
 EntityVector MemMap::findByLocation(const Location & loc,
                                        WFMath::CoordType radius,
-                                       const std::string & what)
+                                       const std::string & what,
+                                       bool sort)
 // Find an entity in our memory in a certain place
 // FIXME Don't return by value
 {
@@ -400,28 +629,64 @@ EntityVector MemMap::findByLocation(const Location & loc,
         return res;
     }
 #endif // NDEBUG
-    LocatedEntitySet::const_iterator I = place->m_contains->begin();
-    LocatedEntitySet::const_iterator Iend = place->m_contains->end();
+    const TypeNode * type = Inheritance::instance().getType(what);
+    if (type == nullptr) {
+        return res;
+    }
+    findInRange(loc, radius, type, res, sort);
+    return res;
+}
+
+void MemMap::findInRange(const Location & where,
+                         WFMath::CoordType radius,
+                         const TypeNode * type,
+                         EntityVector & res,
+                         bool sort)
+{
+    LocatedEntity * place = where.m_loc;
+    if (place == 0 || place->m_contains == 0) {
+        return;
+    }
+    const Point3D & pos = where.pos();
+
+    // Gather the candidates at the end of the result, and then filter
+    // them in place.
+    auto first = res.size();
+    EntityGrid * grid = getGrid(place);
+    if (grid != nullptr) {
+        grid->collect(pos, radius, res);
+    } else {
+        res.insert(res.end(), place->m_contains->begin(), place->m_contains->end());
+    }
+
     float square_range = radius * radius;
-    for (; I != Iend; ++I) {
-        assert(*I != 0);
-        LocatedEntity * item = *I;
+    auto end = std::remove_if(res.begin() + first, res.end(), [&](LocatedEntity * item) {
         if (item == 0) {
             log(ERROR, "Weird entity in memory");
-            continue;
-        }
-        if (!item->isVisible() || item->getType()->name() != what) {
-            continue;
+            return true;
         }
-        if (squareDistance(loc.pos(), item->m_location.pos()) < square_range) {
-            res.push_back(item);
+        if (!item->isVisible() || (type != nullptr && item->getType() != type)) {
+            return true;
         }
+        return !(squareDistance(pos, item->m_location.pos()) < square_range);
+    });
+    res.erase(end, res.end());
+
+    if (sort) {
+        std::sort(res.begin() + first, res.end(), [&](LocatedEntity * lhs, LocatedEntity * rhs) {
+            return squareDistance(pos, lhs->m_location.pos()) < squareDistance(pos, rhs->m_location.pos());
+        });
     }
-    return res;
 }
 
 void MemMap::check(const double & time)
 {
+    if (!m_pendingRelease.empty()) {
+        releasePending();
+    }
+    if (m_budget != 0 && m_entities.size() > m_evictionThreshold) {
+        enforceBudget();
+    }
 
     MemEntityDict::const_iterator entities_end = m_entities.end();
     if (m_checkIterator == entities_end) {
@@ -429,60 +694,46 @@ void MemMap::check(const double & time)
     } else {
         MemEntity * me = m_checkIterator->second;
         assert(me != 0);
-        if (!me->isVisible() && (time - me->lastSeen()) > 600 &&
-            (me->m_contains == 0 || me->m_contains->empty())) {
-            //Don't remove any entities; we need to instead implement reference counted locations
-//            debug(std::cout << me->getId() << "|" << me->getType()->name()
-//                      << " is a waste of space" << std::endl << std::flush;);
-//            MemEntityDict::const_iterator J = m_checkIterator;
-//            long next = -1;
-//            if (++J != entities_end) {
-//                next = J->first;
-//            }
-//            m_entities.erase(m_checkIterator);
-//            // Remove deleted entity from its parents contains attribute
-//            if (me->m_location.m_loc != 0) {
-//                assert(me->m_location.m_loc->m_contains != 0);
-//                me->m_location.m_loc->m_contains->erase(me);
-//            }
-//
-//            // FIXME This is required until MemMap uses parent refcounting
-//            me->m_location.m_loc = 0;
-//
-//            if (next != -1) {
-//                m_checkIterator = m_entities.find(next);
-//            } else {
-//                m_checkIterator = m_entities.begin();
-//            }
-            //HACK: We currently do refcounting for Locations kept in the mind as knowledge.
-            //The result is that if an entity is removed here, it will be deleted, and any
-            //knowledge or goal referring to it will point to an invalid pointer.
-            //Then result is a segfault whenever the mind is queried.
-            //To prevent this we'll add this interim fix, where we won't decrease the reference.
-            //This is an interim solution until we've better dealt with Locations in goals and knowledge.
-
-            // attribute of its its parent.
-            //me->decRef();
+        ++m_checkIterator;
+        if (m_budget != 0 && isEvictable(me) &&
+            (time - me->lastSeen()) > forget_time) {
+            evict(me);
         } else {
             debug(std::cout << me->getId() << "|" << me->getType()->name() << "|"
                             << me->lastSeen() << "|" << me->isVisible()
                             << " is fine" << std::endl << std::flush;);
-            ++m_checkIterator;
         }
     }
+    reportStatistics();
 }
 
 void MemMap::flush()
 {
     debug(std::cout << "Flushing memory with " << m_entities.size()
                     << " memories" << std::endl << std::flush;);
-    
-    MemEntityDict::const_iterator Iend = m_entities.end();
-    for (MemEntityDict::const_iterator I = m_entities.begin(); I != Iend; ++I) {
-        // FIXME This is required until MemMap uses parent refcounting
-        I->second->m_location.m_loc = 0;
-        I->second->decRef();
+    m_grids.clear();
+
+    // Parents aren't reference counted by their children in memory, and
+    // entities held by scripts may outlive the memory, so the links
+    // between entities are dropped first.
+    for (auto & entry : m_entities) {
+        entry.second->m_location.m_loc = 0;
+        if (entry.second->m_contains != 0) {
+            entry.second->m_contains->clear();
+        }
+    }
+    for (auto & entry : m_entities) {
+        entry.second->decRef();
+    }
+    m_entities.clear();
+    m_entitiesByType.clear();
+    m_checkIterator = m_entities.begin();
+    for (MemEntity * ent : m_pendingRelease) {
+        ent->decRef();
     }
+    s_statistics.pendingRelease -= m_pendingRelease.size();
+    m_pendingRelease.clear();
+    reportStatistics();
 }
 
 void MemMap::setListener(MapListener* listener)
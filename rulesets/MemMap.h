@@ -19,6 +19,8 @@
 #ifndef RULESETS_MEM_MAP_H
 #define RULESETS_MEM_MAP_H
 
+#include "EntityGrid.h"
+
 #include "common/OperationRouter.h"
 
 #include <Atlas/Objects/ObjectsFwd.h>
@@ -29,6 +31,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 class LocatedEntity;
 class Location;
@@ -50,12 +53,39 @@ class MemMap {
         virtual void entityDeleted(const MemEntity& entity) = 0;
     };
 
+    /// \brief Statistics for the memories of all minds, for the monitors
+    struct Statistics {
+        /// \brief Number of memories
+        int memories = 0;
+        /// \brief Number of entities remembered
+        int entities = 0;
+        /// \brief Number of entities forgotten, as they weren't seen for
+        /// a long time or to stay within the budget
+        int evicted = 0;
+        /// \brief Number of removed entities still referenced by scripts
+        int pendingRelease = 0;
+    };
+
+    static Statistics s_statistics;
+
+    /// \brief Budget of new memories, as a number of entities
+    ///
+    /// Zero means that there's no limit.
+    static std::size_t s_defaultBudget;
+
   protected:
     friend class BaseMind;
 
     static const TypeNode * m_entity_type;
 
     MemEntityDict m_entities;
+    /// \brief The entities in m_entities, grouped by their type
+    std::map<const TypeNode *, MemEntityDict> m_entitiesByType;
+    /// \brief Spatial indices of the children of locations
+    ///
+    /// A location is indexed the first time it's searched, and is kept up
+    /// to date from then on as the entities in it move.
+    std::map<const LocatedEntity *, EntityGrid> m_grids;
     MemEntityDict::iterator m_checkIterator;
     std::list<std::string> m_additionsById;
     std::vector<std::string> m_addHooks;
@@ -65,6 +95,16 @@ class MemMap {
 
     MapListener* m_listener;
 
+    /// \brief Max number of entities to remember, or zero for no limit
+    std::size_t m_budget;
+    /// \brief Number of entities at which the budget is next enforced
+    std::size_t m_evictionThreshold;
+    /// \brief Number of entities last added to s_statistics
+    std::size_t m_reportedEntities;
+    /// \brief Removed entities which can't be released yet, as scripts
+    /// still refer to them
+    std::vector<MemEntity *> m_pendingRelease;
+
     ///\brief a map that holds memories related to other entities.
     ///@key - ID of the entity to which we relate memories
     ///@value - Element of map type containing name of a memory as a key
@@ -78,9 +118,19 @@ class MemMap {
                           const Atlas::Objects::Entity::RootEntity &, double timestamp);
     void addContents(const Atlas::Objects::Entity::RootEntity &);
     MemEntity * addId(const std::string &, long);
+    EntityGrid * getGrid(LocatedEntity * place);
+    void updateGrid(MemEntity * entity, LocatedEntity * old_loc);
+    void unlink(MemEntity * entity);
+    void release(MemEntity * entity);
+    void releasePending();
+    bool isEvictable(const MemEntity * entity) const;
+    void evict(MemEntity * entity);
+    void enforceBudget();
+    void reportStatistics();
   public:
 
     explicit MemMap(Script *& s);
+    ~MemMap();
 
     bool find(const std::string & id) const;
 
@@ -92,6 +142,27 @@ class MemMap {
         return m_entities;
     }
 
+    /// \brief Get all entities of an exact type
+    ///
+    /// @return the entities, or nullptr if there are none of the type
+    const MemEntityDict * getEntitiesOfType(const TypeNode * type) const {
+        auto I = m_entitiesByType.find(type);
+        if (I == m_entitiesByType.end()) {
+            return nullptr;
+        }
+        return &I->second;
+    }
+
+    /// \brief Get all entities of a type, or of any type inheriting from it
+    ///
+    /// Only the types of remembered entities are checked against the base
+    /// type, so this doesn't depend on the number of entities.
+    ///
+    /// @param includeSubtypes if false, only entities of the exact type are found
+    /// @param res the entities of each matching type are appended to this
+    void getEntitiesOfTypes(const TypeNode * type, bool includeSubtypes,
+                            std::vector<const MemEntityDict *> & res) const;
+
     void sendLooks(OpVector &);
     void del(const std::string & id);
     MemEntity * get(const std::string & id) const;
@@ -117,10 +188,28 @@ class MemMap {
     ///\brief m_entityRelatedMemory accessor
         const std::map<std::string, std::map<std::string, Atlas::Message::Element>>& getEntityRelatedMemory() const;
 
-    EntityVector findByType(const std::string & what);
+    /// \brief Find the visible entities of a type
+    ///
+    /// @param includeSubtypes true if entities of types inheriting from the
+    /// type should be found too
+    EntityVector findByType(const std::string & what, bool includeSubtypes = false);
     EntityVector findByLocation(const Location & where,
                                 WFMath::CoordType radius,
-                                const std::string & what);
+                                const std::string & what,
+                                bool sort = false);
+
+    /// \brief Find the visible entities in a location within a radius
+    ///
+    /// @param where the location searched, and the position searched around
+    /// @param type if not null, only entities of this exact type are found
+    /// @param res the entities found are appended to this
+    /// @param sort true if the entities found should be ordered by distance,
+    /// closest first
+    void findInRange(const Location & where,
+                     WFMath::CoordType radius,
+                     const TypeNode * type,
+                     EntityVector & res,
+                     bool sort = false);
 
     void check(const double &);
     void flush();
@@ -131,6 +220,17 @@ class MemMap {
 
     void setListener(MapListener* listener);
 
+    /// \brief Set the max number of entities to remember
+    ///
+    /// When there are more, the entities which have gone unseen the longest
+    /// are forgotten, as long as they have no children and aren't used by
+    /// scripts. Zero means that there's no limit.
+    void setBudget(std::size_t budget);
+
+    std::size_t getBudget() const {
+        return m_budget;
+    }
+
     friend class MemMaptest;
     friend class BaseMindMapEntityintegration;
 };
@@ -42,8 +42,9 @@ void ModeProperty::apply(LocatedEntity *entity)
         const QuaternionProperty* plantedRotation = entity->getPropertyClass<QuaternionProperty>("planted-rotation");
         if (plantedRotation && plantedRotation->data().isValid()) {
             //Check that the rotation is applied already, otherwise apply it.
-            QuaternionProperty* activeRotationProp = entity->requirePropertyClass<QuaternionProperty>("active-rotation");
-            if (activeRotationProp->data() != plantedRotation->data()) {
+            const QuaternionProperty* activeRotationRead = entity->getPropertyClass<QuaternionProperty>("active-rotation");
+            if (activeRotationRead == nullptr || activeRotationRead->data() != plantedRotation->data()) {
+                QuaternionProperty* activeRotationProp = entity->requirePropertyClass<QuaternionProperty>("active-rotation");
                 WFMath::Quaternion currentOrientation = entity->m_location.orientation();
 
                 if (activeRotationProp->data().isValid() && activeRotationProp->data() != WFMath::Quaternion::Identity()) {
@@ -76,8 +77,9 @@ void ModeProperty::apply(LocatedEntity *entity)
         }
     } else {
         if (entity->hasAttr("active-rotation")) {
-            QuaternionProperty* activeRotationProp = entity->modPropertyClass<QuaternionProperty>("active-rotation");
-            if (activeRotationProp->data().isValid()) {
+            const QuaternionProperty* activeRotationRead = entity->getPropertyClass<QuaternionProperty>("active-rotation");
+            if (activeRotationRead && activeRotationRead->data().isValid()) {
+                QuaternionProperty* activeRotationProp = entity->modPropertyClass<QuaternionProperty>("active-rotation");
                 WFMath::Quaternion currentOrientation = entity->m_location.orientation();
 
                 WFMath::Quaternion rotation = activeRotationProp->data().inverse();
@@ -110,6 +112,11 @@ ModeProperty * ModeProperty::copy() const
     return new ModeProperty(*this);
 }
 
+PropertyTypeId ModeProperty::typeId() const
+{
+    return propertyTypeId<ModeProperty>();
+}
+
 void ModeProperty::set(const Atlas::Message::Element & val)
 {
     Property<std::string>::set(val);
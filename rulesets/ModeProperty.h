@@ -78,6 +78,7 @@ class ModeProperty : public Property<std::string>
         void apply(LocatedEntity*) override;
 
         ModeProperty* copy() const override;
+        PropertyTypeId typeId() const override;
 
         void set(const Atlas::Message::Element& val) override;
 
@@ -174,6 +174,11 @@ OutfitProperty * OutfitProperty::copy() const
     return new OutfitProperty(*this);
 }
 
+PropertyTypeId OutfitProperty::typeId() const
+{
+    return propertyTypeId<OutfitProperty>();
+}
+
 LocatedEntity* OutfitProperty::getEntity(const std::string& key) const
 {
     auto iter = m_data.find(key);
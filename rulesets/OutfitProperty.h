@@ -66,6 +66,7 @@ class OutfitProperty : public PropertyBase, virtual public sigc::trackable {
     void add(const std::string & key, Atlas::Message::MapType & map) const override;
     void add(const std::string & key, const Atlas::Objects::Entity::RootEntity & ent) const override;
     OutfitProperty * copy() const;
+    PropertyTypeId typeId() const override;
 
     //\brief Get a pointer to the entity at a given key of outfit
     //null pointer is returned if there is no entity at a given key
@@ -63,6 +63,9 @@
 
 static const bool debug_flag = false;
 
+static const PropertyKey FRICTION_KEY(PropertyKey::key_friction);
+static const PropertyKey MASS_KEY(PropertyKey::key_mass);
+
 using Atlas::Message::Element;
 using Atlas::Message::MapType;
 using Atlas::Objects::Root;
@@ -341,7 +344,7 @@ void PhysicalDomain::buildTerrainPages()
     boost::optional<float> spinningFriction;
 
     {
-        auto frictionProp = m_entity.getPropertyType<double>("friction");
+        auto frictionProp = m_entity.getPropertyType<double>(FRICTION_KEY);
 
         if (frictionProp) {
             friction = (float) frictionProp->data();
@@ -696,7 +699,7 @@ float PhysicalDomain::getMassForEntity(const LocatedEntity& entity) const
 {
     float mass = 0;
 
-    auto massProp = entity.getPropertyType<double>("mass");
+    auto massProp = entity.getPropertyType<double>(MASS_KEY);
     if (massProp) {
         mass = (float) massProp->data();
     }
@@ -806,7 +809,7 @@ void PhysicalDomain::addEntity(LocatedEntity& entity)
 
             btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(mass, nullptr, entry->collisionShape, inertia);
 
-            auto frictionProp = entity.getPropertyType<double>("friction");
+            auto frictionProp = entity.getPropertyType<double>(FRICTION_KEY);
             if (frictionProp) {
                 rigidBodyCI.m_friction = (btScalar) frictionProp->data();
             }
@@ -1572,7 +1575,7 @@ void PhysicalDomain::applyVelocity(BulletEntry& entry, const WFMath::Vector<3>&
 
                     rigidBody->setLinearVelocity(bodyVelocity);
                     double friction = 1.0; //Default to 1 if no "friction" prop is present.
-                    auto frictionProp = entity->getPropertyType<double>("friction");
+                    auto frictionProp = entity->getPropertyType<double>(FRICTION_KEY);
                     if (frictionProp) {
                         friction = frictionProp->data();
                     }
@@ -1688,7 +1691,7 @@ void PhysicalDomain::processDirtyTerrainAreas()
     m_dirtyTerrainAreas.clear();
 
     boost::optional<float> friction;
-    auto frictionProp = m_entity.getPropertyType<double>("friction");
+    auto frictionProp = m_entity.getPropertyType<double>(FRICTION_KEY);
     if (frictionProp) {
         friction = (float) frictionProp->data();
     }
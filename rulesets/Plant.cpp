@@ -23,11 +23,14 @@
 #include "AreaProperty.h"
 #include "DensityProperty.h"
 #include "Vector3Property.h"
+#include "Script.h"
 #include "physics/Shape.h"
 
+#include "common/BaseWorld.h"
 #include "common/const.h"
 #include "common/debug.h"
 #include "common/random.h"
+#include "common/SystemScheduler.h"
 #include "common/TypeNode.h"
 
 #include "common/Eat.h"
@@ -113,11 +116,39 @@ void Plant::TickOperation(const Operation & op, OpVector & res)
     WFMath::MTRand::instance.seed(getIntId());
     double jitter = WFMath::MTRand::instance.rand() * 10.;
 
+    SystemScheduler * systems = BaseWorld::instance().getSystems();
+    // A script which handles Tick relies on the Tick chain to be called
+    // again, so such plants keep it.
+    if (systems != nullptr &&
+        (m_script == nullptr || !m_script->handlesOperation(op->getParent(), op->getClassNo()))) {
+        // Growth of all plants is run in one batch by the world, so the
+        // Tick only needs to add this plant to it. The jitter picks the
+        // slice, so that plants don't all grow at the same moment.
+        int growth = systems->addSystem("plant_growth",
+                                        consts::basic_tick * m_speed,
+                                        [](LocatedEntity & entity, OpVector & res) {
+                                            static_cast<Plant &>(entity).grow(res);
+                                        },
+                                        m_growthSlices);
+        if (systems->addEntity(growth, *this, (int)jitter)) {
+            grow(res);
+        }
+        return;
+    }
+
     Tick tick_op;
     tick_op->setTo(getId());
     tick_op->setFutureSeconds(consts::basic_tick * m_speed + jitter);
     res.push_back(tick_op);
 
+    grow(res);
+}
+
+/// \brief Grow or wither depending on nourishment, and handle fruiting.
+///
+/// Called once every m_speed basic ticks.
+void Plant::grow(OpVector & res)
+{
     // The update op will broadcast notification for all properties that
     // are marked flag_unsent
     Update update;
@@ -267,16 +298,16 @@ void Plant::TickOperation(const Operation & op, OpVector & res)
     }
 
 
-    //Only handle fruits if the plant is of adult size.
-    Property<int> * fruits_prop = modPropertyType<int>("fruits");
-    if (fruits_prop != nullptr) {
+    //Only handle fruits if the plant is of adult size. The fruits property
+    //is only made an instance property once the plant can actually fruit.
+    if (getPropertyType<int>("fruits") != nullptr) {
         Element sizeAdult;
         if (getAttrType("sizeAdult", sizeAdult, Element::TYPE_FLOAT) == 0 ||
                 getAttrType("sizeAdult", sizeAdult, Element::TYPE_INT) == 0) {
             //Only drop fruits if we're an adult
             if (m_location.bBox().isValid() &&
                     (m_location.bBox().highCorner().y() >= sizeAdult.asNum())) {
-                handleFruiting(res, *fruits_prop);
+                handleFruiting(res, *modPropertyType<int>("fruits"));
             }
         }
     }
@@ -324,9 +355,9 @@ void Plant::TouchOperation(const Operation & op, OpVector & res)
         if (m_location.bBox().isValid()
                 && (m_location.bBox().highCorner().y() >= sizeAdult.asNum())) {
 
-            Property<int> * fruits_prop = modPropertyType<int>("fruits");
-            if (fruits_prop != nullptr) {
-                if (fruits_prop->data() <= 0) {
+            const Property<int> * fruits_read = getPropertyType<int>("fruits");
+            if (fruits_read != nullptr) {
+                if (fruits_read->data() <= 0) {
                     return;
                 }
                 Element fruitName;
@@ -339,6 +370,7 @@ void Plant::TouchOperation(const Operation & op, OpVector & res)
                 }
                 //TODO: use a different attribute than fruitChance for this
                 if (randint(0, 100) < fruitsChance.Int()) {
+                    Property<int> * fruits_prop = modPropertyType<int>("fruits");
                     fruits_prop->data()--;
                     fruits_prop->setFlags(flag_unsent);
                     dropFruit(res, fruitName.String());
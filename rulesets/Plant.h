@@ -62,7 +62,9 @@ class Plant : public Thing {
     static const int m_speed = 20; // Number of basic_ticks per tick
     static const int m_minuDrop = 0; // min fruit dropped
     static const int m_maxuDrop = 2; // max fruit dropped
+    static const int m_growthSlices = 10; // slices of the growth system, one per second of jitter
 
+    void grow(OpVector & res);
     void handleFruiting(OpVector & res, Property<int>& fruits_prop);
     void dropFruit(OpVector & res, const std::string& fruitName);
     /**
@@ -76,3 +76,8 @@ PropelProperty * PropelProperty::copy() const
     return new PropelProperty(*this);
 }
 
+PropertyTypeId PropelProperty::typeId() const
+{
+    return propertyTypeId<PropelProperty>();
+}
+
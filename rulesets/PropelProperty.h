@@ -51,6 +51,7 @@ class PropelProperty: public PropertyBase {
                          const Atlas::Objects::Entity::RootEntity & ent) const override;
 
         PropelProperty * copy() const override;
+        PropertyTypeId typeId() const override;
     protected:
         WFMath::Vector<3> mData;
 };
@@ -8,19 +8,29 @@ PyObject * get_filter(PyObject * self, PyObject* query){
                     return nullptr;
         }
         char * query_str = PyString_AsString(query);
-        PyFilter* f = newPyFilter();
+        std::shared_ptr<EntityFilter::Filter> filter;
         try {
-            //FIXME: creating and accessing an instance of a factory should be done in a better way
-            EntityFilter::MindProviderFactory factory;
-            f->m_filter = new EntityFilter::Filter(query_str, &factory);
+            filter = filter_cache().get(query_str);
         }
         catch (std::invalid_argument& e){
             PyErr_SetString(PyExc_TypeError, String::compose("Invalid query for Entity Filter: %1", e.what()).c_str());
             return nullptr;
         }
+        PyFilter* f = newPyFilter();
+        if (f != nullptr) {
+            f->m_filter = filter;
+        }
         return (PyObject*)f;
 }
 
+EntityFilter::FilterCache & filter_cache()
+{
+    //FIXME: creating and accessing an instance of a factory should be done in a better way
+    static EntityFilter::MindProviderFactory factory;
+    static EntityFilter::FilterCache cache(factory);
+    return cache;
+}
+
 ///\brief Match a single entity using a filter that called this method.
 static PyObject * match_entity(PyFilter * self, PyObject * py_entity)
 {
@@ -37,7 +47,7 @@ static PyObject * match_entity(PyFilter * self, PyObject * py_entity)
     //Not sure if this is safest or the most correct way to get an entity pointer
     LocatedEntity* entity = ((PyEntity*)py_entity)->m_entity.l;
 
-    EntityFilter::Filter* filter = self->m_filter;
+    EntityFilter::Filter* filter = self->m_filter.get();
 
     if (entity && filter->match(*entity)) {
         Py_INCREF(Py_True);
@@ -80,9 +90,13 @@ PyObject* search_contains(PyFilter* self, PyEntity* py_entity){
 
     std::vector<LocatedEntity*> res;
 
+    ++filter_cache().queries;
     for (;iter != iter_end; ++iter){
-        if((**iter).isVisible() && self->m_filter->match(**iter)){
-            res.push_back(*iter);
+        if((**iter).isVisible()){
+            ++filter_cache().candidates;
+            if (self->m_filter->match(**iter)) {
+                res.push_back(*iter);
+            }
         }
     }
 
@@ -105,11 +119,18 @@ PyObject* search_contains(PyFilter* self, PyEntity* py_entity){
     return list;
 }
 
-static void Filter_dealloc(PyFilter *self)
+static PyObject * Filter_new(PyTypeObject * type, PyObject *, PyObject *)
 {
-    if (self->m_filter != nullptr) {
-        delete self->m_filter;
+    PyFilter * self = (PyFilter *)type->tp_alloc(type, 0);
+    if (self != nullptr) {
+        new (&(self->m_filter)) std::shared_ptr<EntityFilter::Filter>();
     }
+    return (PyObject *)self;
+}
+
+static void Filter_dealloc(PyFilter *self)
+{
+    self->m_filter.~shared_ptr();
     self->ob_type->tp_free((PyObject*)self);
 }
 
@@ -159,7 +180,7 @@ PyTypeObject PyFilter_Type = {
         0,                              // tp_dictoffset
         0,                              // tp_init
         0,                              // tp_alloc
-        0,                              // tp_new
+        Filter_new,                     // tp_new
 };
 
 PyFilter* newPyFilter(){
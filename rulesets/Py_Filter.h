@@ -4,6 +4,9 @@
 #include <Python.h>
 
 #include "entityfilter/Filter.h"
+#include "entityfilter/FilterCache.h"
+
+#include <memory>
 
 
 class Filter;
@@ -12,8 +15,8 @@ PyObject* get_filter(PyObject* self, PyObject* query);
 /// \ingroup PythonWrappers
 typedef struct {
     PyObject_HEAD
-    /// \brief Filter object handled by this wrapper
-    EntityFilter::Filter * m_filter;
+    /// \brief Filter object handled by this wrapper, shared with the filter cache
+    std::shared_ptr<EntityFilter::Filter> m_filter;
 } PyFilter;
 
 extern PyTypeObject PyFilter_Type;
@@ -22,4 +25,7 @@ extern PyTypeObject PyFilter_Type;
 
 PyFilter * newPyFilter();
 
+/// \brief The cache of filters created by scripts
+EntityFilter::FilterCache & filter_cache();
+
 #endif // RULESETS_PY_FILTER_H
@@ -0,0 +1,117 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef RULESETS_PY_FREE_LIST_H
+#define RULESETS_PY_FREE_LIST_H
+
+#include <Python.h>
+
+#include <vector>
+
+/// \brief Base of the free lists of Python wrapper objects
+///
+/// All free lists register themselves, so that their counters can be
+/// monitored and their memory released when Python is shut down.
+class PyFreeListBase {
+  protected:
+    explicit PyFreeListBase(const char * name) : m_name(name)
+    {
+        registry().push_back(this);
+    }
+
+    const char * m_name;
+  public:
+    /// \brief Number of objects allocated from the Python allocator
+    int allocations = 0;
+    /// \brief Number of objects taken from the free list instead
+    int reuses = 0;
+
+    virtual ~PyFreeListBase() = default;
+
+    const char * name() const {
+        return m_name;
+    }
+
+    /// \brief Return all objects in the free list to the Python allocator
+    virtual void clear() = 0;
+
+    static std::vector<PyFreeListBase *> & registry()
+    {
+        static std::vector<PyFreeListBase *> free_lists;
+        return free_lists;
+    }
+};
+
+/// \brief Free list of released Python wrapper objects of one C type
+///
+/// Only objects of the exact types given by the wrapper are pooled, as
+/// objects of Python subclasses have a different size and layout. The
+/// wrapper constructs and destroys the C++ members itself, the free list
+/// only holds the memory.
+template <typename T>
+class PyFreeList : public PyFreeListBase {
+  protected:
+    std::vector<T *> m_free;
+    const std::size_t m_max;
+  public:
+    explicit PyFreeList(const char * name, std::size_t max = 1024) :
+        PyFreeListBase(name), m_max(max)
+    {
+    }
+
+    /// \brief Allocate an object of the given type
+    ///
+    /// @param pooled whether the type is one which can be pooled
+    T * alloc(PyTypeObject * type, bool pooled)
+    {
+        if (pooled && !m_free.empty()) {
+            T * self = m_free.back();
+            m_free.pop_back();
+            ++reuses;
+            return (T *)PyObject_INIT(self, type);
+        }
+        ++allocations;
+        return (T *)type->tp_alloc(type, 0);
+    }
+
+    /// \brief Release an object whose members have been destroyed
+    ///
+    /// @param pooled whether the type is one which can be pooled
+    void release(T * self, bool pooled)
+    {
+        if (pooled && m_free.size() < m_max) {
+            m_free.push_back(self);
+            return;
+        }
+        Py_TYPE(self)->tp_free((PyObject *)self);
+    }
+
+    void clear() override
+    {
+        for (T * self : m_free) {
+            PyObject_Del(self);
+        }
+        m_free.clear();
+    }
+
+    std::size_t size() const {
+        return m_free.size();
+    }
+};
+
+#endif // RULESETS_PY_FREE_LIST_H
@@ -17,6 +17,7 @@
 
 
 #include "Py_Location.h"
+#include "Py_FreeList.h"
 #include "Py_Thing.h"
 #include "Py_Vector3D.h"
 #include "Py_Point3D.h"
@@ -41,6 +42,9 @@ static PyObject * Location_copy(PyLocation *self)
         ret->location = new Location(self->location->m_loc,
                                      self->location->pos(),
                                      self->location->velocity());
+        if (ret->location->m_loc != nullptr) {
+            ret->location->m_loc->incRef();
+        }
     }
     return (PyObject *)ret;
 }
@@ -50,12 +54,22 @@ static PyMethodDef Location_methods[] = {
     {nullptr,              nullptr}           /* sentinel */
 };
 
+static PyFreeList<PyLocation> location_free_list("Location");
+
+/// Locations held by scripts keep a reference to the entity they refer to,
+/// so that entities forgotten by a mind stay valid while in use. Locations
+/// of entities keep a reference to the entity instead.
 static void Location_dealloc(PyLocation *self)
 {
-    if (self->owner == 0 && self->location != nullptr) {
+    if (self->owner != 0) {
+        self->owner->decRef();
+    } else if (self->location != nullptr) {
+        if (self->location->m_loc != nullptr) {
+            self->location->m_loc->decRef();
+        }
         delete self->location;
     }
-    self->ob_type->tp_free((PyObject*)self);
+    location_free_list.release(self, self->ob_type == &PyLocation_Type);
 }
 
 static PyObject * Location_getattro(PyLocation *self, PyObject *oname)
@@ -134,6 +148,12 @@ static int Location_setattro(PyLocation *self, PyObject *oname, PyObject *v)
             return -1;
         }
 #endif // NDEBUG
+        if (self->owner == 0) {
+            thing->m_entity.l->incRef();
+            if (self->location->m_loc != nullptr) {
+                self->location->m_loc->decRef();
+            }
+        }
         self->location->m_loc = thing->m_entity.l;
         return 0;
     }
@@ -259,6 +279,9 @@ static int Location_init(PyLocation * self, PyObject * args, PyObject * kwds)
             ref_ent = ref->m_entity.l;
         }
     }
+    if (ref_ent != nullptr) {
+        ref_ent->incRef();
+    }
     if (coords == nullptr) {
         self->location = new Location(ref_ent);
     } else {
@@ -271,7 +294,7 @@ static PyObject * Location_new(PyTypeObject * type, PyObject *, PyObject *)
 {
     // This looks allot like the default implementation, except we call the
     // in-place constructor.
-    PyLocation * self = (PyLocation *)type->tp_alloc(type, 0);
+    PyLocation * self = location_free_list.alloc(type, type == &PyLocation_Type);
     if (self != nullptr) {
         self->location = nullptr;
         self->owner = 0;
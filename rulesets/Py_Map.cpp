@@ -28,6 +28,8 @@
 #include "MemMap.h"
 #include "Script.h"
 
+#include <algorithm>
+
 using Atlas::Objects::Root;
 using Atlas::Objects::Factories;
 using Atlas::Objects::Entity::RootEntity;
@@ -43,7 +45,8 @@ static PyObject * Map_find_by_location(PyMap * self, PyObject * args)
     PyObject * where_obj;
     double radius;
     char * type;
-    if (!PyArg_ParseTuple(args, "Ods", &where_obj, &radius, &type)) {
+    int sort = 0;
+    if (!PyArg_ParseTuple(args, "Ods|i", &where_obj, &radius, &type, &sort)) {
         return nullptr;
     }
     if (!PyLocation_Check(where_obj)) {
@@ -56,7 +59,7 @@ static PyObject * Map_find_by_location(PyMap * self, PyObject * args)
         return nullptr;
     }
     EntityVector res = self->m_map->findByLocation(*where->location,
-                                                   radius, type);
+                                                   radius, type, sort != 0);
     PyObject * list = PyList_New(res.size());
     if (list == nullptr) {
         return nullptr;
@@ -74,7 +77,7 @@ static PyObject * Map_find_by_location(PyMap * self, PyObject * args)
     return list;
 }
 
-static PyObject * Map_find_by_type(PyMap * self, PyObject * py_what)
+static PyObject * Map_find_by_type(PyMap * self, PyObject * args)
 {
 #ifndef NDEBUG
     if (self->m_map == nullptr) {
@@ -82,12 +85,12 @@ static PyObject * Map_find_by_type(PyMap * self, PyObject * py_what)
         return nullptr;
     }
 #endif // NDEBUG
-    if (!PyString_CheckExact(py_what)) {
-        PyErr_SetString(PyExc_TypeError, "Map.find_by_type must be string");
+    char * what;
+    int include_subtypes = 0;
+    if (!PyArg_ParseTuple(args, "s|i", &what, &include_subtypes)) {
         return nullptr;
     }
-    char * what = PyString_AsString(py_what);
-    EntityVector res = self->m_map->findByType(std::string(what));
+    EntityVector res = self->m_map->findByType(std::string(what), include_subtypes != 0);
     PyObject * list = PyList_New(res.size());
     if (list == nullptr) {
         return nullptr;
@@ -287,11 +290,25 @@ static PyObject * Map_find_by_filter(PyMap* self, PyObject* filter){
     }
     PyFilter* f = (PyFilter*)filter;
 
-    auto iter_begin = self->m_map->getEntities().begin();
-    auto iter_end = self->m_map->getEntities().end();
-    for (; iter_begin != iter_end; ++iter_begin){
-        if (f->m_filter->match(*iter_begin->second)){
-            res.push_back(iter_begin->second);
+    //If the query requires a type, or a base type, only entities of those types need to be matched.
+    std::vector<const MemEntityDict*> candidates;
+    const EntityFilter::Program& program = f->m_filter->program();
+    if (const TypeNode* type = program.requiredType()) {
+        self->m_map->getEntitiesOfTypes(type, false, candidates);
+    } else if (const TypeNode* baseType = program.requiredBaseType()) {
+        self->m_map->getEntitiesOfTypes(baseType, true, candidates);
+    } else {
+        candidates.push_back(&self->m_map->getEntities());
+    }
+
+    EntityFilter::FilterCache& cache = filter_cache();
+    ++cache.queries;
+    for (const MemEntityDict* entities : candidates) {
+        cache.candidates += entities->size();
+        for (auto& entry : *entities) {
+            if (f->m_filter->match(*entry.second)) {
+                res.push_back(entry.second);
+            }
         }
     }
     PyObject * list = PyList_New(res.size());
@@ -323,7 +340,8 @@ static PyObject * Map_find_by_location_query(PyMap* self, PyObject* args){
     PyObject * where_obj;
     double radius;
     PyObject* filter;
-    if (!PyArg_ParseTuple(args, "OdO", &where_obj, &radius, &filter)) {
+    int sort = 0;
+    if (!PyArg_ParseTuple(args, "OdO|i", &where_obj, &radius, &filter, &sort)) {
         return nullptr;
     }
 
@@ -343,28 +361,17 @@ static PyObject * Map_find_by_location_query(PyMap* self, PyObject* args){
         return nullptr;
     }
 
-    //Create a vector and fill it with entities that match the given filter and are in range
-    float square_range = radius * radius;
+    //Create a vector and fill it with entities that match the given filter and are in range.
+    //The memory's spatial index and the cheap type check are used before the full filter.
     EntityVector res;
-    LocatedEntity* place = where->location->m_loc;
-    if (place != 0) {
-
-        auto iter = place->m_contains->begin();
-        auto iter_end = place->m_contains->end();
-
-        for (; iter != iter_end; ++iter) {
-            LocatedEntity* item = *iter;
-            if (item == 0) {
-                continue;
-            }
-            if (!item->isVisible() || !f->m_filter->match(*item)) {
-                continue;
-            }
-            if (squareDistance(where->location->pos(), item->m_location.pos()) < square_range) {
-                res.push_back(item);
-            }
-        }
-    }
+    const TypeNode* type = f->m_filter->program().requiredType();
+    EntityFilter::FilterCache& cache = filter_cache();
+    ++cache.queries;
+    self->m_map->findInRange(*where->location, radius, type, res, sort != 0);
+    cache.candidates += res.size();
+    res.erase(std::remove_if(res.begin(), res.end(), [&](LocatedEntity* item) {
+        return !f->m_filter->match(*item);
+    }), res.end());
 
     //Create a python list an fill it with the entities we got
     PyObject * list = PyList_New(res.size());
@@ -433,7 +440,7 @@ PyObject* Map_recall_entity_memory(PyMap* self, PyObject* args){
 
 static PyMethodDef Map_methods[] = {
     {"find_by_location",    (PyCFunction)Map_find_by_location,    METH_VARARGS},
-    {"find_by_type",        (PyCFunction)Map_find_by_type,        METH_O},
+    {"find_by_type",        (PyCFunction)Map_find_by_type,        METH_VARARGS},
     {"find_by_filter",      (PyCFunction)Map_find_by_filter,      METH_O},
     {"find_by_location_query",(PyCFunction)Map_find_by_location_query,  METH_VARARGS},
     {"add_entity_memory",   (PyCFunction)Map_add_entity_memory,   METH_VARARGS},
@@ -17,6 +17,7 @@
 
 
 #include "Py_Operation.h"
+#include "Py_FreeList.h"
 #include "Py_RootEntity.h"
 #include "Py_Oplist.h"
 #include "Py_Message.h"
@@ -602,10 +603,18 @@ PyMethodDef ConstOperation_methods[] = {
  * Beginning of Operation standard methods section.
  */
 
+static PyFreeList<PyOperation> operation_free_list("Operation");
+
+/// \brief Whether operation wrappers of the type can be pooled
+static bool Operation_pooled(PyTypeObject * type)
+{
+    return type == &PyConstOperation_Type || type == &PyOperation_Type;
+}
+
 static void Operation_dealloc(PyOperation *self)
 {
     self->operation.~RootOperation();
-    self->ob_type->tp_free((PyObject*)self);
+    operation_free_list.release(self, Operation_pooled(self->ob_type));
 }
 
 static PyObject * Operation_getattro(PyOperation * self, PyObject * oname)
@@ -787,7 +796,7 @@ static PyObject * Operation_new(PyTypeObject * type, PyObject *, PyObject *)
 {
     // This looks allot like the default implementation, except we call the
     // in-place constructor.
-    PyOperation * self = (PyOperation *)type->tp_alloc(type, 0);
+    PyOperation * self = operation_free_list.alloc(type, Operation_pooled(type));
     if (self != nullptr) {
         new (&(self->operation)) RootOperation(nullptr);
     }
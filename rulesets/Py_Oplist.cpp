@@ -18,6 +18,7 @@
 
 #include "Py_Operation.h"
 #include "Py_Oplist.h"
+#include "Py_FreeList.h"
 
 static PyObject* Oplist_append(PyOplist * self, PyOperation * op)
 {
@@ -49,10 +50,21 @@ static PyMethodDef Oplist_methods[] = {
     {nullptr,              nullptr}           /* sentinel */
 };
 
+static PyFreeList<PyOplist> oplist_free_list("Oplist");
+
 static void Oplist_dealloc(PyOplist *self)
 {
     delete self->ops;
-    self->ob_type->tp_free((PyObject*)self);
+    oplist_free_list.release(self, self->ob_type == &PyOplist_Type);
+}
+
+static PyObject * Oplist_new(PyTypeObject * type, PyObject *, PyObject *)
+{
+    PyOplist * self = oplist_free_list.alloc(type, type == &PyOplist_Type);
+    if (self != nullptr) {
+        self->ops = nullptr;
+    }
+    return (PyObject *)self;
 }
 
 static PyObject * Oplist_num_add(PyOplist *self, PyObject *other)
@@ -300,7 +312,7 @@ PyTypeObject PyOplist_Type = {
         0,                              // tp_dictoffset
         (initproc)Oplist_init,          // tp_init
         0,                              // tp_alloc
-        0,                              // tp_new
+        Oplist_new,                     // tp_new
 };
 
 PyOplist * newPyOplist()
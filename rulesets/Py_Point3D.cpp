@@ -17,6 +17,7 @@
 
 
 #include "Py_Point3D.h"
+#include "Py_FreeList.h"
 
 #include "Py_Vector3D.h"
 #include "Py_Message.h"
@@ -66,10 +67,12 @@ static PyMethodDef Point3D_methods[] = {
     {nullptr,              nullptr}           /* sentinel */
 };
 
+static PyFreeList<PyPoint3D> point3d_free_list("Point3D");
+
 static void Point3D_dealloc(PyPoint3D *self)
 {
     self->coords.~Point3D();
-    self->ob_type->tp_free(self);
+    point3d_free_list.release(self, self->ob_type == &PyPoint3D_Type);
 }
 
 static PyObject* Point3D_repr(PyPoint3D * self)
@@ -241,7 +244,7 @@ PyObject * Point3D_new(PyTypeObject * type, PyObject *, PyObject *)
 {
     // This looks allot like the default implementation, except we call the
     // in-place constructor.
-    PyPoint3D * self = (PyPoint3D *)type->tp_alloc(type, 0);
+    PyPoint3D * self = point3d_free_list.alloc(type, type == &PyPoint3D_Type);
     if (self != nullptr) {
         new (&(self->coords)) Point3D();
     }
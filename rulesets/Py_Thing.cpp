@@ -165,8 +165,18 @@ static PyObject * Mind_refreshPath(PyEntity * self)
         return nullptr;
     }
 
-    int result = awareMind->updatePath();
-//    int result = awareMind->getSteering().updatePath(awareMind->m_location.m_pos);
+    // The path search only reads the navmesh, which is guarded by its own
+    // lock, so other Python threads can run while it's in progress.
+    Steering& steering = awareMind->getSteering();
+    Steering::PathQuery query;
+    int result = steering.preparePathQuery(awareMind->getCurrentServerTime(), query);
+    if (result == 0) {
+        std::list<WFMath::Point<3>> path;
+        Py_BEGIN_ALLOW_THREADS
+        result = Steering::runPathQuery(query, path);
+        Py_END_ALLOW_THREADS
+        result = steering.applyPathQuery(result, path);
+    }
     return Py_BuildValue("i", result);
 }
 
@@ -293,6 +303,7 @@ static PyObject * Entity_getattro(PyEntity *self, PyObject *oname)
         if (loc != nullptr) {
             loc->location = &self->m_entity.e->m_location;
             loc->owner = self->m_entity.e;
+            loc->owner->incRef();
         }
         return (PyObject *)loc;
     }
@@ -519,6 +530,7 @@ static PyObject * Mind_getattro(PyEntity *self, PyObject *oname)
         if (loc != nullptr) {
             loc->location = &self->m_entity.m->m_location;
             loc->owner = self->m_entity.m;
+            loc->owner->incRef();
         }
         return (PyObject *)loc;
     }
@@ -593,6 +605,12 @@ static PyObject * Mind_getattro(PyEntity *self, PyObject *oname)
         return PyInt_FromLong(awareMind->getSteering().getPathResult());
     }
 
+    if (strcmp(name, "tickIntervalScale") == 0) {
+        AwareMind* awareMind = dynamic_cast<AwareMind*>(self->m_entity.m);
+        //Minds which aren't aware of their surroundings always run at full rate.
+        return PyFloat_FromDouble(awareMind ? awareMind->getTickIntervalScale() : 1.0);
+    }
+
     LocatedEntity * mind = self->m_entity.m;
     Element attr;
     if (mind->getAttr(name, attr) == 0) {
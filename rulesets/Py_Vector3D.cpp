@@ -17,6 +17,7 @@
 
 
 #include "Py_Vector3D.h"
+#include "Py_FreeList.h"
 
 #include "Py_Quaternion.h"
 #include "Py_Message.h"
@@ -170,10 +171,12 @@ static PyMethodDef Vector3D_methods[] = {
     {nullptr,              nullptr}           /* sentinel */
 };
 
+static PyFreeList<PyVector3D> vector3d_free_list("Vector3D");
+
 static void Vector3D_dealloc(PyVector3D *self)
 {
     self->coords.~Vector3D();
-    self->ob_type->tp_free(self);
+    vector3d_free_list.release(self, self->ob_type == &PyVector3D_Type);
 }
 
 static PyObject* Vector3D_repr(PyVector3D * self)
@@ -396,7 +399,7 @@ static PyObject * Vector3D_new(PyTypeObject * type, PyObject *, PyObject *)
 {
     // This looks allot like the default implementation, except we call the
     // in-place constructor.
-    PyVector3D * self = (PyVector3D *)type->tp_alloc(type, 0);
+    PyVector3D * self = vector3d_free_list.alloc(type, type == &PyVector3D_Type);
     if (self != nullptr) {
         new (&(self->coords)) Vector3D();
     }
@@ -19,9 +19,11 @@
 #include <Python.h>
 
 #include "PythonArithmeticScript.h"
+#include "Python_Script_Utils.h"
 
 #include "common/log.h"
 #include "common/compose.hpp"
+#include "common/ScriptProfiler.h"
 
 #include <iostream>
 
@@ -29,7 +31,8 @@
 ///
 /// @param script Python instance object implementing the script
 PythonArithmeticScript::PythonArithmeticScript(PyObject * script) :
-                                               m_script(script)
+                                               m_script(script),
+                                               m_typeName(Get_PyTypeName(script))
 {
 }
 
@@ -44,7 +47,11 @@ PythonArithmeticScript::~PythonArithmeticScript()
 int PythonArithmeticScript::attribute(const std::string & name, float & val)
 {
     PyObject * pn = PyString_FromString(name.c_str());
-    PyObject * ret = PyObject_GenericGetAttr(m_script, pn);
+    PyObject * ret;
+    {
+        ScriptProfiler::Scope profile(m_typeName, name);
+        ret = PyObject_GenericGetAttr(m_script, pn);
+    }
     Py_DECREF(pn);
     if (ret == nullptr) {
         if (PyErr_Occurred() == nullptr) {
@@ -72,7 +79,12 @@ void PythonArithmeticScript::set(const std::string & name, const float & val)
 {
     PyObject * pn = PyString_FromString(name.c_str());
     PyObject * py_val = PyFloat_FromDouble(val);
-    if (PyObject_GenericSetAttr(m_script, pn, py_val) == 0) {
+    int ret;
+    {
+        ScriptProfiler::Scope profile(m_typeName, name);
+        ret = PyObject_GenericSetAttr(m_script, pn, py_val);
+    }
+    if (ret == 0) {
         // PyObject_GenericSetAttr sets and error if nothing was found
         PyErr_Clear();
     }
@@ -28,6 +28,8 @@ class PythonArithmeticScript : public ArithmeticScript {
   protected:
     /// \brief Python instance object implementing the script
     struct _object * m_script;
+    /// \brief Module qualified name of the script class, for profiling
+    const std::string m_typeName;
   public:
     PythonArithmeticScript(struct _object * script);
     virtual ~PythonArithmeticScript();
@@ -19,6 +19,7 @@
 #include <Python.h>
 
 #include "PythonClass.h"
+#include "PythonOperationHandlers.h"
 
 #include "rulesets/Python_Script_Utils.h"
 
@@ -81,6 +82,8 @@ int PythonClass::getClass(PyObject * module)
         Py_DECREF(m_class);
     }
     m_class = new_class;
+    // Scripts created from the previous class keep its handlers.
+    m_operationHandlers = std::make_shared<PythonOperationHandlers>(m_class);
 
     return 0;
 }
@@ -19,8 +19,11 @@
 #ifndef RULESETS_PYTHON_CLASS_H
 #define RULESETS_PYTHON_CLASS_H
 
+#include <memory>
 #include <string>
 
+class PythonOperationHandlers;
+
 /// \brief Factory interface for creating scripts to attach to in game
 /// entity objects.
 class PythonClass {
@@ -36,6 +39,8 @@ class PythonClass {
     struct _object * m_module;
     /// \brief Class object to be instanced when creating scripts
     struct _object * m_class;
+    /// \brief Operation handler methods of the class object
+    std::shared_ptr<PythonOperationHandlers> m_operationHandlers;
 
     PythonClass(const std::string & package,
                 const std::string & type,
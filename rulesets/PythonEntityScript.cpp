@@ -19,6 +19,8 @@
 #include <Python.h>
 
 #include "PythonEntityScript.h"
+#include "PythonOperationHandlers.h"
+#include "Python_Script_Utils.h"
 
 #include "Py_Operation.h"
 #include "Py_Oplist.h"
@@ -30,14 +32,18 @@
 #include "common/debug.h"
 #include "common/compose.hpp"
 #include "common/OperationRouter.h"
+#include "common/ScriptProfiler.h"
 
 #include <iostream>
 
 static const bool debug_flag = false;
 
 /// \brief PythonEntityScript constructor
-PythonEntityScript::PythonEntityScript(PyObject * o) :
-                    PythonWrapper(o)
+PythonEntityScript::PythonEntityScript(PyObject * o,
+                                       std::shared_ptr<PythonOperationHandlers> handlers) :
+                    PythonWrapper(o),
+                    m_operationHandlers(std::move(handlers)),
+                    m_typeName(Get_PyTypeName(o))
 {
 }
 
@@ -50,12 +56,25 @@ bool PythonEntityScript::operation(const std::string & op_type,
                                    OpVector & res)
 {
     assert(m_wrapper != nullptr);
+    PyObject * handler = nullptr;
+    if (m_operationHandlers) {
+        // Operations neither the class nor the instance has a method for
+        // never reach Python.
+        int * calls = nullptr;
+        handler = m_operationHandlers->handler(op->getClassNo(), op_type, calls);
+        if (handler != nullptr) {
+            ++*calls;
+        } else if (!m_operationHandlers->instanceHandles(m_wrapper, op_type)) {
+            return false;
+        }
+    }
     std::string op_name = op_type + "_operation";
     debug( std::cout << "Got script object for " << op_name << std::endl
                                                             << std::flush;);
     // This check isn't really necessary, except it saves the conversion
     // time.
-    if (!PyObject_HasAttrString(m_wrapper, (char *)(op_name.c_str()))) {
+    if (!m_operationHandlers &&
+        !PyObject_HasAttrString(m_wrapper, (char *)(op_name.c_str()))) {
         debug( std::cout << "No method to be found for " << op_name
                          << std::endl << std::flush;);
         return false;
@@ -67,8 +86,15 @@ bool PythonEntityScript::operation(const std::string & op_type,
     }
     py_op->operation = op;
     PyObject * ret;
-    ret = PyObject_CallMethod(m_wrapper, (char *)(op_name.c_str()),
-                                            (char *)"(O)", py_op);
+    {
+        ScriptProfiler::Scope profile(m_typeName, op_type);
+        if (handler != nullptr) {
+            ret = PyObject_CallFunctionObjArgs(handler, m_wrapper, py_op, nullptr);
+        } else {
+            ret = PyObject_CallMethod(m_wrapper, (char *)(op_name.c_str()),
+                                                    (char *)"(O)", py_op);
+        }
+    }
     Py_DECREF(py_op);
     if (ret == nullptr) {
         if (PyErr_Occurred() == nullptr) {
@@ -118,6 +144,19 @@ bool PythonEntityScript::operation(const std::string & op_type,
     return true;
 }
 
+bool PythonEntityScript::handlesOperation(const std::string & op_type,
+                                          int op_no)
+{
+    assert(m_wrapper != nullptr);
+    if (m_operationHandlers) {
+        int * calls = nullptr;
+        return m_operationHandlers->handler(op_no, op_type, calls) != nullptr ||
+               m_operationHandlers->instanceHandles(m_wrapper, op_type);
+    }
+    std::string op_name = op_type + "_operation";
+    return PyObject_HasAttrString(m_wrapper, (char *)(op_name.c_str())) != 0;
+}
+
 void PythonEntityScript::hook(const std::string & function,
                               LocatedEntity * entity)
 {
@@ -126,10 +165,14 @@ void PythonEntityScript::hook(const std::string & function,
         return;
     }
 
-    PyObject * ret = PyObject_CallMethod(m_wrapper,
-                                         (char *)(function.c_str()),
-                                         (char *)"(O)",
-                                         wrapper);
+    PyObject * ret;
+    {
+        ScriptProfiler::Scope profile(m_typeName, function);
+        ret = PyObject_CallMethod(m_wrapper,
+                                  (char *)(function.c_str()),
+                                  (char *)"(O)",
+                                  wrapper);
+    }
     Py_DECREF(wrapper);
     if (ret == nullptr) {
         if (PyErr_Occurred() == nullptr) {
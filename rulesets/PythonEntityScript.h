@@ -21,16 +21,27 @@
 
 #include "PythonWrapper.h"
 
+#include <memory>
+
+class PythonOperationHandlers;
+
 /// \brief Script class for Python scripts attached to an Entity
 /// \ingroup Scripts
 class PythonEntityScript : public PythonWrapper {
+  protected:
+    /// \brief Operation handlers of the script class, if known
+    std::shared_ptr<PythonOperationHandlers> m_operationHandlers;
+    /// \brief Module qualified name of the script class, for profiling
+    const std::string m_typeName;
   public:
-    explicit PythonEntityScript(PyObject *);
+    explicit PythonEntityScript(PyObject *,
+                                std::shared_ptr<PythonOperationHandlers> handlers = nullptr);
     virtual ~PythonEntityScript();
 
     virtual bool operation(const std::string & opname,
                            const Atlas::Objects::Operation::RootOperation & op,
                            OpVector & res);
+    virtual bool handlesOperation(const std::string & opname, int op_no);
     virtual void hook(const std::string & function, LocatedEntity * entity);
 };
 
@@ -0,0 +1,139 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include <Python.h>
+
+#include "PythonOperationHandlers.h"
+
+#include "common/compose.hpp"
+#include "common/Monitors.h"
+#include "common/Variable.h"
+
+static const std::string operation_suffix("_operation");
+
+std::map<std::string, std::unique_ptr<int>> PythonOperationHandlers::s_callCounts;
+
+PythonOperationHandlers::PythonOperationHandlers(PyObject * cls) :
+    m_hasGetattr(PyObject_HasAttrString(cls, (char *)"__getattr__") != 0)
+{
+    PyObject * names = PyObject_Dir(cls);
+    if (names == nullptr) {
+        PyErr_Clear();
+        return;
+    }
+    Py_ssize_t count = PyList_Size(names);
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        PyObject * name = PyList_GetItem(names, i);
+        if (!PyString_Check(name)) {
+            continue;
+        }
+        std::string attr(PyString_AsString(name));
+        if (attr.size() <= operation_suffix.size() ||
+            attr.compare(attr.size() - operation_suffix.size(),
+                         operation_suffix.size(), operation_suffix) != 0) {
+            continue;
+        }
+        PyObject * method = PyObject_GetAttr(cls, name);
+        if (method == nullptr) {
+            PyErr_Clear();
+            continue;
+        }
+        if (!PyCallable_Check(method)) {
+            Py_DECREF(method);
+            continue;
+        }
+        m_methods.insert(std::make_pair(attr.substr(0, attr.size() - operation_suffix.size()), method));
+    }
+    Py_DECREF(names);
+}
+
+PythonOperationHandlers::~PythonOperationHandlers()
+{
+    for (auto & entry : m_methods) {
+        Py_DECREF(entry.second);
+    }
+}
+
+PythonOperationHandlers::Handler PythonOperationHandlers::resolve(const std::string & op_type) const
+{
+    Handler handler;
+    handler.op_type = op_type;
+    auto I = m_methods.find(op_type);
+    if (I == m_methods.end()) {
+        return handler;
+    }
+    handler.method = I->second;
+    auto J = s_callCounts.find(op_type);
+    if (J == s_callCounts.end()) {
+        int * calls = new int(0);
+        s_callCounts.insert(std::make_pair(op_type, std::unique_ptr<int>(calls)));
+        Monitors::instance()->watch(String::compose("script_operation_calls{op=\"%1\"}", op_type),
+                                    new Variable<int>(*calls));
+        handler.calls = calls;
+    } else {
+        handler.calls = J->second.get();
+    }
+    return handler;
+}
+
+PyObject * PythonOperationHandlers::handler(int class_no,
+                                            const std::string & op_type,
+                                            int *& calls)
+{
+    if (class_no >= 0) {
+        if ((std::size_t)class_no >= m_handlers.size()) {
+            m_handlers.resize(class_no + 1);
+        }
+        std::vector<Handler> & handlers = m_handlers[class_no];
+        for (const Handler & handler : handlers) {
+            if (handler.op_type == op_type) {
+                calls = handler.calls;
+                return handler.method;
+            }
+        }
+        handlers.push_back(resolve(op_type));
+        calls = handlers.back().calls;
+        return handlers.back().method;
+    }
+    Handler handler = resolve(op_type);
+    calls = handler.calls;
+    return handler.method;
+}
+
+bool PythonOperationHandlers::instanceHandles(PyObject * instance,
+                                              const std::string & op_type) const
+{
+    std::string op_name = op_type + operation_suffix;
+    if (m_hasGetattr) {
+        return PyObject_HasAttrString(instance, (char *)(op_name.c_str())) != 0;
+    }
+    PyObject * dict = nullptr;
+    if (PyInstance_Check(instance)) {
+        dict = ((PyInstanceObject *)instance)->in_dict;
+    } else {
+        PyObject ** dictptr = _PyObject_GetDictPtr(instance);
+        if (dictptr != nullptr) {
+            dict = *dictptr;
+        }
+    }
+    if (dict == nullptr) {
+        return false;
+    }
+    PyObject * method = PyDict_GetItemString(dict, op_name.c_str());
+    return method != nullptr && PyCallable_Check(method);
+}
@@ -0,0 +1,100 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef RULESETS_PYTHON_OPERATION_HANDLERS_H
+#define RULESETS_PYTHON_OPERATION_HANDLERS_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// \brief Table of the operation handler methods of a Python script class
+///
+/// The class is scanned once for methods named "<op>_operation" when it is
+/// loaded or reloaded. Handlers are then resolved by operation class number
+/// and name the first time each operation is seen, so that operations the
+/// script does not handle never touch Python.
+///
+/// Handlers added to an instance, or provided through __getattr__, are
+/// not in the table; instanceHandles() looks for those when an operation
+/// has no handler in it.
+/// \ingroup Scripts
+class PythonOperationHandlers {
+  protected:
+    struct Handler {
+        /// \brief Name of the operation class the handler was resolved for
+        std::string op_type;
+        /// \brief The unbound method, or null if the class has none
+        struct _object * method;
+        /// \brief Count of calls to the handler, shared by all classes
+        int * calls;
+
+        Handler() : method(nullptr), calls(nullptr) { }
+    };
+
+    /// \brief Handler methods of the class, keyed by operation name
+    std::map<std::string, struct _object *> m_methods;
+    /// \brief Handlers resolved so far, indexed by operation class number
+    ///
+    /// Several names share a class number, such as operations without a
+    /// class of their own and the "call_triggers" and "sight_*" calls made
+    /// by minds, so each class number keeps the handlers of all of them.
+    std::vector<std::vector<Handler>> m_handlers;
+    /// \brief Whether the class defines __getattr__
+    bool m_hasGetattr;
+
+    /// \brief Count of script calls for each operation name
+    static std::map<std::string, std::unique_ptr<int>> s_callCounts;
+
+    Handler resolve(const std::string & op_type) const;
+  public:
+    explicit PythonOperationHandlers(struct _object * cls);
+    ~PythonOperationHandlers();
+
+    PythonOperationHandlers(const PythonOperationHandlers &) = delete;
+    PythonOperationHandlers & operator=(const PythonOperationHandlers &) = delete;
+
+    /// \brief Get the handler method for an operation
+    ///
+    /// @param class_no the class number of the operation
+    /// @param op_type the name of the operation class
+    /// @param calls set to the call counter of the operation if a handler
+    /// is found
+    /// @return a borrowed reference to the unbound method, or null if the
+    /// class does not handle the operation
+    struct _object * handler(int class_no, const std::string & op_type,
+                             int *& calls);
+
+    /// \brief Check if an instance of the class has a handler of its own
+    ///
+    /// Only the instance dictionary is looked in, unless the class defines
+    /// __getattr__, in which case the attribute is looked up.
+    /// @param instance the instance of the class
+    /// @param op_type the name of the operation class
+    /// @return true if the instance handles the operation
+    bool instanceHandles(struct _object * instance,
+                         const std::string & op_type) const;
+
+    /// \brief Number of handler methods found on the class
+    std::size_t size() const {
+        return m_methods.size();
+    }
+};
+
+#endif // RULESETS_PYTHON_OPERATION_HANDLERS_H
@@ -62,7 +62,7 @@ int PythonScriptFactory<T>::addScript(T * entity) const
     Py_DECREF(wrapper);
 
     if (script != nullptr) {
-        entity->setScript(new PythonEntityScript(script));
+        entity->setScript(new PythonEntityScript(script, this->m_operationHandlers));
 
         Py_DECREF(script);
     }
@@ -36,3 +36,9 @@ PythonWrapper::~PythonWrapper()
     }
     Py_DECREF(m_wrapper);
 }
+
+/// \brief Check if any script holds on to the wrapper, besides this
+bool PythonWrapper::isReferenced() const
+{
+    return m_wrapper->ob_refcnt > 1;
+}
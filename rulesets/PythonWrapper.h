@@ -21,9 +21,14 @@
 
 #include "Script.h"
 
+#include "common/ObjectPool.h"
+
 /// \brief Wrapper class for entities without scripts but with wrappers
+///
+/// Instances are pool allocated, as one is created for every entity that
+/// is passed to Python without having a script of its own.
 /// \ingroup Scripts
-class PythonWrapper : public Script {
+class PythonWrapper : public Script, public PoolAllocated<PythonWrapper> {
   protected:
     /// \brief Python object that wraps the entity.
     struct _object * m_wrapper;
@@ -33,6 +38,8 @@ class PythonWrapper : public Script {
 
     /// \brief Accessor for the python object that wraps the entity.
     struct _object * wrapper() const { return m_wrapper; }
+
+    bool isReferenced() const override;
 };
 
 template<class T>
@@ -38,6 +38,7 @@
 #include "Py_Property.h"
 #include "Py_Task.h"
 #include "Py_Filter.h"
+#include "Py_FreeList.h"
 
 #include "PythonEntityScript.h"
 #include "BaseMind.h"
@@ -45,10 +46,16 @@
 #include "common/globals.h"
 #include "common/const.h"
 #include "common/debug.h"
+#include "common/ScriptProfiler.h"
+#include "common/Monitors.h"
+#include "common/Variable.h"
+#include "common/compose.hpp"
 
 #include <Atlas/Objects/Operation.h>
 #include <Atlas/Objects/Anonymous.h>
 
+#include <algorithm>
+
 using Atlas::Message::Element;
 using Atlas::Objects::Root;
 using Atlas::Objects::Operation::RootOperation;
@@ -386,6 +393,29 @@ PyObject * Get_PyModule(const std::string & package)
     return module;
 }
 
+/// \brief Get the module qualified name of the class of a Python object
+///
+/// Used to tell apart classes of the same name in different modules.
+std::string Get_PyTypeName(PyObject * o)
+{
+    PyTypeObject * type = Py_TYPE(o);
+    std::string name = type->tp_name;
+    // Static types already include their module in the name.
+    if ((type->tp_flags & Py_TPFLAGS_HEAPTYPE) == 0) {
+        return name;
+    }
+    PyObject * module = PyObject_GetAttrString((PyObject *)type, "__module__");
+    if (module == nullptr) {
+        PyErr_Clear();
+        return name;
+    }
+    if (PyString_Check(module)) {
+        name = std::string(PyString_AsString(module)) + "." + name;
+    }
+    Py_DECREF(module);
+    return name;
+}
+
 PyObject * Create_PyScript(PyObject * wrapper, PyObject * py_class)
 {
     PyObject * pyob = PyEval_CallFunction(py_class,"(O)", wrapper);
@@ -530,6 +560,51 @@ static PyMethodDef entity_filter_methods[] = {
         {nullptr, nullptr}
 };
 
+/// \brief gc.get_count, used to count objects allocated by profiled scripts
+static PyObject * gc_get_count = nullptr;
+
+/// \brief Objects allocated by each call to gc.get_count itself
+static long gc_count_overhead = 0;
+
+/// \brief Number of calls made to python_object_count()
+static long gc_count_calls = 0;
+
+static long gc_count()
+{
+    PyObject * count = PyObject_CallObject(gc_get_count, nullptr);
+    if (count == nullptr) {
+        PyErr_Clear();
+        return 0;
+    }
+    long objects = 0;
+    if (PyTuple_Check(count) && PyTuple_Size(count) > 0) {
+        objects = PyInt_AsLong(PyTuple_GetItem(count, 0));
+    }
+    Py_DECREF(count);
+    return objects;
+}
+
+/// \brief Number of objects allocated since the last collection
+///
+/// The count read by each call includes what the calls before it allocated
+/// to return their result, so that is taken off.
+static long python_object_count()
+{
+    return gc_count() - gc_count_overhead * ++gc_count_calls;
+}
+
+/// \brief Measure how many objects a call to gc.get_count allocates
+static void calibrate_object_count()
+{
+    // The first calls may fill free lists, so only the last one is used.
+    long previous = gc_count();
+    for (int i = 0; i < 4; ++i) {
+        long current = gc_count();
+        gc_count_overhead = std::max(current - previous, 0L);
+        previous = current;
+    }
+}
+
 void init_python_api(const std::string & ruleset, bool log_stdout)
 {
     Py_Initialize();
@@ -591,17 +666,40 @@ void init_python_api(const std::string & ruleset, bool log_stdout)
     }
     Py_DECREF(sys_module);
 
+    PyObject * gc_module = PyImport_ImportModule("gc");
+    if (gc_module != nullptr) {
+        gc_get_count = PyObject_GetAttrString(gc_module, "get_count");
+        Py_DECREF(gc_module);
+    }
+    for (PyFreeListBase * free_list : PyFreeListBase::registry()) {
+        Monitors::instance()->watch(String::compose("python_wrapper_allocations{type=\"%1\"}", free_list->name()),
+                                    new Variable<int>(free_list->allocations));
+        Monitors::instance()->watch(String::compose("python_wrapper_reuses{type=\"%1\"}", free_list->name()),
+                                    new Variable<int>(free_list->reuses));
+    }
+
+    if (gc_get_count != nullptr) {
+        calibrate_object_count();
+        ScriptProfiler::instance()->setObjectCounter(python_object_count);
+    } else {
+        PyErr_Clear();
+        log(WARNING, "Python gc module not available, allocations will not be profiled");
+    }
+
     PyObject * entity_filter = Py_InitModule("entity_filter", entity_filter_methods);
     if (entity_filter == nullptr) {
         log(CRITICAL, "Python init failed to create entity_filter module\n");
         return;
     }
 
-    PyFilter_Type.tp_new = PyType_GenericNew;
     if (PyType_Ready(&PyFilter_Type) < 0 ){
         log(CRITICAL, "Python init failed to ready entity filter wrapper type");
             return;
     }
+    Monitors::instance()->watch("entity_filter_cache_hits", new Variable<std::int64_t>(filter_cache().hits));
+    Monitors::instance()->watch("entity_filter_cache_misses", new Variable<std::int64_t>(filter_cache().misses));
+    Monitors::instance()->watch("entity_filter_queries", new Variable<std::int64_t>(filter_cache().queries));
+    Monitors::instance()->watch("entity_filter_candidates", new Variable<std::int64_t>(filter_cache().candidates));
 
     PyObject * atlas = Py_InitModule("atlas", atlas_methods);
     if (atlas == nullptr) {
@@ -622,7 +720,6 @@ void init_python_api(const std::string & ruleset, bool log_stdout)
         return;
     }
     PyModule_AddObject(atlas, "Entity", (PyObject *)&PyRootEntity_Type);
-    PyOplist_Type.tp_new = PyType_GenericNew;
     if (PyType_Ready(&PyOplist_Type) < 0) {
         log(CRITICAL, "Python init failed to ready Oplist wrapper type");
         return;
@@ -843,6 +940,13 @@ void init_python_api(const std::string & ruleset, bool log_stdout)
 
 void shutdown_python_api()
 {
-    
+    ScriptProfiler::instance()->setObjectCounter(nullptr);
+    Py_CLEAR(gc_get_count);
+    // Compiled filters refer to type nodes, which may not outlive Python.
+    filter_cache().clear();
+    for (PyFreeListBase * free_list : PyFreeListBase::registry()) {
+        free_list->clear();
+    }
+
     Py_Finalize();
 }
@@ -29,5 +29,6 @@ struct _object * Get_PyClass(struct _object * module,
                        const std::string & type);
 struct _object * Get_PyModule(const std::string & package);
 struct _object * Create_PyScript(struct _object *, struct _object *);
+std::string Get_PyTypeName(struct _object *);
 
 #endif // RULESETS_PYTHON_SCRIPT_UTILS_H
@@ -24,6 +24,7 @@
 #include "Character.h"
 #include "ExternalMind.h"
 #include "common/BaseWorld.h"
+#include "common/TypeNode.h"
 
 #include <Atlas/Objects/Operation.h>
 #include <Atlas/Objects/Entity.h>
@@ -52,6 +53,11 @@ void RespawningProperty::install(LocatedEntity * owner, const std::string & name
     sInstanceState.addState(owner, new sigc::connection);
 }
 
+void RespawningProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::DELETE_NO, name, this);
+}
+
 void RespawningProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::DELETE_NO, name);
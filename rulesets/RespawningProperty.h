@@ -51,6 +51,7 @@ class RespawningProperty : public Property<std::string>
         virtual ~RespawningProperty();
 
         virtual void install(LocatedEntity *, const std::string &);
+        virtual void install(TypeNode *, const std::string &);
         virtual void remove(LocatedEntity *, const std::string &);
         virtual void apply(LocatedEntity *);
         virtual HandlerResult operation(LocatedEntity *,
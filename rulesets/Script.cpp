@@ -44,6 +44,16 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+/// \brief Check if the script has a handler for an operation
+///
+/// @param opname The string representing the type of the operation
+/// @param op_no The class number of the operation
+/// @return true if operations of this type are passed to the script
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 /// \brief Call a named function on the script, passing in the entity
 ///
 /// This function is used when object have registered function names to be
@@ -54,3 +64,12 @@ bool Script::operation(const std::string & opname,
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
+
+/// \brief Check if the script is used by anything other than its entity
+///
+/// Entities with referenced scripts must be kept alive, even when the
+/// entity itself is no longer needed.
+bool Script::isReferenced() const
+{
+    return false;
+}
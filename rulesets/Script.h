@@ -44,7 +44,9 @@ class Script {
     virtual bool operation(const std::string & opname,
                            const Atlas::Objects::Operation::RootOperation & op,
                            OpVector & res);
+    virtual bool handlesOperation(const std::string & opname, int op_no);
     virtual void hook(const std::string & function, LocatedEntity * entity);
+    virtual bool isReferenced() const;
 };
 
 #endif // RULESETS_SCRIPT_H
@@ -71,6 +71,11 @@ void SpawnerProperty::install(LocatedEntity * owner, const std::string & name)
     BaseWorld::instance().message(t, *owner);
 }
 
+void SpawnerProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::TICK_NO, name, this);
+}
+
 
 void SpawnerProperty::remove(LocatedEntity *owner, const std::string & name)
 {
@@ -32,6 +32,11 @@ StatusProperty * StatusProperty::copy() const
     return new StatusProperty(*this);
 }
 
+PropertyTypeId StatusProperty::typeId() const
+{
+    return propertyTypeId<StatusProperty>();
+}
+
 void StatusProperty::apply(LocatedEntity * owner)
 {
     if (m_data < 0) {
@@ -29,6 +29,7 @@ class StatusProperty : public Property<double> {
     StatusProperty() = default;
 
         StatusProperty * copy() const override;
+        PropertyTypeId typeId() const override;
 
         void apply(LocatedEntity *) override;
 };
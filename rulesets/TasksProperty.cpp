@@ -94,6 +94,11 @@ TasksProperty * TasksProperty::copy() const
     return new TasksProperty(*this);
 }
 
+PropertyTypeId TasksProperty::typeId() const
+{
+    return propertyTypeId<TasksProperty>();
+}
+
 int TasksProperty::updateTask(LocatedEntity * owner, OpVector & res)
 {
     setFlags(flag_unsent);
@@ -64,6 +64,11 @@ TerrainModProperty * TerrainModProperty::copy() const
     return new TerrainModProperty(*this);
 }
 
+PropertyTypeId TerrainModProperty::typeId() const
+{
+    return propertyTypeId<TerrainModProperty>();
+}
+
 void TerrainModProperty::apply(LocatedEntity * owner)
 {
     delete m_translator;
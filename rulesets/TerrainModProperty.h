@@ -44,6 +44,7 @@ class TerrainModProperty : public TerrainEffectorProperty
         ~TerrainModProperty() override;
 
         TerrainModProperty* copy() const override;
+        PropertyTypeId typeId() const override;
 
         void apply(LocatedEntity*) override;
 
@@ -91,6 +91,11 @@ void TerrainProperty::install(LocatedEntity *owner, const std::string &name)
     owner->installDelegate(Atlas::Objects::Operation::EAT_NO, name);
 }
 
+void TerrainProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::EAT_NO, name, this);
+}
+
 void TerrainProperty::remove(LocatedEntity *owner, const std::string & name)
 {
     owner->removeDelegate(Atlas::Objects::Operation::EAT_NO, name);
@@ -330,6 +335,11 @@ TerrainProperty * TerrainProperty::copy() const
     return new TerrainProperty(*this);
 }
 
+PropertyTypeId TerrainProperty::typeId() const
+{
+    return propertyTypeId<TerrainProperty>();
+}
+
 HandlerResult TerrainProperty::operation(LocatedEntity * e,
         const Operation & op, OpVector & res)
 {
@@ -61,10 +61,12 @@ class TerrainProperty : public PropertyBase {
     virtual ~TerrainProperty();
 
     virtual void install(LocatedEntity *, const std::string &);
+    virtual void install(TypeNode *, const std::string &);
     virtual void remove(LocatedEntity *, const std::string &);
     virtual int get(Atlas::Message::Element &) const;
     virtual void set(const Atlas::Message::Element &);
     virtual TerrainProperty * copy() const;
+    virtual PropertyTypeId typeId() const;
     virtual HandlerResult operation(LocatedEntity *,
                                     const Operation &,
                                     OpVector &);
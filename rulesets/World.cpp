@@ -171,7 +171,7 @@ void World::clearWorld(OpVector & res) {
             auto prop = propIter->second;
             prop->remove(this, propIter->first);
             delete prop;
-            m_properties.erase(propIter++);
+            propIter = m_properties.erase(propIter);
         } else {
             ++propIter;
         }
@@ -159,7 +159,8 @@ class NPCMind(server.Mind):
                 opTick=Operation("tick")
                 #just copy the args from the previous tick
                 opTick.setArgs(args)
-                opTick.setFutureSeconds(const.basic_tick + self.jitter)
+                #Think less often when far from any player.
+                opTick.setFutureSeconds((const.basic_tick + self.jitter) * self.tickIntervalScale)
                 for t in self.pending_things:
                     thing = self.map.get(t)
                     if thing and thing.type[0]:
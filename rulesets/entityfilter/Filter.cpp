@@ -18,6 +18,7 @@ Filter::Filter(const std::string &what, ProviderFactory* factory)
     if (!(parse_success && iter_begin == iter_end)) {
         throw std::invalid_argument(String::compose("Attempted creating entity filter with invalid query. Query was '%1'", what));
     }
+    m_program.reset(new Program(*m_predicate));
 }
 
 Filter::~Filter(){
@@ -26,11 +27,11 @@ Filter::~Filter(){
 
 bool Filter::match(LocatedEntity& entity)
 {
-    return m_predicate->isMatch(QueryContext{entity});
+    return m_program->isMatch(QueryContext{entity});
 }
 
 bool Filter::match(const QueryContext& context){
 
-    return m_predicate->isMatch(context);
+    return m_program->isMatch(context);
 }
 }
@@ -2,6 +2,9 @@
 #define RULESETS_FILTER_H_
 
 #include "ParserDefinitions.h"
+#include "Program.h"
+
+#include <memory>
 
 ///\brief This class is used to search entities in NPC's memory
 ///using a query as a filter
@@ -21,9 +24,14 @@ class Filter {
         bool match(LocatedEntity& entity);
         ///\brief test given QueryContext for a match
         bool match(const QueryContext& context);
+
+        ///\brief the compiled form of the query
+        const Program& program() const { return *m_program; }
     private:
         //The top predicate node used for testing
         Predicate* m_predicate;
+        //The predicate compiled into a flat program, which is what is matched against
+        std::unique_ptr<Program> m_program;
 };
 }
 #endif
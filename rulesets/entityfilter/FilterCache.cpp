@@ -0,0 +1,59 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "FilterCache.h"
+
+#include "Filter.h"
+
+namespace EntityFilter
+{
+
+FilterCache::FilterCache(ProviderFactory& factory, std::size_t capacity)
+: m_factory(factory), m_capacity(capacity)
+{
+}
+
+std::shared_ptr<Filter> FilterCache::get(const std::string& query)
+{
+    auto I = m_index.find(query);
+    if (I != m_index.end()) {
+        ++hits;
+        m_entries.splice(m_entries.begin(), m_entries, I->second);
+        return I->second->second;
+    }
+
+    ++misses;
+    //Parse before touching the cache, as this throws on invalid queries.
+    std::shared_ptr<Filter> filter(new Filter(query, &m_factory));
+
+    m_entries.emplace_front(query, filter);
+    m_index.emplace(query, m_entries.begin());
+    if (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+    return filter;
+}
+
+void FilterCache::clear()
+{
+    m_index.clear();
+    m_entries.clear();
+}
+
+}
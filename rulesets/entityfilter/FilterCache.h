@@ -0,0 +1,79 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef RULESETS_FILTER_FILTERCACHE_H_
+#define RULESETS_FILTER_FILTERCACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace EntityFilter
+{
+class Filter;
+class ProviderFactory;
+
+///\brief Least recently used cache of compiled filters, keyed by query.
+///
+///Scripts tend to create filters for the same few queries over and over,
+///and parsing a query is far more expensive than matching it. Filters are
+///shared, so one evicted from the cache stays alive for as long as it's
+///in use.
+class FilterCache {
+    public:
+        ///\brief Number of lookups which found a cached filter
+        std::int64_t hits = 0;
+        ///\brief Number of lookups which had to parse the query
+        std::int64_t misses = 0;
+        ///\brief Number of searches done with filters from this cache
+        std::int64_t queries = 0;
+        ///\brief Number of entities examined by these searches
+        std::int64_t candidates = 0;
+
+        ///@param factory factory used when parsing new queries
+        ///@param capacity max number of filters kept
+        FilterCache(ProviderFactory& factory, std::size_t capacity = 256);
+
+        ///\brief Get the filter for a query, parsing it if it isn't cached.
+        ///
+        ///Throws std::invalid_argument if the query is invalid.
+        std::shared_ptr<Filter> get(const std::string& query);
+
+        std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+        void clear();
+
+    private:
+        typedef std::list<std::pair<std::string, std::shared_ptr<Filter>>> EntryList;
+
+        ProviderFactory& m_factory;
+        const std::size_t m_capacity;
+
+        ///Most recently used first
+        EntryList m_entries;
+        std::unordered_map<std::string, EntryList::iterator> m_index;
+};
+
+}
+
+#endif
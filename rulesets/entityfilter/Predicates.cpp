@@ -29,136 +29,107 @@ ComparePredicate::ComparePredicate(const Consumer<QueryContext>* lhs,
 
 bool ComparePredicate::isMatch(const QueryContext& context) const
 {
+    Atlas::Message::Element left, right;
+    m_lhs->value(left, context);
+
+    //Only ask for the right side if the left side could match.
     switch (m_comparator) {
     case Comparator::EQUALS:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (!left.isNone()) {
-            m_rhs->value(right, context);
-            if (!right.isNone()) {
-                return left == right;
-            }
+    case Comparator::IN:
+        if (left.isNone()) {
+            return false;
         }
-
-        return false;
-    }
         break;
     case Comparator::NOT_EQUALS:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (!left.isNone()) {
-            m_rhs->value(right, context);
-            if (!right.isNone()) {
-                return left != right;
-            }
+        if (left.isNone()) {
+            return true;
+        }
+        break;
+    case Comparator::LESS:
+    case Comparator::LESS_EQUAL:
+    case Comparator::GREATER:
+    case Comparator::GREATER_EQUAL:
+        if (!left.isNum()) {
+            return false;
+        }
+        break;
+    case Comparator::INSTANCE_OF:
+        if (!left.isPtr() || !left.Ptr()) {
+            return false;
+        }
+        break;
+    case Comparator::CONTAINS:
+        if (!left.isList()) {
+            return false;
         }
+        break;
+    }
+
+    m_rhs->value(right, context);
+    return compare(m_comparator, left, right);
+}
 
+bool ComparePredicate::compare(Comparator comparator,
+                               const Atlas::Message::Element& left,
+                               const Atlas::Message::Element& right)
+{
+    switch (comparator) {
+    case Comparator::EQUALS:
+        if (!left.isNone() && !right.isNone()) {
+            return left == right;
+        }
+        return false;
+    case Comparator::NOT_EQUALS:
+        if (!left.isNone() && !right.isNone()) {
+            return left != right;
+        }
         return true;
-    }
-        break;
     case Comparator::LESS:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isNum()) {
-            m_rhs->value(right, context);
-            if (right.isNum()) {
-                return left.asNum() < right.asNum();
-            }
+        if (left.isNum() && right.isNum()) {
+            return left.asNum() < right.asNum();
         }
         return false;
-    }
-        break;
     case Comparator::LESS_EQUAL:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isNum()) {
-            m_rhs->value(right, context);
-            if (right.isNum()) {
-                return left.asNum() <= right.asNum();
-            }
+        if (left.isNum() && right.isNum()) {
+            return left.asNum() <= right.asNum();
         }
         return false;
-    }
-        break;
     case Comparator::GREATER:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isNum()) {
-            m_rhs->value(right, context);
-            if (right.isNum()) {
-                return left.asNum() > right.asNum();
-            }
+        if (left.isNum() && right.isNum()) {
+            return left.asNum() > right.asNum();
         }
         return false;
-    }
-        break;
     case Comparator::GREATER_EQUAL:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isNum()) {
-            m_rhs->value(right, context);
-            if (right.isNum()) {
-                return left.asNum() >= right.asNum();
-            }
+        if (left.isNum() && right.isNum()) {
+            return left.asNum() >= right.asNum();
         }
         return false;
-    }
-        break;
     case Comparator::INSTANCE_OF:
     {
         //We know that both providers return type node instances, since we checked in the constructor.
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isPtr()) {
+        if (left.isPtr() && right.isPtr()) {
             const TypeNode* leftType = static_cast<const TypeNode*>(left.Ptr());
-            if (leftType) {
-                m_rhs->value(right, context);
-                if (right.isPtr()) {
-                    const TypeNode* rightType =
-                            static_cast<const TypeNode*>(right.Ptr());
-                    if (rightType) {
-                        return leftType->isTypeOf(rightType);
-                    }
-                }
+            const TypeNode* rightType = static_cast<const TypeNode*>(right.Ptr());
+            if (leftType && rightType) {
+                return leftType->isTypeOf(rightType);
             }
         }
         return false;
     }
     case Comparator::IN:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (!left.isNone()) {
-            m_rhs->value(right, context);
-            if (right.isList()) {
-                const auto& right_end = right.List().end();
-                const auto& right_begin = right.List().begin();
-                return std::find(right_begin, right_end, left) != right_end;
-            }
+        if (!left.isNone() && right.isList()) {
+            const auto& right_end = right.List().end();
+            const auto& right_begin = right.List().begin();
+            return std::find(right_begin, right_end, left) != right_end;
         }
         return false;
-    }
     case Comparator::CONTAINS:
-    {
-        Atlas::Message::Element left, right;
-        m_lhs->value(left, context);
-        if (left.isList()) {
-            m_rhs->value(right, context);
-            if (!right.isNone()) {
-                const auto& left_end = left.List().end();
-                const auto& left_begin = left.List().begin();
-                return std::find(left_begin, left_end, right) != left_end;
-            }
+        if (left.isList() && !right.isNone()) {
+            const auto& left_end = left.List().end();
+            const auto& left_begin = left.List().begin();
+            return std::find(left_begin, left_end, right) != left_end;
         }
         return false;
-    }
-        break;
     }
     return false;
 }
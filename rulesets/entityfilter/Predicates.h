@@ -25,6 +25,15 @@ class ComparePredicate : public Predicate {
         };
         ComparePredicate(const Consumer<QueryContext>* lhs, const Consumer<QueryContext>* rhs, Comparator comparator);
         virtual bool isMatch(const QueryContext& context) const;
+
+        ///\brief Compare two values which have already been provided
+        static bool compare(Comparator comparator,
+                            const Atlas::Message::Element& left,
+                            const Atlas::Message::Element& right);
+
+        const Consumer<QueryContext>* lhs() const { return m_lhs; }
+        const Consumer<QueryContext>* rhs() const { return m_rhs; }
+        Comparator comparator() const { return m_comparator; }
     protected:
         const Consumer<QueryContext>* m_lhs;
         const Consumer<QueryContext>* m_rhs;
@@ -37,6 +46,9 @@ class AndPredicate : public Predicate {
     public:
         AndPredicate(const Predicate* lhs, const Predicate* rhs);
         virtual bool isMatch(const QueryContext& context) const;
+
+        const Predicate* lhs() const { return m_lhs; }
+        const Predicate* rhs() const { return m_rhs; }
     protected:
         const Predicate* m_lhs;
         const Predicate* m_rhs;
@@ -46,6 +58,9 @@ class OrPredicate : public Predicate {
     public:
         OrPredicate(const Predicate* lhs, const Predicate* rhs);
         virtual bool isMatch(const QueryContext& context) const;
+
+        const Predicate* lhs() const { return m_lhs; }
+        const Predicate* rhs() const { return m_rhs; }
    protected:
         const Predicate* m_lhs;
         const Predicate* m_rhs;
@@ -55,6 +70,8 @@ class NotPredicate : public Predicate {
     public:
         NotPredicate(const Predicate* pred);
         virtual bool isMatch(const QueryContext& context) const;
+
+        const Predicate* predicate() const { return m_pred; }
     protected:
         const Predicate* m_pred;
 };
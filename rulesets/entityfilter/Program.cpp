@@ -0,0 +1,412 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Program.h"
+
+#include "Providers.h"
+
+#include "../../common/TypeNode.h"
+#include "../../common/Inheritance.h"
+
+#include <algorithm>
+
+namespace EntityFilter
+{
+
+namespace
+{
+
+///Labels 0 and 1 are always the final outcomes.
+const int accept_label = 0;
+const int reject_label = 1;
+
+///\brief Get the value of a provider which doesn't depend on the entity.
+bool constantElement(const Consumer<QueryContext>* provider, Atlas::Message::Element& value)
+{
+    auto fixedElement = dynamic_cast<const FixedElementProvider*>(provider);
+    if (fixedElement) {
+        value = fixedElement->element();
+        return true;
+    }
+    auto fixedType = dynamic_cast<const FixedTypeNodeProvider*>(provider);
+    if (fixedType && !fixedType->consumer()) {
+        value = (void*)(&fixedType->typeNode());
+        return true;
+    }
+    return false;
+}
+
+///\brief Get the consumer of the entity being matched, if the provider is "entity.*"
+const Consumer<LocatedEntity>* entityConsumer(const Consumer<QueryContext>* provider)
+{
+    auto entityProvider = dynamic_cast<const EntityProvider*>(provider);
+    if (entityProvider) {
+        return entityProvider->consumer();
+    }
+    return nullptr;
+}
+
+///\brief Flip a comparison so that the sides can be swapped.
+bool swapComparator(ComparePredicate::Comparator& comparator)
+{
+    typedef ComparePredicate::Comparator Comparator;
+    switch (comparator) {
+    case Comparator::EQUALS:
+    case Comparator::NOT_EQUALS:
+        return true;
+    case Comparator::LESS:
+        comparator = Comparator::GREATER;
+        return true;
+    case Comparator::LESS_EQUAL:
+        comparator = Comparator::GREATER_EQUAL;
+        return true;
+    case Comparator::GREATER:
+        comparator = Comparator::LESS;
+        return true;
+    case Comparator::GREATER_EQUAL:
+        comparator = Comparator::LESS_EQUAL;
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <typename T>
+bool compareNumbers(ComparePredicate::Comparator comparator, T left, T right)
+{
+    typedef ComparePredicate::Comparator Comparator;
+    switch (comparator) {
+    case Comparator::EQUALS:
+        return left == right;
+    case Comparator::NOT_EQUALS:
+        return left != right;
+    case Comparator::LESS:
+        return left < right;
+    case Comparator::LESS_EQUAL:
+        return left <= right;
+    case Comparator::GREATER:
+        return left > right;
+    case Comparator::GREATER_EQUAL:
+        return left >= right;
+    default:
+        return false;
+    }
+}
+
+}
+
+const int Program::ACCEPT;
+const int Program::REJECT;
+
+Program::Instruction::Instruction() :
+        opcode(Opcode::CONSTANT),
+        comparator(ComparePredicate::Comparator::EQUALS),
+        type(nullptr),
+        predicate(nullptr),
+        onTrue(REJECT),
+        onFalse(REJECT)
+{
+}
+
+Program::Program(const Predicate& predicate)
+{
+    m_labels.push_back(ACCEPT);
+    m_labels.push_back(REJECT);
+
+    compile(predicate, accept_label, reject_label);
+
+    for (auto& instruction : m_instructions) {
+        instruction.onTrue = m_labels[instruction.onTrue];
+        instruction.onFalse = m_labels[instruction.onFalse];
+    }
+    m_labels.clear();
+}
+
+int Program::newLabel()
+{
+    m_labels.push_back(REJECT);
+    return (int)m_labels.size() - 1;
+}
+
+void Program::placeLabel(int label)
+{
+    m_labels[label] = (int)m_instructions.size();
+}
+
+void Program::emit(Instruction instruction, int onTrue, int onFalse)
+{
+    instruction.onTrue = onTrue;
+    instruction.onFalse = onFalse;
+    m_instructions.push_back(std::move(instruction));
+}
+
+int Program::constantValue(const Predicate& predicate)
+{
+    if (auto compare = dynamic_cast<const ComparePredicate*>(&predicate)) {
+        Atlas::Message::Element left, right;
+        if (constantElement(compare->lhs(), left) && constantElement(compare->rhs(), right)) {
+            return ComparePredicate::compare(compare->comparator(), left, right) ? 1 : 0;
+        }
+    } else if (auto andPredicate = dynamic_cast<const AndPredicate*>(&predicate)) {
+        int lhs = constantValue(*andPredicate->lhs());
+        int rhs = constantValue(*andPredicate->rhs());
+        if (lhs == 0 || rhs == 0) {
+            return 0;
+        }
+        if (lhs == 1 && rhs == 1) {
+            return 1;
+        }
+    } else if (auto orPredicate = dynamic_cast<const OrPredicate*>(&predicate)) {
+        int lhs = constantValue(*orPredicate->lhs());
+        int rhs = constantValue(*orPredicate->rhs());
+        if (lhs == 1 || rhs == 1) {
+            return 1;
+        }
+        if (lhs == 0 && rhs == 0) {
+            return 0;
+        }
+    } else if (auto notPredicate = dynamic_cast<const NotPredicate*>(&predicate)) {
+        int value = constantValue(*notPredicate->predicate());
+        if (value != -1) {
+            return 1 - value;
+        }
+    }
+    return -1;
+}
+
+void Program::compile(const Predicate& predicate, int onTrue, int onFalse)
+{
+    int value = constantValue(predicate);
+    if (value != -1) {
+        int target = value ? onTrue : onFalse;
+        emit(Instruction(), target, target);
+        return;
+    }
+
+    if (auto andPredicate = dynamic_cast<const AndPredicate*>(&predicate)) {
+        //A side which is always true can be dropped.
+        if (constantValue(*andPredicate->lhs()) == 1) {
+            compile(*andPredicate->rhs(), onTrue, onFalse);
+        } else if (constantValue(*andPredicate->rhs()) == 1) {
+            compile(*andPredicate->lhs(), onTrue, onFalse);
+        } else {
+            int next = newLabel();
+            compile(*andPredicate->lhs(), next, onFalse);
+            placeLabel(next);
+            compile(*andPredicate->rhs(), onTrue, onFalse);
+        }
+    } else if (auto orPredicate = dynamic_cast<const OrPredicate*>(&predicate)) {
+        //A side which is always false can be dropped.
+        if (constantValue(*orPredicate->lhs()) == 0) {
+            compile(*orPredicate->rhs(), onTrue, onFalse);
+        } else if (constantValue(*orPredicate->rhs()) == 0) {
+            compile(*orPredicate->lhs(), onTrue, onFalse);
+        } else {
+            int next = newLabel();
+            compile(*orPredicate->lhs(), onTrue, next);
+            placeLabel(next);
+            compile(*orPredicate->rhs(), onTrue, onFalse);
+        }
+    } else if (auto notPredicate = dynamic_cast<const NotPredicate*>(&predicate)) {
+        compile(*notPredicate->predicate(), onFalse, onTrue);
+    } else if (auto compare = dynamic_cast<const ComparePredicate*>(&predicate)) {
+        compileComparison(*compare, onTrue, onFalse);
+    } else {
+        Instruction instruction;
+        instruction.opcode = Opcode::PREDICATE;
+        instruction.predicate = &predicate;
+        emit(instruction, onTrue, onFalse);
+    }
+}
+
+void Program::compileComparison(const ComparePredicate& predicate, int onTrue, int onFalse)
+{
+    typedef ComparePredicate::Comparator Comparator;
+
+    Instruction instruction;
+    instruction.opcode = Opcode::PREDICATE;
+    instruction.predicate = &predicate;
+    instruction.comparator = predicate.comparator();
+
+    const Consumer<QueryContext>* lhs = predicate.lhs();
+    const Consumer<QueryContext>* rhs = predicate.rhs();
+    Atlas::Message::Element constant;
+    if (!constantElement(rhs, constant)) {
+        //Try with the constant on the left side instead.
+        if (constantElement(lhs, constant) && swapComparator(instruction.comparator)) {
+            std::swap(lhs, rhs);
+        } else {
+            emit(instruction, onTrue, onFalse);
+            return;
+        }
+    }
+
+    const Consumer<LocatedEntity>* entityValue = entityConsumer(lhs);
+    if (!entityValue) {
+        emit(instruction, onTrue, onFalse);
+        return;
+    }
+
+    bool equality = instruction.comparator == Comparator::EQUALS || instruction.comparator == Comparator::NOT_EQUALS;
+    //NOT_EQUALS is true when the entity lacks the value, so it's always the negation of EQUALS.
+    if (instruction.comparator == Comparator::NOT_EQUALS) {
+        std::swap(onTrue, onFalse);
+    }
+
+    if (auto typeProvider = dynamic_cast<const EntityTypeProvider*>(entityValue)) {
+        auto typeNameProvider = dynamic_cast<const TypeNodeProvider*>(typeProvider->consumer());
+        if (!typeProvider->consumer() && constant.isPtr()) {
+            if (equality) {
+                instruction.opcode = Opcode::TYPE_EQUALS;
+                instruction.type = static_cast<const TypeNode*>(constant.Ptr());
+            } else if (instruction.comparator == Comparator::INSTANCE_OF) {
+                instruction.opcode = Opcode::INSTANCE_OF;
+                instruction.type = static_cast<const TypeNode*>(constant.Ptr());
+            }
+        } else if (typeNameProvider && typeNameProvider->attributeName() == "name" && equality && constant.isString()) {
+            instruction.opcode = Opcode::TYPE_NAME_EQUALS;
+            instruction.type = Inheritance::instance().getType(constant.String());
+            instruction.constant = constant;
+        }
+    } else if (dynamic_cast<const EntityIdProvider*>(entityValue)) {
+        if (constant.isInt() && instruction.comparator != Comparator::IN && instruction.comparator != Comparator::CONTAINS) {
+            instruction.opcode = Opcode::ID_COMPARE;
+            instruction.constant = constant;
+        }
+    } else if (auto softProvider = dynamic_cast<const SoftPropertyProvider*>(entityValue)) {
+        bool supported = false;
+        switch (instruction.comparator) {
+        case Comparator::EQUALS:
+        case Comparator::NOT_EQUALS:
+            supported = !constant.isNone();
+            break;
+        case Comparator::LESS:
+        case Comparator::LESS_EQUAL:
+        case Comparator::GREATER:
+        case Comparator::GREATER_EQUAL:
+            supported = constant.isNum();
+            break;
+        case Comparator::IN:
+            supported = constant.isList();
+            break;
+        default:
+            break;
+        }
+        if (!softProvider->consumer() && supported) {
+            instruction.opcode = Opcode::PROPERTY_COMPARE;
+            instruction.key = PropertyKey::intern(softProvider->attributeName());
+            instruction.constant = constant;
+        }
+    }
+
+    if (instruction.opcode == Opcode::PREDICATE) {
+        //Not specialised, so let the predicate handle NOT_EQUALS itself.
+        if (instruction.comparator == Comparator::NOT_EQUALS) {
+            std::swap(onTrue, onFalse);
+        }
+        instruction.comparator = predicate.comparator();
+    } else if (instruction.comparator == Comparator::NOT_EQUALS) {
+        instruction.comparator = Comparator::EQUALS;
+    }
+    emit(instruction, onTrue, onFalse);
+}
+
+bool Program::test(const Instruction& instruction, const QueryContext& context)
+{
+    switch (instruction.opcode) {
+    case Opcode::CONSTANT:
+        return true;
+    case Opcode::TYPE_EQUALS:
+        return context.entity.getType() == instruction.type;
+    case Opcode::TYPE_NAME_EQUALS:
+    {
+        const TypeNode* type = context.entity.getType();
+        if (!type) {
+            return false;
+        }
+        //Types known to the inheritance tree when compiled are compared by pointer only.
+        if (instruction.type) {
+            return type == instruction.type;
+        }
+        return type->name() == instruction.constant.String();
+    }
+    case Opcode::INSTANCE_OF:
+    {
+        const TypeNode* type = context.entity.getType();
+        return type && type->isTypeOf(instruction.type);
+    }
+    case Opcode::ID_COMPARE:
+        return compareNumbers<long>(instruction.comparator, context.entity.getIntId(), instruction.constant.Int());
+    case Opcode::PROPERTY_COMPARE:
+    {
+        const PropertyBase* prop = context.entity.getProperty(instruction.key);
+        if (!prop) {
+            return false;
+        }
+        Atlas::Message::Element value;
+        prop->get(value);
+        switch (instruction.comparator) {
+        case ComparePredicate::Comparator::EQUALS:
+            return !value.isNone() && value == instruction.constant;
+        case ComparePredicate::Comparator::IN:
+        {
+            if (value.isNone()) {
+                return false;
+            }
+            auto& list = instruction.constant.List();
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+        default:
+            return value.isNum() && compareNumbers<double>(instruction.comparator, value.asNum(), instruction.constant.asNum());
+        }
+    }
+    case Opcode::PREDICATE:
+        return instruction.predicate->isMatch(context);
+    }
+    return false;
+}
+
+const TypeNode* Program::requiredType() const
+{
+    const Instruction& first = m_instructions.front();
+    if (first.opcode == Opcode::TYPE_EQUALS && first.onFalse == REJECT) {
+        return first.type;
+    }
+    return nullptr;
+}
+
+const TypeNode* Program::requiredBaseType() const
+{
+    const Instruction& first = m_instructions.front();
+    if (first.opcode == Opcode::INSTANCE_OF && first.onFalse == REJECT && first.type != nullptr) {
+        return first.type;
+    }
+    return nullptr;
+}
+
+bool Program::isMatch(const QueryContext& context) const
+{
+    int position = 0;
+    while (position >= 0) {
+        const Instruction& instruction = m_instructions[position];
+        position = test(instruction, context) ? instruction.onTrue : instruction.onFalse;
+    }
+    return position == ACCEPT;
+}
+
+}
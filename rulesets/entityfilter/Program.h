@@ -0,0 +1,135 @@
+/*
+ Copyright (C) 2026 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef RULESETS_FILTER_PROGRAM_H_
+#define RULESETS_FILTER_PROGRAM_H_
+
+#include "Predicates.h"
+
+#include "../../common/PropertyKey.h"
+
+#include <Atlas/Message/Element.h>
+
+#include <vector>
+
+class TypeNode;
+
+namespace EntityFilter
+{
+
+///\brief A parsed predicate lowered into a flat sequence of instructions.
+///
+///Each instruction performs one test against the entity and then jumps to
+///another instruction depending on the outcome, so logical operators are
+///turned into short circuiting jumps instead of nested virtual calls.
+///The most common comparisons are resolved when compiling: type names and
+///type references become TypeNode pointers, property names become keys,
+///and comparisons between constants are folded away. Anything else is
+///left to the original predicate.
+class Program {
+    public:
+        enum class Opcode {
+            ///Always jumps to the same place
+            CONSTANT,
+            ///entity.type = types.foo
+            TYPE_EQUALS,
+            ///entity.type.name = 'foo'
+            TYPE_NAME_EQUALS,
+            ///entity.type instance_of types.foo
+            INSTANCE_OF,
+            ///entity.id compared to an integer
+            ID_COMPARE,
+            ///entity.foo compared to a constant
+            PROPERTY_COMPARE,
+            ///Any other comparison, evaluated by the predicate itself
+            PREDICATE
+        };
+
+        ///Jump target for a successful match
+        static const int ACCEPT = -1;
+        ///Jump target for a failed match
+        static const int REJECT = -2;
+
+        struct Instruction {
+            Opcode opcode;
+            ComparePredicate::Comparator comparator;
+            ///Resolved type for the type checks
+            const TypeNode* type;
+            ///Resolved key of the compared property
+            PropertyKey key;
+            ///The constant compared against
+            Atlas::Message::Element constant;
+            ///The predicate evaluated by PREDICATE instructions
+            const Predicate* predicate;
+            ///Instruction to continue with if the test succeeded
+            int onTrue;
+            ///Instruction to continue with if the test failed
+            int onFalse;
+
+            Instruction();
+        };
+
+        ///\brief Compile a predicate.
+        ///
+        ///The predicate must outlive the program.
+        explicit Program(const Predicate& predicate);
+
+        bool isMatch(const QueryContext& context) const;
+
+        const std::vector<Instruction>& instructions() const
+        {
+            return m_instructions;
+        }
+
+        ///\brief Get the type every matching entity must have, if any.
+        ///
+        ///This is the case when the query starts with "entity.type = types.foo"
+        ///and no match is possible without it, which lets a search only look
+        ///at entities of that type.
+        const TypeNode* requiredType() const;
+
+        ///\brief Get the type every matching entity must inherit from, if any.
+        ///
+        ///This is the case when the query starts with "entity instance_of types.foo"
+        ///and no match is possible without it.
+        const TypeNode* requiredBaseType() const;
+
+    private:
+        std::vector<Instruction> m_instructions;
+
+        ///Instruction index of each label, or ACCEPT/REJECT
+        std::vector<int> m_labels;
+
+        int newLabel();
+
+        void placeLabel(int label);
+
+        void compile(const Predicate& predicate, int onTrue, int onFalse);
+
+        void compileComparison(const ComparePredicate& predicate, int onTrue, int onFalse);
+
+        void emit(Instruction instruction, int onTrue, int onFalse);
+
+        static int constantValue(const Predicate& predicate);
+
+        static bool test(const Instruction& instruction, const QueryContext& context);
+};
+
+}
+
+#endif
@@ -79,6 +79,8 @@ class ProviderBase {
     public:
         ProviderBase(Consumer<T>* consumer);
         virtual ~ProviderBase();
+
+        const Consumer<T>* consumer() const { return m_consumer; }
     protected:
         Consumer<T>* m_consumer;
 };
@@ -124,6 +126,8 @@ template <typename T>
 class NamedAttributeProviderBase : public ProviderBase<T> {
     public:
         NamedAttributeProviderBase(Consumer<T>* consumer, const std::string& attribute_name);
+
+        const std::string& attributeName() const { return m_attribute_name; }
     protected:
         const std::string m_attribute_name;
 };
@@ -163,6 +167,8 @@ class FixedElementProvider : public Consumer<QueryContext> {
     public:
         FixedElementProvider(const Atlas::Message::Element& element);
         virtual void value(Atlas::Message::Element& value, const QueryContext& context) const;
+
+        const Atlas::Message::Element& element() const { return m_element; }
     protected:
         const Atlas::Message::Element m_element;
 };
@@ -172,6 +178,8 @@ class FixedTypeNodeProvider : public ConsumingProviderBase<TypeNode, QueryContex
         FixedTypeNodeProvider(Consumer<TypeNode>* consumer, const TypeNode& type);
         virtual void value(Atlas::Message::Element& value, const QueryContext& context) const;
         virtual const std::type_info* getType() const;
+
+        const TypeNode& typeNode() const { return m_type; }
     protected:
         const TypeNode& m_type;
 };
@@ -213,6 +221,8 @@ class TypeNodeProvider : public Consumer<TypeNode>
     public:
         TypeNodeProvider(const std::string& attribute_name);
         virtual void value(Atlas::Message::Element& value, const TypeNode& type) const;
+
+        const std::string& attributeName() const { return m_attribute_name; }
     private:
         const std::string m_attribute_name;
 };
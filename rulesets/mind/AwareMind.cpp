@@ -38,17 +38,57 @@
 
 #include <wfmath/atlasconv.h>
 
+#include <limits>
+
 static const bool debug_flag = true;
 
+int AwareMind::s_pathSearchIterations = 500;
+bool AwareMind::s_crowdAvoidance = false;
+float AwareMind::s_lodDistance = 0;
+int AwareMind::s_lodMinds[AwareMind::LOD_LEVELS] = {};
+
+/**
+ * @brief The minimum time between crowd avoidance passes, in seconds.
+ */
+static const double CROWD_AVOIDANCE_INTERVAL = 0.1;
+
+/**
+ * @brief The minimum time between path searches of an awareness, in seconds; the default move tick.
+ */
+static const double PATH_SEARCH_INTERVAL = 0.2;
+
+/**
+ * @brief How many times longer the intervals between ticks are at each level of detail.
+ */
+static const double LOD_TICK_SCALES[AwareMind::LOD_LEVELS] = { 1, 2, 6 };
+
+/**
+ * @brief The minimum time between updates of the level of detail, in seconds.
+ */
+static const double LOD_UPDATE_INTERVAL = 1.0;
+
+/**
+ * @brief Checks if the entity is controlled by a player, rather than by an AI.
+ */
+static bool isPlayer(const MemEntity& entity)
+{
+    Atlas::Message::Element player;
+    return entity.getAttr("player", player) == 0 && player.isInt() && player.Int() != 0;
+}
+
 AwareMind::AwareMind(const std::string &id, long intId, SharedTerrain& sharedTerrain, AwarenessStoreProvider& awarenessStoreProvider) :
         BaseMind(id, intId),
         mSharedTerrain(sharedTerrain),
         mAwarenessStoreProvider(awarenessStoreProvider),
         mAwarenessStore(nullptr),
         mSteering(new Steering(*this)),
-        mServerTimeDiff(0)
+        mServerTimeDiff(0),
+        mLodLevel(0),
+        mLodTimestamp(0)
 {
     m_map.setListener(this);
+    mSteering->setCrowdAvoidance(s_crowdAvoidance);
+    s_lodMinds[mLodLevel]++;
 }
 
 AwareMind::~AwareMind()
@@ -65,6 +105,7 @@ AwareMind::~AwareMind()
         mAwareness->removeObserver();
     }
     delete mSteering;
+    s_lodMinds[mLodLevel]--;
 }
 
 void AwareMind::operation(const Operation & op, OpVector & res)
@@ -103,15 +144,54 @@ double AwareMind::getCurrentServerTime() const
     return getCurrentLocalTime() - mServerTimeDiff;
 }
 
+double AwareMind::getTickIntervalScale() const
+{
+    return LOD_TICK_SCALES[mLodLevel];
+}
+
+void AwareMind::updateLodLevel()
+{
+    if (s_lodDistance <= 0 || !m_location.pos().isValid()) {
+        return;
+    }
+    //Players elsewhere are as good as far away.
+    float nearest = std::numeric_limits<float>::max();
+    for (auto player : mPlayers) {
+        if (player->m_location.m_loc == m_location.m_loc && player->m_location.pos().isValid()) {
+            nearest = std::min(nearest, squareDistance(player->m_location.pos(), m_location.pos()));
+        }
+    }
+
+    int level = 0;
+    if (nearest > (s_lodDistance * 4) * (s_lodDistance * 4)) {
+        level = 2;
+    } else if (nearest > s_lodDistance * s_lodDistance) {
+        level = 1;
+    }
+
+    if (level != mLodLevel) {
+        s_lodMinds[mLodLevel]--;
+        s_lodMinds[level]++;
+        mLodLevel = level;
+    }
+}
+
 void AwareMind::processMoveTick(const Operation & op, OpVector & res)
 {
-    //Default to checking movement every 0.2 seconds, unless steering tells us otherwise
-    double futureTick = 0.2;
+    double localTime = getCurrentLocalTime();
+    if (localTime - mLodTimestamp >= LOD_UPDATE_INTERVAL) {
+        mLodTimestamp = localTime;
+        updateLodLevel();
+    }
+
+    //Default to checking movement every 0.2 seconds, less often when far from players, unless steering tells us otherwise
+    double futureTick = 0.2 * getTickIntervalScale();
 
     if (mAwareness) {
         auto remainingDirtyTiles = mAwareness->rebuildDirtyTile();
         if (remainingDirtyTiles > 0) {
-            futureTick = 0;
+            //Don't spin while waiting for tiles being built in the background.
+            futureTick = mAwareness->tilesInProgress() > 0 ? 0.05 : 0;
         } else {
             if (mAwareness->needsPruning()) {
                 mAwareness->pruneTiles();
@@ -120,6 +200,10 @@ void AwareMind::processMoveTick(const Operation & op, OpVector & res)
                 futureTick = 0;
             }
         }
+        mAwareness->processPathRequests(s_pathSearchIterations, getCurrentServerTime(), PATH_SEARCH_INTERVAL);
+        if (s_crowdAvoidance) {
+            mAwareness->updateCrowd(getCurrentServerTime(), CROWD_AVOIDANCE_INTERVAL);
+        }
     }
 
     if (mSteering) {
@@ -152,6 +236,11 @@ void AwareMind::processMoveTick(const Operation & op, OpVector & res)
         }
     }
 
+    //Come back when the next search is done, if we're waiting for a path. Other minds' requests are no reason to.
+    if (mSteering && mSteering->hasPendingPathRequest()) {
+        futureTick = std::min(PATH_SEARCH_INTERVAL, futureTick);
+    }
+
     Atlas::Objects::Operation::Tick tick;
     Atlas::Objects::Entity::Anonymous arg;
     arg->setName("move");
@@ -180,6 +269,9 @@ void AwareMind::setType(const TypeNode * t)
 
 void AwareMind::entityAdded(const MemEntity& entity)
 {
+    if (isPlayer(entity)) {
+        mPlayers.insert(&entity);
+    }
     if (mAwareness) {
 //        log(INFO, String::compose("Adding entity %1", entity.getId()));
         //TODO: check if the entity is dynamic
@@ -219,6 +311,13 @@ void AwareMind::requestAwareness(const MemEntity& entity)
 
 void AwareMind::entityUpdated(const MemEntity& entity, const Atlas::Objects::Entity::RootEntity & ent, LocatedEntity* oldLocation)
 {
+    if (ent->hasAttr("player")) {
+        if (isPlayer(entity)) {
+            mPlayers.insert(&entity);
+        } else {
+            mPlayers.erase(&entity);
+        }
+    }
     if (mAwareness) {
         //Update the awareness if location, position, velocity, orientation or bbox has changed
         if (ent->hasAttrFlag(Atlas::Objects::Entity::LOC_FLAG) || ent->hasAttrFlag(Atlas::Objects::Entity::POS_FLAG) || ent->hasAttrFlag(Atlas::Objects::Entity::VELOCITY_FLAG)
@@ -306,6 +405,7 @@ void AwareMind::parseTerrain(const Atlas::Message::Element& terrainElement)
 
 void AwareMind::entityDeleted(const MemEntity& entity)
 {
+    mPlayers.erase(&entity);
     if (mAwareness) {
         //log(INFO, "Removed entity.");
         mAwareness->removeEntity(*this, entity);
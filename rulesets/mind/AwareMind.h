@@ -21,6 +21,8 @@
 #include "rulesets/BaseMind.h"
 #include "rulesets/MemMap.h"
 
+#include <set>
+
 class Awareness;
 class AwarenessStore;
 class AwarenessStoreProvider;
@@ -36,6 +38,33 @@ class AwareMind: public BaseMind, public MemMap::MapListener
         AwareMind(const std::string &id, long intId, SharedTerrain& sharedTerrain, AwarenessStoreProvider& awarenessStoreProvider);
         virtual ~AwareMind();
 
+        /**
+         * @brief The max number of path search iterations done on each movement tick.
+         */
+        static int s_pathSearchIterations;
+
+        /**
+         * @brief If true, obstacles are avoided by doing one pass for all agents sharing an awareness, instead of each agent scanning for obstacles.
+         */
+        static bool s_crowdAvoidance;
+
+        /**
+         * @brief The distance to the nearest player within which minds think and move at full rate.
+         *
+         * Minds farther away do so less often. Zero runs all minds at full rate.
+         */
+        static float s_lodDistance;
+
+        /**
+         * @brief The number of levels of detail minds can run at, with zero being full rate.
+         */
+        static const int LOD_LEVELS = 3;
+
+        /**
+         * @brief The number of minds at each level of detail.
+         */
+        static int s_lodMinds[LOD_LEVELS];
+
         void entityAdded(const MemEntity& entity);
         void entityUpdated(const MemEntity& entity, const Atlas::Objects::Entity::RootEntity & ent, LocatedEntity* oldLocation);
         void entityDeleted(const MemEntity& entity);
@@ -54,6 +83,11 @@ class AwareMind: public BaseMind, public MemMap::MapListener
 
         double getCurrentServerTime() const;
 
+        /**
+         * @brief Gets how many times longer than normal the intervals between ticks should be, given the level of detail.
+         */
+        double getTickIntervalScale() const;
+
     protected:
 
         SharedTerrain& mSharedTerrain;
@@ -72,10 +106,27 @@ class AwareMind: public BaseMind, public MemMap::MapListener
          */
         double mServerTimeDiff;
 
+        /**
+         * @brief Known entities controlled by players.
+         */
+        std::set<const MemEntity*> mPlayers;
+
+        /**
+         * @brief The current level of detail, based on the distance to the nearest player.
+         */
+        int mLodLevel;
+
+        /**
+         * @brief Local time of the last update of the level of detail.
+         */
+        double mLodTimestamp;
+
         void onContainered(const LocatedEntity * new_loc) override;
 
         void processMoveTick(const Operation & op, OpVector & res);
 
+        void updateLodLevel();
+
         void requestAwareness(const MemEntity& entity);
 
         void parseTerrain(const Atlas::Message::Element& terrainElement);
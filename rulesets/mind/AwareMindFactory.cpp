@@ -21,14 +21,21 @@
 
 #include <rulesets/mind/AwareMindFactory.h>
 #include <rulesets/mind/AwareMind.h>
+#include "navigation/TileBuildPool.h"
+#include "navigation/TileDiskCache.h"
 
 
-AwareMindFactory::AwareMindFactory()
-: mSharedTerrain(new SharedTerrain()), mAwarenessStoreProvider(new AwarenessStoreProvider(*mSharedTerrain))
+AwareMindFactory::AwareMindFactory(unsigned int tileBuildThreads, const std::string& tileCacheDirectory, std::uintmax_t tileCacheSize)
+: mTileDiskCache(tileCacheDirectory.empty() ? nullptr : new TileDiskCache(tileCacheDirectory, tileCacheSize)),
+  mTileBuildPool(tileBuildThreads > 0 ? new TileBuildPool(tileBuildThreads) : nullptr),
+  mSharedTerrain(new SharedTerrain()),
+  mAwarenessStoreProvider(new AwarenessStoreProvider(*mSharedTerrain, mTileBuildPool.get(), mTileDiskCache.get()))
 {
 
 }
 
+AwareMindFactory::~AwareMindFactory() = default;
+
 BaseMind * AwareMindFactory::newMind(const std::string & id, long intId) const
 {
     return new AwareMind(id, intId, *mSharedTerrain, *mAwarenessStoreProvider);
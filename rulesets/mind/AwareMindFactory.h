@@ -23,19 +23,34 @@
 #include <rulesets/mind/SharedTerrain.h>
 
 #include "rulesets/MindFactory.h"
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 
 class AwarenessStore;
+class TileBuildPool;
+class TileDiskCache;
 
 class AwareMindFactory : public MindKit
 {
     public:
-        AwareMindFactory();
-        ~AwareMindFactory() override = default;
+        /**
+         * @param tileBuildThreads The number of threads building navmesh tiles. If zero tiles are built on the main thread.
+         * @param tileCacheDirectory A directory in which built navmesh tiles are kept between runs. If empty no tiles are kept.
+         * @param tileCacheSize The max total size of the tiles kept, in bytes. Zero for no limit.
+         */
+        explicit AwareMindFactory(unsigned int tileBuildThreads = 0, const std::string& tileCacheDirectory = "",
+                                  std::uintmax_t tileCacheSize = 0);
+        ~AwareMindFactory() override;
 
         BaseMind * newMind(const std::string & id, long) const override;
 
     protected:
+        /**
+         * @brief Declared before the pool, since the jobs of the pool use it until the pool is destroyed.
+         */
+        std::unique_ptr<TileDiskCache> mTileDiskCache;
+        std::unique_ptr<TileBuildPool> mTileBuildPool;
         SharedTerrain* mSharedTerrain;
         AwarenessStoreProvider* mAwarenessStoreProvider;
 
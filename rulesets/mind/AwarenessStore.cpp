@@ -24,8 +24,8 @@
 
 #include <rulesets/mind/AwarenessStore.h>
 
-AwarenessStore::AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize) :
-        mAgentRadius(agentRadius), mAgentHeight(agentHeight), mHeightProvider(heightProvider), mTileSize(tileSize)
+AwarenessStore::AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize, TileBuildPool* tileBuildPool, TileDiskCache* tileDiskCache) :
+        mAgentRadius(agentRadius), mAgentHeight(agentHeight), mHeightProvider(heightProvider), mTileSize(tileSize), mTileBuildPool(tileBuildPool), mTileDiskCache(tileDiskCache)
 {
 }
 
@@ -48,7 +48,7 @@ std::shared_ptr<Awareness> AwarenessStore::requestAwareness(const LocatedEntity&
 
     auto bbox = domainEntity.m_location.bBox();
 
-    auto awareness = std::make_shared < Awareness > (domainEntity, mAgentRadius, mAgentHeight, mHeightProvider, bbox, mTileSize);
+    auto awareness = std::make_shared < Awareness > (domainEntity, mAgentRadius, mAgentHeight, mHeightProvider, bbox, mTileSize, mTileBuildPool, mTileDiskCache);
     m_awarenesses.insert(std::make_pair(domainEntity.getIntId(), std::weak_ptr < Awareness > (awareness)));
     return awareness;
 }
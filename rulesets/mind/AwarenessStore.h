@@ -26,13 +26,15 @@
 
 class IHeightProvider;
 class Awareness;
+class TileBuildPool;
+class TileDiskCache;
 class LocatedEntity;
 
 
 class AwarenessStore
 {
     public:
-        AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize = 64);
+        AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize = 64, TileBuildPool* tileBuildPool = nullptr, TileDiskCache* tileDiskCache = nullptr);
         virtual ~AwarenessStore();
 
         std::shared_ptr<Awareness> requestAwareness(const LocatedEntity& domainEntity);
@@ -49,6 +51,16 @@ class AwarenessStore
 
         int mTileSize;
 
+        /**
+         * @brief An optional pool on which tiles are built.
+         */
+        TileBuildPool* mTileBuildPool;
+
+        /**
+         * @brief An optional cache of built tiles.
+         */
+        TileDiskCache* mTileDiskCache;
+
         /**
          * @brief A map of existing awarenesses, ordered by the id of the domain entity.
          */
@@ -30,8 +30,8 @@
 static const bool debug_flag = false;
 
 
-AwarenessStoreProvider::AwarenessStoreProvider(IHeightProvider& heightProvider)
-: m_heightProvider(heightProvider)
+AwarenessStoreProvider::AwarenessStoreProvider(IHeightProvider& heightProvider, TileBuildPool* tileBuildPool, TileDiskCache* tileDiskCache)
+: m_heightProvider(heightProvider), m_tileBuildPool(tileBuildPool), m_tileDiskCache(tileDiskCache)
 {
     // TODO Auto-generated constructor stub
 
@@ -59,7 +59,7 @@ AwarenessStore& AwarenessStoreProvider::getStore(const TypeNode* type, int tileS
         agentRadius = std::max(0.2f, agent2dBbox.boundingSphere().radius()); //Don't make the radius smaller than 0.2 meters, to avoid too many cells
     }
 
-    return m_awarenessStores.emplace(type->name(), AwarenessStore(agentRadius, agentHeight, m_heightProvider, tileSize)).first->second;
+    return m_awarenessStores.emplace(type->name(), AwarenessStore(agentRadius, agentHeight, m_heightProvider, tileSize, m_tileBuildPool, m_tileDiskCache)).first->second;
 
 }
 
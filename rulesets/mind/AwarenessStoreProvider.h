@@ -28,11 +28,13 @@
 
 class TypeNode;
 class IHeightProvider;
+class TileBuildPool;
+class TileDiskCache;
 
 class AwarenessStoreProvider
 {
     public:
-        explicit AwarenessStoreProvider(IHeightProvider& heightProvider);
+        explicit AwarenessStoreProvider(IHeightProvider& heightProvider, TileBuildPool* tileBuildPool = nullptr, TileDiskCache* tileDiskCache = nullptr);
         virtual ~AwarenessStoreProvider() = default;
 
         AwarenessStore& getStore(const TypeNode* type, int tileSize = 64);
@@ -40,6 +42,8 @@ class AwarenessStoreProvider
     protected:
         std::unordered_map<std::string, AwarenessStore> m_awarenessStores;
         IHeightProvider& m_heightProvider;
+        TileBuildPool* m_tileBuildPool;
+        TileDiskCache* m_tileDiskCache;
 
 };
 
@@ -23,6 +23,11 @@
 
 #include <Mercator/Segment.h>
 
+#include <algorithm>
+#include <cmath>
+
+SharedTerrain::HeightStatistics SharedTerrain::s_heightStatistics;
+
 SharedTerrain::SharedTerrain() :
         m_terrain(new Mercator::Terrain())
 {
@@ -30,10 +35,12 @@ SharedTerrain::SharedTerrain() :
 
 SharedTerrain::~SharedTerrain()
 {
+    s_heightStatistics.segmentsCached -= m_heightCache.size();
 }
 
 std::vector<SharedTerrain::BasePointDefinition> SharedTerrain::setBasePoints(const std::vector<BasePointDefinition>& basepoints)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     std::vector<BasePointDefinition> changedPoints;
     for (auto& basepointDef : basepoints) {
         Mercator::BasePoint existingPoint;
@@ -42,11 +49,52 @@ std::vector<SharedTerrain::BasePointDefinition> SharedTerrain::setBasePoints(con
                         || existingPoint.roughness() != basepointDef.basePoint.roughness())) {
             m_terrain->setBasePoint(basepointDef.x, basepointDef.y, basepointDef.basePoint);
             changedPoints.push_back(basepointDef);
+
+            //A base point is a corner of the four segments around it.
+            for (int segmentX = basepointDef.x - 1; segmentX <= basepointDef.x; ++segmentX) {
+                for (int segmentY = basepointDef.y - 1; segmentY <= basepointDef.y; ++segmentY) {
+                    s_heightStatistics.segmentsCached -= m_heightCache.erase(std::make_pair(segmentX, segmentY));
+                }
+            }
         }
     }
     return std::move(changedPoints);
 }
 
+SharedTerrain::SegmentHeights SharedTerrain::getSegmentHeights(int segmentX, int segmentY) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto key = std::make_pair(segmentX, segmentY);
+    auto I = m_heightCache.find(key);
+    if (I != m_heightCache.end()) {
+        return I->second;
+    }
+
+    Mercator::Segment* segment = m_terrain->getSegmentAtIndex(segmentX, segmentY);
+    if (!segment) {
+        return SegmentHeights();
+    }
+    if (!segment->isValid()) {
+        segment->populate();
+        s_heightStatistics.segmentsPopulated++;
+    }
+
+    int segmentResolution = m_terrain->getResolution();
+    int segmentSize = segment->getSize();
+    const float* points = segment->getPoints();
+    auto heights = std::make_shared<std::vector<float>>(segmentResolution * segmentResolution);
+    for (int y = 0; y < segmentResolution; ++y) {
+        const float* row = points + (y * segmentSize);
+        std::copy(row, row + segmentResolution, heights->begin() + (y * segmentResolution));
+    }
+    //The cache now has all the heights needed, so there's no need to keep the points twice.
+    segment->invalidate();
+
+    m_heightCache.emplace(key, heights);
+    s_heightStatistics.segmentsCached++;
+    return heights;
+}
+
 void SharedTerrain::blitHeights(int xMin, int xMax, int yMin, int yMax, std::vector<float>& heights) const
 {
     int segmentResolution = m_terrain->getResolution();
@@ -57,6 +105,8 @@ void SharedTerrain::blitHeights(int xMin, int xMax, int yMin, int yMax, std::vec
     int segmentYMin = std::lround(floor(yMin / (double)segmentResolution));
     int segmentYMax = std::lround(floor(yMax / (double)segmentResolution));
 
+    size_t bytesCopied = 0;
+
     for (int segmentX = segmentXMin; segmentX <= segmentXMax; ++segmentX) {
         for (int segmentY = segmentYMin; segmentY <= segmentYMax; ++segmentY) {
 
@@ -69,29 +119,32 @@ void SharedTerrain::blitHeights(int xMin, int xMax, int yMin, int yMax, std::vec
             int yStart = std::max(yMin - segmentYStart, 0);
             int xEnd = std::min<int>(xMax - segmentXStart, segmentResolution);
             int yEnd = std::min<int>(yMax - segmentYStart, segmentResolution);
+            if (xStart >= xEnd || yStart >= yEnd) {
+                continue;
+            }
 
-            Mercator::Segment* segment = m_terrain->getSegmentAtIndex(segmentX, segmentY);
-            if (segment) {
-                if (!segment->isValid()) {
-                    segment->populate();
-                }
-
-                for (int x = xStart; x < xEnd; ++x) {
-                    for (int y = yStart; y < yEnd; ++y) {
-                        heights[((dataYOffset + y) * xSize) + (dataXOffset + x)] = segment->get(x, y);
-                    }
+            auto dataRow = heights.begin() + (dataXOffset + xStart);
+            SegmentHeights segmentHeights = getSegmentHeights(segmentX, segmentY);
+            if (segmentHeights) {
+                //Both the segment and the data are stored in rows, so copy a row at a time.
+                for (int y = yStart; y < yEnd; ++y) {
+                    auto row = segmentHeights->begin() + (y * segmentResolution);
+                    std::copy(row + xStart, row + xEnd, dataRow + ((dataYOffset + y) * xSize));
                 }
+                bytesCopied += (xEnd - xStart) * (yEnd - yStart) * sizeof(float);
             } else {
                 //No valid segment found; fill with default value of -10.
-                for (int x = xStart; x < xEnd; ++x) {
-                    for (int y = yStart; y < yEnd; ++y) {
-                        heights[((dataYOffset + y) * xSize) + (dataXOffset + x)] = -10;
-                    }
+                for (int y = yStart; y < yEnd; ++y) {
+                    auto row = dataRow + ((dataYOffset + y) * xSize);
+                    std::fill(row, row + (xEnd - xStart), -10.f);
                 }
-
             }
         }
     }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    s_heightStatistics.blits++;
+    s_heightStatistics.blitBytes = bytesCopied;
 }
 
 const Mercator::Terrain& SharedTerrain::getTerrain() const
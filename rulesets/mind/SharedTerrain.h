@@ -22,17 +22,45 @@
 
 #include <Mercator/Terrain.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 
 /**
  * @brief A terrain representation that's shared between multiple entities.
  *
+ * The heights of each segment are copied into an immutable cache the first time they're
+ * blitted, so that the tiles of all awarenesses sharing the terrain don't need to look
+ * up and populate the Mercator segments again. The cache is safe to read from multiple threads.
  */
 class SharedTerrain : public IHeightProvider
 {
     public:
 
+        /**
+         * @brief Statistics for the height blits of all shared terrains.
+         */
+        struct HeightStatistics
+        {
+            int blits = 0;
+            /**
+             * @brief The number of Mercator segments which have been populated.
+             */
+            int segmentsPopulated = 0;
+            /**
+             * @brief The number of segments currently in the height cache.
+             */
+            int segmentsCached = 0;
+            /**
+             * @brief The number of bytes copied by the last blit.
+             */
+            int blitBytes = 0;
+        };
+
+        static HeightStatistics s_heightStatistics;
+
         struct BasePointDefinition {
             int x;
             int y;
@@ -46,6 +74,7 @@ class SharedTerrain : public IHeightProvider
          * @brief Sets base points.
          *
          * Only those that have changed are processed. It's thus safe to call this from each entity sharing this instance.
+         * The cached heights of the segments touching a changed point are discarded.
          * @param basepoints
          */
         std::vector<BasePointDefinition> setBasePoints(const std::vector<BasePointDefinition>& basepoints);
@@ -56,7 +85,28 @@ class SharedTerrain : public IHeightProvider
 
     private:
 
+        typedef std::shared_ptr<const std::vector<float>> SegmentHeights;
+
         std::unique_ptr<Mercator::Terrain> m_terrain;
+
+        /**
+         * @brief Guards the terrain and the height cache.
+         */
+        mutable std::mutex m_mutex;
+
+        /**
+         * @brief Heights of segments, by segment index, in rows of "resolution" values.
+         *
+         * An entry is replaced rather than altered, so that blits holding on to it aren't affected.
+         */
+        mutable std::map<std::pair<int, int>, SegmentHeights> m_heightCache;
+
+        /**
+         * @brief Gets the cached heights of a segment, populating the segment if needed.
+         *
+         * @return Null if there's no segment at the index.
+         */
+        SegmentHeights getSegmentHeights(int segmentX, int segmentY) const;
 };
 
 #endif /* RULESETS_MIND_SHAREDTERRAIN_H_ */
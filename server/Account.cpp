@@ -85,12 +85,13 @@ void Account::characterDestroyed(long id)
 /// \brief Connect an existing character to this account
 ///
 /// \brief chr The character to connect to this account
+/// \brief possessed true if the character is possessed by an AI client
 /// \return Returns 0 on success and -1 on failure.
-int Account::connectCharacter(LocatedEntity *chr)
+int Account::connectCharacter(LocatedEntity *chr, bool possessed)
 {
     Character * character = dynamic_cast<Character *>(chr);
     if (character) {
-        if (character->linkExternal(m_connection) != 0) {
+        if (character->linkExternal(m_connection, possessed) != 0) {
             log(WARNING, String::compose("Account %1 (%2) could not take character %3 as it "
                 "already is connected to an external mind with id %4.",
                                          getId(), m_username, chr->getId(), character->m_externalMind->getLink()));
@@ -619,7 +620,7 @@ void Account::LookOperation(const Operation & op, OpVector & res)
         if (character) {
             // FIXME If we don't succeed in connecting, no need to carry on
             // and we probably need to indicate to the client
-            if (connectCharacter(character) == 0) {
+            if (connectCharacter(character, true) == 0) {
                 PossessionAuthenticator::instance()->removePossession(to);
                 logEvent(POSSESS_CHAR,
                          String::compose("%1 %2 %3 Claimed character (%4) "
@@ -80,7 +80,7 @@ class Account : public ConnectableRouter {
 
   public:
     /// \brief Connect and add a character to this account
-    int connectCharacter(LocatedEntity *chr);
+    int connectCharacter(LocatedEntity *chr, bool possessed = false);
 
     Account(Connection * conn, const std::string & username,
                                const std::string & passwd,
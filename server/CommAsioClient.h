@@ -54,6 +54,34 @@ class CommAsioClient: public Atlas::Objects::ObjectsDecoder,
         /// \brief STL deque of pointers to operation objects.
         typedef std::deque<Atlas::Objects::Operation::RootOperation> DispatchQueue;
 
+        /**
+         * @brief Statistics for the traffic of all clients using the protocol.
+         *
+         * The reads, writes and decoding time are reported for each thousand
+         * operations received, which shows how well clients batch their operations.
+         * Only the writes of replies to the operations of a read are counted; other
+         * operations such as sight broadcasts are sent regardless of the batching.
+         */
+        struct Statistics
+        {
+            int opsReceived = 0;
+            int readsPerKiloOp = 0;
+            int writesPerKiloOp = 0;
+            int decodeMicrosecondsPerKiloOp = 0;
+
+            /**
+             * @brief Counts since the values per thousand operations were last updated.
+             */
+            int windowOps = 0;
+            int windowReads = 0;
+            int windowWrites = 0;
+            long windowDecodeMicroseconds = 0;
+
+            void read(size_t ops, long decodeMicroseconds);
+        };
+
+        static Statistics s_statistics;
+
         void disconnect() override;
 
         int flush() override;
@@ -98,6 +126,12 @@ class CommAsioClient: public Atlas::Objects::ObjectsDecoder,
          */
         bool mShouldSend;
 
+        /**
+         * True while the operations of a read are dispatched. Anything sent meanwhile is written
+         * once they've all been dispatched, rather than for each operation.
+         */
+        bool mIsDispatching;
+
         enum
         {
             /**
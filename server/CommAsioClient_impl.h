@@ -38,18 +38,40 @@
 
 #include <Atlas/Codecs/Bach.h>
 
+#include <chrono>
 #include <sstream>
 #include <iostream>
 
 static const bool comm_asio_client_debug_flag = false;
 
+template<class ProtocolT>
+typename CommAsioClient<ProtocolT>::Statistics CommAsioClient<ProtocolT>::s_statistics;
+
+template<class ProtocolT>
+void CommAsioClient<ProtocolT>::Statistics::read(size_t ops, long decodeMicroseconds)
+{
+    opsReceived += ops;
+    windowOps += ops;
+    windowReads++;
+    windowDecodeMicroseconds += decodeMicroseconds;
+    if (windowOps >= 1000) {
+        readsPerKiloOp = (windowReads * 1000L) / windowOps;
+        writesPerKiloOp = (windowWrites * 1000L) / windowOps;
+        decodeMicrosecondsPerKiloOp = (windowDecodeMicroseconds * 1000L) / windowOps;
+        windowOps = 0;
+        windowReads = 0;
+        windowWrites = 0;
+        windowDecodeMicroseconds = 0;
+    }
+}
+
 
 template<class ProtocolT>
 CommAsioClient<ProtocolT>::CommAsioClient(const std::string& name,
                                           boost::asio::io_service& io_service) :
     CommSocket(io_service), mSocket(io_service), mWriteBuffer(new boost::asio::streambuf()), mSendBuffer(new boost::asio::streambuf()), mInStream(&mReadBuffer),
     mOutStream(mWriteBuffer), mNegotiateTimer(io_service, boost::posix_time::seconds(1)), mIsSending(false), mShouldSend(false),
-    m_codec(nullptr), m_encoder(nullptr), m_negotiate(nullptr), m_link(nullptr), mName(name)
+    mIsDispatching(false), m_codec(nullptr), m_encoder(nullptr), m_negotiate(nullptr), m_link(nullptr), mName(name)
 {
 }
 
@@ -86,7 +108,10 @@ void CommAsioClient<ProtocolT>::do_read()
                             [this, self](boost::system::error_code ec, std::size_t length) {
                                 if (!ec) {
                                     mReadBuffer.commit(length);
+                                    auto decodeStart = std::chrono::steady_clock::now();
                                     m_codec->poll(true);
+                                    s_statistics.read(m_opQueue.size(), std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - decodeStart).count());
                                     this->dispatch();
                                     //By calling do_read again we make sure that the instance
                                     //doesn't go out of scope ("shared_from this"). As soon as that
@@ -288,13 +313,26 @@ int CommAsioClient<ProtocolT>::operation(
 template<class ProtocolT>
 void CommAsioClient<ProtocolT>::dispatch()
 {
+    //Clients may send many operations at once; reply to them all in one write.
+    mIsDispatching = true;
+    auto buffered = mWriteBuffer->size();
+    bool dispatched = true;
     auto Iend = m_opQueue.end();
     for (auto I = m_opQueue.begin(); I != Iend; ++I) {
         if (operation(*I) != 0) {
-            return;
+            dispatched = false;
+            break;
         }
     }
-    m_opQueue.clear();
+    if (dispatched) {
+        m_opQueue.clear();
+    }
+    mIsDispatching = false;
+    //Count the write which replies to the operations, if there was any reply.
+    if (mWriteBuffer->size() > buffered) {
+        s_statistics.windowWrites++;
+    }
+    write();
 }
 
 template<class ProtocolT>
@@ -366,7 +404,9 @@ void CommAsioClient<ProtocolT>::disconnect()
 template<class ProtocolT>
 int CommAsioClient<ProtocolT>::flush()
 {
-    write();
+    if (!mIsDispatching) {
+        write();
+    }
     return 0;
 }
 
@@ -27,6 +27,7 @@
 #include "common/log.h"
 #include "common/compose.hpp"
 #include "common/debug.h"
+#include "common/Monitors.h"
 #include "rulesets/Character.h"
 #include "rulesets/ExternalMind.h"
 
@@ -36,10 +37,14 @@
 
 #include <sigc++/bind.h>
 
+#include <vector>
+
 static const bool debug_flag = false;
 
 ExternalMindsManager * ExternalMindsManager::m_instance = nullptr;
 
+double ExternalMindsManager::s_possessionRequestTimeout = 30;
+
 ExternalMindsManager * ExternalMindsManager::instance()
 {
     if (m_instance == nullptr) {
@@ -67,10 +72,17 @@ int ExternalMindsManager::addConnection(
                             "There are now %2 connections.",
                     connection.getRouterId(), m_connections.size()));
 
-    //As we now have a new connection we'll see if there are any minds in waiting
+    updateConnectionMonitor(connection.getRouterId());
 
+    //As we now have a new connection we'll see if there are any minds in waiting.
+    //Those recently requested from another connection are left with it.
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<double> timeout(s_possessionRequestTimeout);
     for (auto character : m_unpossessedEntities) {
-        requestPossessionFromRegisteredClients(character->getId());
+        auto I = m_requestedPossessions.find(character->getId());
+        if (I == m_requestedPossessions.end() || now - I->second.time >= timeout) {
+            requestPossessionFromRegisteredClients(character->getId());
+        }
     }
 
     return 0;
@@ -92,6 +104,22 @@ int ExternalMindsManager::removeConnection(const std::string& routerId)
                 "Deregistered external mind connection registered for router %1. "
                         "There are now %2 connections.", routerId,
                 m_connections.size()) << std::endl;);
+        Monitors::instance()->insert(String::compose("external_minds{router=\"%1\"}", routerId), (Atlas::Message::IntType)0);
+
+        //Any possessions requested from the connection which haven't been fulfilled are requested from the remaining connections.
+        //Minds already possessed by it are requested again when they are unlinked.
+        std::vector<std::string> orphanedRequests;
+        for (auto I = m_requestedPossessions.begin(); I != m_requestedPossessions.end();) {
+            if (I->second.routerId == routerId) {
+                orphanedRequests.push_back(I->first);
+                I = m_requestedPossessions.erase(I);
+            } else {
+                ++I;
+            }
+        }
+        for (auto& entity_id : orphanedRequests) {
+            requestPossessionFromRegisteredClients(entity_id);
+        }
         return 0;
     }
 }
@@ -133,10 +161,7 @@ int ExternalMindsManager::requestPossessionFromRegisteredClients(
         auto result = PossessionAuthenticator::instance()->getPossessionKey(
                 entity_id);
         if (result.is_initialized()) {
-            //Use the last one registered.
-            //TODO: implement a better way to select the connection to use. Should we rotate the connections?
-            //Or do some kind of selection?
-            ExternalMindsConnection& connection = m_connections.rbegin()->second;
+            ExternalMindsConnection& connection = *findLeastLoadedConnection();
 
             Atlas::Objects::Operation::Possess possessOp;
 
@@ -153,6 +178,15 @@ int ExternalMindsManager::requestPossessionFromRegisteredClients(
                     connection.getRouterId()) << std::endl;);
 
             connection.getLink()->send(possessOp);
+
+            auto& request = m_requestedPossessions[entity_id];
+            std::string previousRouterId = request.routerId;
+            request.routerId = connection.getRouterId();
+            request.time = std::chrono::steady_clock::now();
+            if (!previousRouterId.empty() && previousRouterId != request.routerId) {
+                updateConnectionMonitor(previousRouterId);
+            }
+            updateConnectionMonitor(request.routerId);
             return 0;
         }
         return -1;
@@ -161,25 +195,108 @@ int ExternalMindsManager::requestPossessionFromRegisteredClients(
     return 1;
 }
 
+ExternalMindsConnection* ExternalMindsManager::findLeastLoadedConnection()
+{
+    std::map<std::string, size_t> loads;
+    for (auto& entry : m_possessedEntities) {
+        loads[entry.second]++;
+    }
+    for (auto& entry : m_requestedPossessions) {
+        loads[entry.second.routerId]++;
+    }
+
+    ExternalMindsConnection* leastLoaded = nullptr;
+    size_t leastLoad = 0;
+    for (auto& entry : m_connections) {
+        size_t load = loads[entry.first];
+        //On ties the connection with the highest router id wins, which is the one which always was used before minds were spread.
+        if (leastLoaded == nullptr || load <= leastLoad) {
+            leastLoaded = &entry.second;
+            leastLoad = load;
+        }
+    }
+    return leastLoaded;
+}
+
+size_t ExternalMindsManager::getConnectionLoad(const std::string& routerId) const
+{
+    size_t load = 0;
+    for (auto& entry : m_possessedEntities) {
+        if (entry.second == routerId) {
+            ++load;
+        }
+    }
+    for (auto& entry : m_requestedPossessions) {
+        if (entry.second.routerId == routerId) {
+            ++load;
+        }
+    }
+    return load;
+}
+
+std::string ExternalMindsManager::findPossessingRouter(Character* character) const
+{
+    ExternalMind* mind = character->m_externalMind;
+    if (mind == nullptr) {
+        return "";
+    }
+    //Prefer the connection we asked, as there might be more than one router on the same link.
+    auto I = m_requestedPossessions.find(character->getId());
+    if (I != m_requestedPossessions.end()) {
+        auto J = m_connections.find(I->second.routerId);
+        if (J != m_connections.end() && mind->isLinkedTo(J->second.getLink())) {
+            return I->second.routerId;
+        }
+    }
+    for (auto& entry : m_connections) {
+        if (mind->isLinkedTo(entry.second.getLink())) {
+            return entry.first;
+        }
+    }
+    return "";
+}
+
+void ExternalMindsManager::updateConnectionMonitor(const std::string& routerId) const
+{
+    if (m_connections.find(routerId) != m_connections.end()) {
+        Monitors::instance()->insert(String::compose("external_minds{router=\"%1\"}", routerId),
+                (Atlas::Message::IntType)getConnectionLoad(routerId));
+    }
+}
+
 void ExternalMindsManager::entity_destroyed(Character* entity)
 {
     m_unpossessedEntities.erase(entity);
-    m_possessedEntities.erase(entity);
+    auto I = m_possessedEntities.find(entity);
+    if (I != m_possessedEntities.end()) {
+        std::string routerId = I->second;
+        m_possessedEntities.erase(I);
+        updateConnectionMonitor(routerId);
+    }
+    auto J = m_requestedPossessions.find(entity->getId());
+    if (J != m_requestedPossessions.end()) {
+        std::string routerId = J->second.routerId;
+        m_requestedPossessions.erase(J);
+        updateConnectionMonitor(routerId);
+    }
 }
 
 void ExternalMindsManager::character_externalLinkChanged(Character* chr)
 {
     if (chr->m_externalMind == nullptr || !chr->m_externalMind->isLinked()) {
         //Make sure that the character is disconnected
-        if (m_possessedEntities.find(chr) == m_possessedEntities.end()) {
+        auto I = m_possessedEntities.find(chr);
+        if (I == m_possessedEntities.end()) {
             log(WARNING,
                     String::compose(
                             "Character %1 should be possessed, but isn't.",
                             chr->getId()));
             return;
         }
-        m_possessedEntities.erase(chr);
+        std::string routerId = I->second;
+        m_possessedEntities.erase(I);
         m_unpossessedEntities.insert(chr);
+        updateConnectionMonitor(routerId);
 
         //The possession entry was removed when the character was possessed last, so we need to add one back.
         addPossessionEntryForCharacter(*chr);
@@ -196,7 +313,10 @@ void ExternalMindsManager::character_externalLinkChanged(Character* chr)
             return;
         }
         m_unpossessedEntities.erase(chr);
-        m_possessedEntities.insert(chr);
+        std::string routerId = findPossessingRouter(chr);
+        m_requestedPossessions.erase(chr->getId());
+        m_possessedEntities.emplace(chr, routerId);
+        updateConnectionMonitor(routerId);
 
     }
 }
@@ -23,7 +23,9 @@
 
 #include <sigc++/trackable.h>
 
+#include <chrono>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
 
@@ -56,10 +58,44 @@ class ExternalMindsManager : public virtual sigc::trackable
          */
         int requestPossession(Character& character, const std::string& language, const std::string& script);
 
+        /**
+         * @brief Gets the number of minds possessed by, or requested from, a connection.
+         * @param routerId The router id of a connection.
+         * @return The number of minds.
+         */
+        size_t getConnectionLoad(const std::string& routerId) const;
+
+        /**
+         * @brief Time in seconds after which a possession request which hasn't been fulfilled is sent again.
+         *
+         * It's sent again when a new connection is added, since the request might have been lost or
+         * rejected by the connection it was sent to.
+         */
+        static double s_possessionRequestTimeout;
+
     private:
+        /**
+         * @brief A possession request which hasn't been fulfilled yet.
+         */
+        struct PossessionRequest
+        {
+            /**
+             * @brief The router id of the connection asked.
+             */
+            std::string routerId;
+            std::chrono::steady_clock::time_point time;
+        };
+
         std::map<std::string, ExternalMindsConnection> m_connections;
         std::unordered_set<Character*> m_unpossessedEntities;
-        std::unordered_set<Character*> m_possessedEntities;
+        /**
+         * @brief The possessed characters, and the router id of the connection possessing each.
+         */
+        std::unordered_map<Character*, std::string> m_possessedEntities;
+        /**
+         * @brief Characters for which possession has been requested, keyed by their ids.
+         */
+        std::map<std::string, PossessionRequest> m_requestedPossessions;
         static ExternalMindsManager * m_instance;
 
         void entity_destroyed(Character* character);
@@ -67,6 +103,19 @@ class ExternalMindsManager : public virtual sigc::trackable
 
         int requestPossessionFromRegisteredClients(const std::string& character_id);
 
+        /**
+         * @brief Finds the connection with the fewest minds, so that minds are spread across all connected AI clients.
+         * @return The least loaded connection, or null if there are no connections.
+         */
+        ExternalMindsConnection* findLeastLoadedConnection();
+
+        /**
+         * @brief Finds the router id of the connection a character has been possessed by.
+         */
+        std::string findPossessingRouter(Character* character) const;
+
+        void updateConnectionMonitor(const std::string& routerId) const;
+
         void addPossessionEntryForCharacter(Character& character);
 
 
@@ -21,6 +21,7 @@
 #include "common/const.h"
 #include "common/globals.h"
 #include "common/Monitors.h"
+#include "common/ScriptProfiler.h"
 
 #include <varconf/config.h>
 
@@ -93,6 +94,18 @@ void HttpCache::processQuery(std::ostream & io,
     } else if (path == "/monitors/numerics") {
         sendHeaders(io);
         Monitors::instance()->sendNumerics(io);
+    } else if (path == "/profile/scripts") {
+        sendHeaders(io);
+        ScriptProfiler::instance()->report(io);
+    } else if (path == "/profile/scripts/enable") {
+        ScriptProfiler::instance()->setEnabled(true);
+        sendHeaders(io);
+    } else if (path == "/profile/scripts/disable") {
+        ScriptProfiler::instance()->setEnabled(false);
+        sendHeaders(io);
+    } else if (path == "/profile/scripts/reset") {
+        ScriptProfiler::instance()->reset();
+        sendHeaders(io);
     } else {
         reportBadRequest(io, 404, "Not Found");
     }
@@ -131,9 +131,12 @@ int Ruleset::installRule(const std::string & class_name,
     std::string dependent, reason;
     // Possibly we should report some types of failure here.
     int ret = installRuleInner(class_name, class_desc, dependent, reason);
-    if (ret == 0 && database_flag) {
-        Persistence * p = Persistence::instance();
-        p->storeRule(class_desc, class_name, section);
+    if (ret == 0) {
+        Inheritance::instance().renumber();
+        if (database_flag) {
+            Persistence * p = Persistence::instance();
+            p->storeRule(class_desc, class_name, section);
+        }
     }
     return ret;
 }
@@ -211,6 +214,7 @@ int Ruleset::modifyRule(const std::string & class_name,
     }
     if (ret == 0) {
         Inheritance::instance().updateClass(class_name, class_desc);
+        Inheritance::instance().renumber();
         if (database_flag) {
             Persistence * p = Persistence::instance();
             p->updateRule(class_desc, class_name);
@@ -298,6 +302,8 @@ void Ruleset::loadRules(const std::string & ruleset)
         const Root & class_desc = I->second;
         installItem(class_name, class_desc);
     }
+    // Number the complete tree once, rather than once per installed rule.
+    Inheritance::instance().renumber();
     // Report on the non-cleared rules.
     // Perhaps we can keep them too?
     // m_waitingRules.clear();
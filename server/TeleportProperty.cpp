@@ -25,6 +25,7 @@
 
 #include "common/BaseWorld.h"
 #include "common/debug.h"
+#include "common/TypeNode.h"
 #include "common/Teleport.h"
 
 #include <iostream>
@@ -36,6 +37,11 @@ void TeleportProperty::install(LocatedEntity * owner, const std::string & name)
     owner->installDelegate(Atlas::Objects::Operation::TELEPORT_NO, name);
 }
 
+void TeleportProperty::install(TypeNode * type, const std::string & name)
+{
+    type->addDelegate(Atlas::Objects::Operation::TELEPORT_NO, name, this);
+}
+
 HandlerResult TeleportProperty::operation(LocatedEntity * ent,
                                           const Operation & op,
                                           OpVector & res)
@@ -25,6 +25,7 @@ class TeleportProperty : public Property<std::string>
 {
   public:
     virtual void install(LocatedEntity *, const std::string &);
+    virtual void install(TypeNode *, const std::string &);
     virtual HandlerResult operation(LocatedEntity *,
                                     const Operation &,
                                     OpVector &);
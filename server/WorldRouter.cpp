@@ -24,6 +24,7 @@
 
 #include "rulesets/World.h"
 #include "rulesets/Domain.h"
+#include "rulesets/PythonWrapper.h"
 
 #include "common/id.h"
 #include "common/debug.h"
@@ -79,16 +80,22 @@ inline EntityScopedRef::~EntityScopedRef()
 WorldRouter::WorldRouter(const SystemTime & time) :
       BaseWorld(*new World(consts::rootWorldId, consts::rootWorldIntId)),
       m_operationsDispatcher([&](const Operation & op, LocatedEntity & from){this->operation(op, from);}, [&]()->double {return getTime();}),
+      m_systemScheduler([&](const Operation & op, LocatedEntity & from){this->message(op, from);}, [&]()->double {return getTime();}),
       m_entityCount(1)
           
 {
     m_initTime = time.seconds();
     m_gameWorld.incRef();
+    m_systems = &m_systemScheduler;
 
     m_gameWorld.setType(Inheritance::instance().getType("world"));
     m_eobjects[m_gameWorld.getIntId()] = &m_gameWorld;
     //WorldTime tmp_date("612-1-1 08:57:00");
     Monitors::instance()->watch("entities", new Variable<int>(m_entityCount));
+    Monitors::instance()->watchPool("entity", Entity::pools().stats());
+    Monitors::instance()->watchPool("property", PropertyBase::pools().stats());
+    Monitors::instance()->watchPool("python_wrapper", PythonWrapper::pools().stats());
+    Monitors::instance()->watch("property_default_copies", new Variable<int>(Entity::propertyDefaultCopies()));
 }
 
 /// \brief Destructor for the world object.
@@ -106,6 +113,8 @@ WorldRouter::~WorldRouter()
     //in them.
     m_operationsDispatcher.clearQueues();
     m_suspendedQueue = OpQueue();
+    m_systemScheduler.clear();
+    m_systems = nullptr;
 
     EntityDict::const_iterator Jend = m_eobjects.end();
     for (EntityDict::const_iterator J = m_eobjects.begin(); J != Jend; ++J) {
@@ -533,14 +542,26 @@ void WorldRouter::addPerceptive(LocatedEntity * perceptive)
 /// will call this function again as soon as possible rather than sleeping.
 /// This ensures that the maximum possible number of operations are dispatched
 /// without becoming unresponsive to client communications traffic.
+/// Batched system updates which are due are run first, unless the world is
+/// suspended.
 bool WorldRouter::idle()
 {
+    if (!m_isSuspended) {
+        m_systemScheduler.run();
+    }
     return m_operationsDispatcher.idle();
 }
 
 
 double WorldRouter::secondsUntilNextOp() const {
-    return m_operationsDispatcher.secondsUntilNextOp();
+    double seconds = m_operationsDispatcher.secondsUntilNextOp();
+    if (!m_isSuspended) {
+        double systemSeconds = m_systemScheduler.secondsUntilNextRun();
+        if (systemSeconds >= 0 && systemSeconds < seconds) {
+            seconds = systemSeconds;
+        }
+    }
+    return seconds;
 }
 
 /// Find an entity of the given name. This is provided to allow administrators
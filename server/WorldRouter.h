@@ -21,6 +21,7 @@
 
 #include "common/BaseWorld.h"
 #include "common/OperationsDispatcher.h"
+#include "common/SystemScheduler.h"
 
 #include <list>
 #include <set>
@@ -42,6 +43,8 @@ class WorldRouter : public BaseWorld {
 
     ///Handles dispatching of operations.
     OperationsDispatcher m_operationsDispatcher;
+    ///Runs batched periodic updates of entities.
+    SystemScheduler m_systemScheduler;
     /// An ordered queue of suspended operations to be dispatched when resumed.
     OpQueue m_suspendedQueue;
     /// Count of in world entities
@@ -49,6 +49,7 @@
 #include "common/sockets.h"
 #include "common/SystemTime.h"
 #include "common/Monitors.h"
+#include "common/Variable.h"
 
 #include <varconf/config.h>
 
@@ -125,6 +126,16 @@ void daemonSignalsHandler(boost::asio::signal_set& this_, boost::system::error_c
     }
 }
 
+template<typename ProtocolT>
+static void watchClientStatistics(const std::string& protocol)
+{
+    auto& statistics = CommAsioClient<ProtocolT>::s_statistics;
+    Monitors::instance()->watch(compose("client_ops_received{protocol=\"%1\"}", protocol), new Variable<int>(statistics.opsReceived));
+    Monitors::instance()->watch(compose("client_reads_per_kop{protocol=\"%1\"}", protocol), new Variable<int>(statistics.readsPerKiloOp));
+    Monitors::instance()->watch(compose("client_writes_per_kop{protocol=\"%1\"}", protocol), new Variable<int>(statistics.writesPerKiloOp));
+    Monitors::instance()->watch(compose("client_decode_us_per_kop{protocol=\"%1\"}", protocol), new Variable<int>(statistics.decodeMicrosecondsPerKiloOp));
+}
+
 int main(int argc, char ** argv)
 {
     if (security_init() != 0) {
@@ -362,6 +373,9 @@ int main(int argc, char ** argv)
     auto localListener = new CommAsioListener<local::stream_protocol, CommAsioClient<local::stream_protocol>>(localStarter, server->getName(), *io_service,
                                                                                                               local::stream_protocol::endpoint(client_socket_name));
 
+    watchClientStatistics<ip::tcp>("tcp");
+    watchClientStatistics<local::stream_protocol>("local");
+
 
     //Instantiate at startup
     HttpCache::instance();
@@ -511,6 +511,7 @@ void logEvent(LogEvent lev, const std::string & msg)
 #include "stubs/server/stubExternalMindsManager.h"
 #include "stubs/server/stubExternalMindsConnection.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/modules/stubLocation.h"
 
 PropertyManager * PropertyManager::m_instance = 0;
@@ -458,6 +458,7 @@ int PythonScriptFactory<LocatedEntity>::setup()
 #include "stubs/server/stubExternalMindsConnection.h"
 #include "stubs/server/stubPlayer.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/modules/stubWorldTime.h"
 #include "stubs/common/stubCustom.h"
 #include "stubs/common/stubVariable.h"
@@ -719,6 +720,11 @@ EntityProperty * EntityProperty::copy() const
     return 0;
 }
 
+PropertyTypeId EntityProperty::typeId() const
+{
+    return propertyTypeId<EntityProperty>();
+}
+
 TasksProperty::TasksProperty() : PropertyBase(per_ephem), m_task(0)
 {
 }
@@ -737,6 +743,11 @@ TasksProperty * TasksProperty::copy() const
     return 0;
 }
 
+PropertyTypeId TasksProperty::typeId() const
+{
+    return propertyTypeId<TasksProperty>();
+}
+
 int TasksProperty::startTask(Task *, LocatedEntity *, const Operation &, OpVector &)
 {
     return 0;
@@ -802,6 +813,11 @@ StatusProperty * StatusProperty::copy() const
     return 0;
 }
 
+PropertyTypeId StatusProperty::typeId() const
+{
+    return propertyTypeId<StatusProperty>();
+}
+
 void StatusProperty::apply(LocatedEntity * owner)
 {
 }
@@ -1126,6 +1142,16 @@ void TypeNode::updateProperties(const Atlas::Message::MapType & attributes)
 {
 }
 
+void TypeNode::addDelegate(int class_no, const std::string & name,
+                           PropertyBase * property)
+{
+}
+
+bool TypeNode::hasDelegate(int class_no, const PropertyKey & key) const
+{
+    return false;
+}
+
 const char * const CYPHESIS = "cyphesis";
 
 static const char * DEFAULT_INSTANCE = "cyphesis";
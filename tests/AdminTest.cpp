@@ -1416,7 +1416,7 @@ LocatedEntity * Account::createCharacterEntity(const std::string &,
 }
 
 
-int Account::connectCharacter(LocatedEntity *chr)
+int Account::connectCharacter(LocatedEntity *chr, bool possessed)
 {
     return 0;
 }
@@ -226,6 +226,16 @@ bool TypeNode::isTypeOf(const TypeNode * base_type) const
     return false;
 }
 
+void TypeNode::addDelegate(int class_no, const std::string & name,
+                           PropertyBase * property)
+{
+}
+
+bool TypeNode::hasDelegate(int class_no, const PropertyKey & key) const
+{
+    return false;
+}
+
 void log(LogLevel lvl, const std::string & msg)
 {
 }
@@ -196,10 +196,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 void Location::addToMessage(Atlas::Message::MapType & omap) const
 {
 }
@@ -231,6 +241,16 @@ void TypeNode::injectProperty(const std::string& name,
     m_defaults[name] = p;
 }
 
+void TypeNode::addDelegate(int class_no, const std::string & name,
+                           PropertyBase * property)
+{
+}
+
+bool TypeNode::hasDelegate(int class_no, const PropertyKey & key) const
+{
+    return false;
+}
+
 IdProperty::IdProperty(const std::string & data) : PropertyBase(per_ephem),
                                                    m_data(data)
 {
@@ -23,17 +23,53 @@
 #define DEBUG
 #endif
 
+#include "aiclient/ClientConnection.h"
 #include "common/AtlasStreamClient.h"
 #include "common/ClientTask.h"
 
+#include <Atlas/Codecs/XML.h>
 #include <Atlas/Objects/Anonymous.h>
+#include <Atlas/Objects/Encoder.h>
 #include <Atlas/Objects/Operation.h>
 #include <Atlas/Objects/SmartPtr.h>
 
 #include <cassert>
 
+/// \brief Socket which counts the writes instead of sending anything
+class CountingStreamClientSocket : public StreamClientSocketBase {
+  protected:
+    size_t read_blocking() override { return 0; }
+    void do_read() override { }
+  public:
+    int m_writes;
+
+    CountingStreamClientSocket(boost::asio::io_service & io_service,
+                               std::function<void()> & dispatcher,
+                               Atlas::Bridge & decoder) :
+        StreamClientSocketBase(io_service, dispatcher), m_writes(0)
+    {
+        m_codec = new Atlas::Codecs::XML(m_ios, m_ios, decoder);
+        m_encoder = new Atlas::Objects::ObjectsEncoder(*m_codec);
+    }
+
+    size_t write() override
+    {
+        ++m_writes;
+        size_t size = mBuffer.size();
+        mBuffer.consume(size);
+        return size;
+    }
+};
+
 class TestAtlasStreamClient : public AtlasStreamClient {
   public:
+    CountingStreamClientSocket * test_setCountingSocket() {
+        std::function<void()> dispatcher = [](){};
+        auto socket = new CountingStreamClientSocket(m_io_service, dispatcher, *this);
+        m_socket = socket;
+        return socket;
+    }
+
     void test_objectArrived(const Atlas::Objects::Root & op) {
         objectArrived(op);
     }
@@ -62,6 +98,16 @@ class TestClientTask : public ClientTask {
     void make_complete() { m_complete = true; }
 };
 
+class TestClientConnection : public ClientConnection {
+  public:
+    CountingStreamClientSocket * test_setCountingSocket() {
+        std::function<void()> dispatcher = [](){};
+        auto socket = new CountingStreamClientSocket(m_io_service, dispatcher, *this);
+        m_socket = socket;
+        return socket;
+    }
+};
+
 int main()
 {
     {
@@ -171,6 +217,10 @@ int main()
 
     // Verify these bail out cleanly when unconnected
     asc->poll();
+    asc->beginBatch();
+    asc->send(op);
+    asc->flush();
+    assert(AtlasStreamClient::s_sendStatistics.writes == 0);
     asc->login("foo", "bar");
     asc->create("player", "foo", "bar");
 
@@ -179,6 +229,61 @@ int main()
     ret = asc->connectLocal("/sys/thereisnofilehere");
     assert(ret != 0);
 
+    delete asc;
+
+    // Batched operations are written together
+    AtlasStreamClient::s_batchInterval = 60000;
+    {
+        asc = new TestAtlasStreamClient;
+        CountingStreamClientSocket * socket = asc->test_setCountingSocket();
+
+        asc->send(op);
+        asc->send(op);
+        assert(socket->m_writes == 2);
+
+        int writes = AtlasStreamClient::s_sendStatistics.writes;
+        asc->beginBatch();
+        for (int i = 0; i < 10; ++i) {
+            asc->send(op);
+        }
+        assert(socket->m_writes == 2);
+        asc->flush();
+        assert(socket->m_writes == 3);
+        assert(AtlasStreamClient::s_sendStatistics.writes == writes + 1);
+
+        // Nothing is written if nothing was held back
+        asc->flush();
+        assert(socket->m_writes == 3);
+
+        // A full batch is written before it's flushed
+        AtlasStreamClient::s_batchSize = 4;
+        asc->beginBatch();
+        for (int i = 0; i < 10; ++i) {
+            asc->send(op);
+        }
+        assert(socket->m_writes == 5);
+        asc->flush();
+        assert(socket->m_writes == 6);
+        AtlasStreamClient::s_batchSize = 64;
+
+        delete asc;
+    }
+
+    // Held back operations are written before waiting for a reply
+    {
+        TestClientConnection * cc = new TestClientConnection;
+        CountingStreamClientSocket * socket = cc->test_setCountingSocket();
+
+        cc->beginBatch();
+        cc->send(op);
+        cc->send(op);
+        assert(socket->m_writes == 0);
+        // The socket isn't connected, so there's never a reply.
+        assert(cc->wait() == -1);
+        assert(socket->m_writes == 1);
+
+        delete cc;
+    }
 }
 
 // stubs
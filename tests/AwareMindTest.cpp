@@ -0,0 +1,224 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/mind/AwareMind.h"
+#include "rulesets/mind/AwarenessStoreProvider.h"
+#include "rulesets/mind/SharedTerrain.h"
+#include "rulesets/MemEntity.h"
+
+#include <Atlas/Objects/Anonymous.h>
+#include <Atlas/Objects/Operation.h>
+
+#include <cassert>
+
+class TestAwareMind : public AwareMind
+{
+    public:
+        using AwareMind::AwareMind;
+        using AwareMind::updateLodLevel;
+        using AwareMind::mLodLevel;
+};
+
+class AwareMindTest : public Cyphesis::TestBase
+{
+    protected:
+        SharedTerrain * m_terrain;
+        AwarenessStoreProvider * m_storeProvider;
+        MemEntity * m_domain;
+        MemEntity * m_player;
+        TestAwareMind * m_mind;
+
+        /// \brief Place the player at a distance from the mind
+        void placePlayer(float distance);
+
+        /// \brief Send the mind a move tick, and get the time until the next one
+        double moveTick();
+
+    public:
+        AwareMindTest();
+
+        void setup();
+
+        void teardown();
+
+        void test_disabled();
+
+        void test_levels();
+
+        void test_nonPlayers();
+
+        void test_moveTickInterval();
+};
+
+AwareMindTest::AwareMindTest()
+{
+    ADD_TEST(AwareMindTest::test_disabled);
+    ADD_TEST(AwareMindTest::test_levels);
+    ADD_TEST(AwareMindTest::test_nonPlayers);
+    ADD_TEST(AwareMindTest::test_moveTickInterval);
+}
+
+void AwareMindTest::setup()
+{
+    AwareMind::s_lodDistance = 10;
+    m_terrain = new SharedTerrain();
+    m_storeProvider = new AwarenessStoreProvider(*m_terrain);
+    m_domain = new MemEntity("1", 1);
+
+    m_mind = new TestAwareMind("2", 2, *m_terrain, *m_storeProvider);
+    m_mind->m_location.m_loc = m_domain;
+    m_mind->m_location.m_pos = WFMath::Point<3>(0, 0, 0);
+
+    m_player = new MemEntity("3", 3);
+    m_player->setAttr("player", 1);
+    m_player->m_location.m_loc = m_domain;
+    m_mind->entityAdded(*m_player);
+}
+
+void AwareMindTest::teardown()
+{
+    delete m_mind;
+    delete m_player;
+    delete m_domain;
+    delete m_storeProvider;
+    delete m_terrain;
+    AwareMind::s_lodDistance = 0;
+}
+
+void AwareMindTest::placePlayer(float distance)
+{
+    m_player->m_location.m_pos = WFMath::Point<3>(distance, 0, 0);
+}
+
+double AwareMindTest::moveTick()
+{
+    Atlas::Objects::Operation::Tick tick;
+    Atlas::Objects::Entity::Anonymous arg;
+    arg->setName("move");
+    tick->setArgs1(arg);
+
+    OpVector res;
+    m_mind->operation(tick, res);
+    assert(!res.empty());
+    assert(res.back()->getClassNo() == Atlas::Objects::Operation::TICK_NO);
+    return res.back()->getFutureSeconds();
+}
+
+void AwareMindTest::test_disabled()
+{
+    AwareMind::s_lodDistance = 0;
+    placePlayer(1000);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 0);
+    ASSERT_EQUAL(m_mind->getTickIntervalScale(), 1.);
+}
+
+void AwareMindTest::test_levels()
+{
+    int fullRate = AwareMind::s_lodMinds[0];
+
+    // Full rate up to the distance, half up to four times it, and a sixth beyond.
+    placePlayer(10);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 0);
+    ASSERT_EQUAL(m_mind->getTickIntervalScale(), 1.);
+
+    placePlayer(11);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 1);
+    ASSERT_EQUAL(m_mind->getTickIntervalScale(), 2.);
+    ASSERT_EQUAL(AwareMind::s_lodMinds[0], fullRate - 1);
+    ASSERT_EQUAL(AwareMind::s_lodMinds[1], 1);
+
+    placePlayer(40);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 1);
+
+    placePlayer(41);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 2);
+    ASSERT_EQUAL(m_mind->getTickIntervalScale(), 6.);
+    ASSERT_EQUAL(AwareMind::s_lodMinds[1], 0);
+    ASSERT_EQUAL(AwareMind::s_lodMinds[2], 1);
+
+    // A player elsewhere is as good as far away.
+    placePlayer(1);
+    MemEntity elsewhere("4", 4);
+    m_player->m_location.m_loc = &elsewhere;
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 2);
+
+    m_player->m_location.m_loc = m_domain;
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 0);
+    ASSERT_EQUAL(AwareMind::s_lodMinds[0], fullRate);
+}
+
+void AwareMindTest::test_nonPlayers()
+{
+    MemEntity npc("5", 5);
+    npc.setAttr("player", 0);
+    npc.m_location.m_loc = m_domain;
+    npc.m_location.m_pos = WFMath::Point<3>(1, 0, 0);
+    m_mind->entityAdded(npc);
+
+    // Only players keep minds at full rate.
+    placePlayer(100);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 2);
+
+    // Nor does a player which has been forgotten.
+    placePlayer(1);
+    m_mind->entityDeleted(*m_player);
+    m_mind->updateLodLevel();
+    ASSERT_EQUAL(m_mind->mLodLevel, 2);
+}
+
+void AwareMindTest::test_moveTickInterval()
+{
+    placePlayer(1);
+    ASSERT_FUZZY_EQUAL(moveTick(), 0.2, 0.0001);
+
+    // The level is only looked at again after a while, so a tick right
+    // after the player leaves is still at full rate.
+    placePlayer(20);
+    ASSERT_FUZZY_EQUAL(moveTick(), 0.2, 0.0001);
+
+    m_mind->updateLodLevel();
+    ASSERT_FUZZY_EQUAL(moveTick(), 0.4, 0.0001);
+
+    placePlayer(100);
+    m_mind->updateLodLevel();
+    ASSERT_FUZZY_EQUAL(moveTick(), 1.2, 0.0001);
+}
+
+int main()
+{
+    AwareMindTest t;
+
+    return t.run();
+}
@@ -0,0 +1,268 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "navigation/Awareness.h"
+#include "navigation/IHeightProvider.h"
+#include "rulesets/MemEntity.h"
+
+#include <wfmath/rotbox.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+class FlatHeightProvider : public IHeightProvider
+{
+    public:
+        void blitHeights(int xMin, int xMax, int yMin, int yMax, std::vector<float>& heights) const override
+        {
+            std::fill(heights.begin(), heights.end(), 0.f);
+        }
+};
+
+/// \brief Exposes the parts of the awareness which are measured
+class BenchmarkAwareness : public Awareness
+{
+    public:
+        using Awareness::Awareness;
+        using Awareness::findEntityAreas;
+        using Awareness::rebuildTile;
+        using Awareness::mEntityAreas;
+};
+
+/// \brief Measures how the obstacle areas of a tile are found when it's rebuilt
+///
+/// The world is filled with solid entities, and then the areas of every tile
+/// are looked up both by scanning all areas, which is what was done before
+/// they were indexed by tile, and through the index.
+class AwarenessBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const int s_entityCount = 10000;
+        static const int s_rebuildCount = 100;
+        static constexpr float s_worldSize = 512.f;
+
+        FlatHeightProvider m_heightProvider;
+        MemEntity * m_domain;
+        MemEntity * m_observer;
+        std::vector<MemEntity *> m_entities;
+        BenchmarkAwareness * m_awareness;
+        int m_tilesPerSide;
+
+        size_t scan(const WFMath::AxisBox<2> & extent);
+
+        WFMath::AxisBox<2> tileArea(int tx, int ty) const;
+
+    public:
+        AwarenessBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_scan();
+
+        void test_index();
+
+        void test_rebuild();
+
+        void test_pathRequests();
+};
+
+AwarenessBenchmark::AwarenessBenchmark()
+{
+    ADD_TEST(AwarenessBenchmark::test_scan);
+    ADD_TEST(AwarenessBenchmark::test_index);
+    ADD_TEST(AwarenessBenchmark::test_rebuild);
+    ADD_TEST(AwarenessBenchmark::test_pathRequests);
+}
+
+void AwarenessBenchmark::setup()
+{
+    m_domain = new MemEntity("1", 1);
+    m_observer = new MemEntity("2", 2);
+
+    WFMath::AxisBox<3> extent(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(s_worldSize, 50, s_worldSize));
+    m_awareness = new BenchmarkAwareness(*m_domain, 0.4f, 2.f, m_heightProvider, extent);
+    m_tilesPerSide = (int)std::ceil(s_worldSize / m_awareness->getTileSizeInMeters());
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> coord(0, s_worldSize);
+    std::uniform_real_distribution<float> angle(0, WFMath::numeric_constants<float>::pi() * 2);
+    for (long i = 0; i < s_entityCount; ++i) {
+        MemEntity * entity = new MemEntity(std::to_string(i + 3), i + 3);
+        entity->m_location.m_pos = WFMath::Point<3>(coord(random), 0, coord(random));
+        entity->m_location.m_orientation.rotation(1, angle(random));
+        entity->m_location.setBBox(BBox(WFMath::Point<3>(-1, 0, -1), WFMath::Point<3>(1, 2, 1)));
+        m_awareness->addEntity(*m_observer, *entity, false);
+        m_entities.push_back(entity);
+    }
+}
+
+void AwarenessBenchmark::teardown()
+{
+    delete m_awareness;
+    for (MemEntity * entity : m_entities) {
+        delete entity;
+    }
+    m_entities.clear();
+    delete m_observer;
+    delete m_domain;
+}
+
+WFMath::AxisBox<2> AwarenessBenchmark::tileArea(int tx, int ty) const
+{
+    float tileSize = m_awareness->getTileSizeInMeters();
+    return WFMath::AxisBox<2>(WFMath::Point<2>(tx * tileSize, ty * tileSize),
+                              WFMath::Point<2>((tx + 1) * tileSize, (ty + 1) * tileSize));
+}
+
+/// \brief Find the areas the way it was done before they were indexed
+size_t AwarenessBenchmark::scan(const WFMath::AxisBox<2> & extent)
+{
+    size_t found = 0;
+    for (auto & entry : m_awareness->mEntityAreas) {
+        auto & rotbox = entry.second;
+        if (WFMath::Contains(extent, rotbox, false) || WFMath::Intersect(extent, rotbox, false)) {
+            ++found;
+        }
+    }
+    return found;
+}
+
+void AwarenessBenchmark::test_scan()
+{
+    ASSERT_EQUAL(m_awareness->mEntityAreas.size(), (size_t)s_entityCount);
+
+    size_t found = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tx = 0; tx < m_tilesPerSide; ++tx) {
+        for (int ty = 0; ty < m_tilesPerSide; ++ty) {
+            found += scan(tileArea(tx, ty));
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    int tiles = m_tilesPerSide * m_tilesPerSide;
+    std::cout << "Scanning all areas: " << microseconds / (double)tiles
+              << " us per tile, " << found / tiles << " areas found per tile" << std::endl;
+}
+
+void AwarenessBenchmark::test_index()
+{
+    size_t expected = 0;
+    size_t found = 0;
+    std::vector<WFMath::RotBox<2>> areas;
+    long microseconds = 0;
+    for (int tx = 0; tx < m_tilesPerSide; ++tx) {
+        for (int ty = 0; ty < m_tilesPerSide; ++ty) {
+            auto extent = tileArea(tx, ty);
+            expected += scan(extent);
+
+            areas.clear();
+            auto start = std::chrono::high_resolution_clock::now();
+            m_awareness->findEntityAreas(extent, areas);
+            microseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+            found += areas.size();
+        }
+    }
+    ASSERT_EQUAL(found, expected);
+    int tiles = m_tilesPerSide * m_tilesPerSide;
+    std::cout << "Tile index: " << microseconds / (double)tiles
+              << " us per tile, " << found / tiles << " areas found per tile" << std::endl;
+}
+
+void AwarenessBenchmark::test_rebuild()
+{
+    std::mt19937 random(2);
+    std::uniform_int_distribution<int> tile(0, m_tilesPerSide - 1);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < s_rebuildCount; ++i) {
+        m_awareness->rebuildTile(tile(random), tile(random));
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "Rebuilding tiles with " << s_entityCount << " obstacles: "
+              << microseconds / (1000. * s_rebuildCount) << " ms per tile" << std::endl;
+
+    // Moving obstacles must keep the index in sync.
+    for (int i = 0; i < 100; ++i) {
+        MemEntity * entity = m_entities[i];
+        entity->m_location.m_pos = WFMath::Point<3>(entity->m_location.pos().x() + 20, 0, entity->m_location.pos().z());
+        m_awareness->updateEntityMovement(*m_observer, *entity);
+    }
+    for (int i = 100; i < 200; ++i) {
+        MemEntity * entity = m_entities[i];
+        entity->m_location.setSolid(false);
+        entity->m_location.m_pos = WFMath::Point<3>(entity->m_location.pos().x(), 0, entity->m_location.pos().z() + 1);
+        m_awareness->updateEntityMovement(*m_observer, *entity);
+    }
+    ASSERT_EQUAL(m_awareness->mEntityAreas.size(), (size_t)s_entityCount - 100);
+
+    size_t expected = 0;
+    size_t found = 0;
+    std::vector<WFMath::RotBox<2>> areas;
+    for (int tx = 0; tx < m_tilesPerSide; ++tx) {
+        for (int ty = 0; ty < m_tilesPerSide; ++ty) {
+            auto extent = tileArea(tx, ty);
+            expected += scan(extent);
+            areas.clear();
+            m_awareness->findEntityAreas(extent, areas);
+            found += areas.size();
+        }
+    }
+    ASSERT_EQUAL(found, expected);
+}
+
+void AwarenessBenchmark::test_pathRequests()
+{
+    m_awareness->rebuildTile(0, 0);
+    int completed = 0;
+    for (int i = 0; i < 10; ++i) {
+        m_awareness->requestPath(WFMath::Point<3>(2, 0, 2), WFMath::Point<3>(10, 0, 10), 10,
+                                 [&](int result, std::list<WFMath::Point<3>>& path) { ++completed; });
+    }
+
+    // All minds sharing the awareness call this on their ticks, but only one
+    // of them searches within each interval.
+    ASSERT_TRUE(m_awareness->processPathRequests(1, 10., 0.2));
+    ASSERT_FALSE(m_awareness->processPathRequests(1000000, 10.1, 0.2));
+    ASSERT_TRUE(completed < 10);
+    ASSERT_TRUE(m_awareness->processPathRequests(1000000, 10.5, 0.2));
+    ASSERT_EQUAL(completed, 10);
+
+    // Nothing is done without requests.
+    ASSERT_FALSE(m_awareness->processPathRequests(1000000, 20., 0.2));
+}
+
+int main()
+{
+    AwarenessBenchmark t;
+
+    return t.run();
+}
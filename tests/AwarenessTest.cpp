@@ -0,0 +1,189 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "navigation/Awareness.h"
+#include "navigation/IHeightProvider.h"
+#include "rulesets/MemEntity.h"
+
+#include <algorithm>
+
+class FlatHeightProvider : public IHeightProvider
+{
+    public:
+        void blitHeights(int xMin, int xMax, int yMin, int yMax, std::vector<float>& heights) const override
+        {
+            std::fill(heights.begin(), heights.end(), 0.f);
+        }
+};
+
+class TestAwareness : public Awareness
+{
+    public:
+        using Awareness::Awareness;
+        using Awareness::rebuildTile;
+};
+
+class AwarenessTest : public Cyphesis::TestBase
+{
+    protected:
+        FlatHeightProvider m_heightProvider;
+        MemEntity * m_domain;
+        TestAwareness * m_awareness;
+        std::vector<int> m_results;
+
+        long request();
+
+    public:
+        AwarenessTest();
+
+        void setup();
+
+        void teardown();
+
+        void test_budget();
+
+        void test_interval();
+
+        void test_cancel();
+
+        void test_cache();
+};
+
+AwarenessTest::AwarenessTest()
+{
+    ADD_TEST(AwarenessTest::test_budget);
+    ADD_TEST(AwarenessTest::test_interval);
+    ADD_TEST(AwarenessTest::test_cancel);
+    ADD_TEST(AwarenessTest::test_cache);
+}
+
+void AwarenessTest::setup()
+{
+    m_domain = new MemEntity("1", 1);
+    WFMath::AxisBox<3> extent(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(64, 50, 64));
+    m_awareness = new TestAwareness(*m_domain, 0.4f, 2.f, m_heightProvider, extent);
+    m_awareness->rebuildTile(0, 0);
+    m_results.clear();
+}
+
+void AwarenessTest::teardown()
+{
+    delete m_awareness;
+    delete m_domain;
+}
+
+long AwarenessTest::request()
+{
+    return m_awareness->requestPath(WFMath::Point<3>(2, 0, 2), WFMath::Point<3>(10, 0, 10), 1,
+                                    [&](int result, std::list<WFMath::Point<3>>& path) {
+                                        ASSERT_EQUAL(result, (int)path.size());
+                                        m_results.push_back(result);
+                                    });
+}
+
+void AwarenessTest::test_budget()
+{
+    for (int i = 0; i < 3; ++i) {
+        request();
+    }
+    ASSERT_EQUAL(m_awareness->pendingPathRequests(), 3u);
+
+    //Starting a search uses up one iteration, so no more than one can be done.
+    ASSERT_TRUE(m_awareness->processPathRequests(1, 1., 0.2));
+    ASSERT_TRUE(m_results.size() < 3);
+    ASSERT_TRUE(m_awareness->pendingPathRequests() > 0);
+
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 2., 0.2));
+    ASSERT_EQUAL(m_results.size(), 3u);
+    ASSERT_EQUAL(m_awareness->pendingPathRequests(), 0u);
+    for (int result : m_results) {
+        ASSERT_TRUE(result > 0);
+    }
+}
+
+void AwarenessTest::test_interval()
+{
+    request();
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 1., 0.2));
+    ASSERT_EQUAL(m_results.size(), 1u);
+
+    //The next tick of another agent within the interval doesn't search.
+    request();
+    ASSERT_FALSE(m_awareness->processPathRequests(1000, 1.1, 0.2));
+    ASSERT_EQUAL(m_results.size(), 1u);
+
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 1.2, 0.2));
+    ASSERT_EQUAL(m_results.size(), 2u);
+
+    //Nothing is done without requests.
+    ASSERT_FALSE(m_awareness->processPathRequests(1000, 5., 0.2));
+
+    //A clock which has gone backwards doesn't stop the searches.
+    request();
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 0.5, 0.2));
+    ASSERT_EQUAL(m_results.size(), 3u);
+}
+
+void AwarenessTest::test_cancel()
+{
+    long first = request();
+    request();
+    m_awareness->cancelPathRequest(first);
+    ASSERT_EQUAL(m_awareness->pendingPathRequests(), 1u);
+
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 1., 0.2));
+    ASSERT_EQUAL(m_results.size(), 1u);
+    ASSERT_EQUAL(m_awareness->pendingPathRequests(), 0u);
+}
+
+void AwarenessTest::test_cache()
+{
+    int cacheHits = Awareness::s_pathStatistics.cacheHits;
+    request();
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 1., 0.2));
+    ASSERT_EQUAL(Awareness::s_pathStatistics.cacheHits, cacheHits);
+
+    //The same search again reuses the corridor found.
+    request();
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 2., 0.2));
+    ASSERT_EQUAL(Awareness::s_pathStatistics.cacheHits, cacheHits + 1);
+    ASSERT_EQUAL(m_results.size(), 2u);
+    ASSERT_EQUAL(m_results[0], m_results[1]);
+
+    //Rebuilding the tile changes the navmesh, so the corridor can't be used.
+    m_awareness->rebuildTile(0, 0);
+    request();
+    ASSERT_TRUE(m_awareness->processPathRequests(1000, 3., 0.2));
+    ASSERT_EQUAL(Awareness::s_pathStatistics.cacheHits, cacheHits + 1);
+}
+
+int main()
+{
+    AwarenessTest t;
+
+    return t.run();
+}
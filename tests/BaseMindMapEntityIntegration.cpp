@@ -79,8 +79,6 @@ void BaseMindMapEntityintegration::teardown()
 
 void BaseMindMapEntityintegration::test_MemMapdel_top()
 {
-    //HACK: Disabled for now as we've disabled the deletion of entities from the mind. See MemMap::del(...)
-    return;
     MemEntity * tlve = new MemEntity("0", 0);
     tlve->m_contains = new LocatedEntitySet;
     m_mind->m_map.m_entities[0] = tlve;
@@ -109,8 +107,6 @@ void BaseMindMapEntityintegration::test_MemMapdel_top()
 
 void BaseMindMapEntityintegration::test_MemMapdel_mid()
 {
-    //HACK: Disabled for now as we've disabled the deletion of entities from the mind. See MemMap::del(...)
-    return;
     MemEntity * tlve = new MemEntity("0", 0);
     tlve->m_contains = new LocatedEntitySet;
     m_mind->m_map.m_entities[0] = tlve;
@@ -145,8 +141,6 @@ void BaseMindMapEntityintegration::test_MemMapdel_mid()
 
 void BaseMindMapEntityintegration::test_MemMapdel_edge()
 {
-    //HACK: Disabled for now as we've disabled the deletion of entities from the mind. See MemMap::del(...)
-    return;
     MemEntity * tlve = new MemEntity("0", 0);
     tlve->m_contains = new LocatedEntitySet;
     m_mind->m_map.m_entities[0] = tlve;
@@ -312,17 +306,14 @@ void BaseMindMapEntityintegration::test_MemMapcheck()
     // We have set up e3 so it is due to be purged from memory.
     m_mind->m_map.check(time);
 
-    //TODO: Enable this check again, as we've disabled removal of entities from MemMap since there are issues
     // Check it has been removed
-    //ASSERT_TRUE(e2->m_contains->find(e3) == e2->m_contains->end());
-    //ASSERT_TRUE(tlve->m_contains->find(e3) == tlve->m_contains->end());
+    ASSERT_EQUAL(m_mind->m_map.m_entities.size(), 3u);
+    ASSERT_TRUE(e2->m_contains->find(e3) == e2->m_contains->end());
+    ASSERT_TRUE(tlve->m_contains->find(e3) == tlve->m_contains->end());
 
-    //TODO: Enable this check again, as we've disabled removal of entities from MemMap since there are issues
     // Check the reference we have is the only one remaining
-    //ASSERT_NULL(e3->m_location.m_loc)
-
-    //TODO: Enable this check again; it's disabled since we've disabled ref decrements in MemMap, since the knowledge code doesn't handle entity references correctly.
-    //ASSERT_EQUAL(e3->checkRef(), 0);
+    ASSERT_NULL(e3->m_location.m_loc);
+    ASSERT_EQUAL(e3->checkRef(), 0);
     e3->decRef();
 }
 
@@ -431,10 +422,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 DateTime::DateTime(int t)
 {
 }
@@ -451,6 +452,18 @@ TypeNode::TypeNode(const std::string & name) : m_name(name), m_parent(0)
 {
 }
 
+bool TypeNode::isTypeOf(const TypeNode * base_type) const
+{
+    const TypeNode * node = this;
+    do {
+        if (node == base_type) {
+            return true;
+        }
+        node = node->parent();
+    } while (node != 0);
+    return false;
+}
+
 void log(LogLevel lvl, const std::string & msg)
 {
 }
@@ -52,6 +52,8 @@ LocatedEntity * TestWorld::addNewEntity(const std::string &,
 
 // stubs
 
+#include "stubs/common/stubTypeNode.h"
+
 namespace Atlas { namespace Objects { namespace Operation {
 int EAT_NO = -1;
 int NOURISH_NO = -1;
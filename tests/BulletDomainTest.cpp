@@ -113,3 +113,8 @@ HandlerResult PropertyBase::operation(LocatedEntity *,
 {
     return OPERATION_IGNORED;
 }
+
+PropertyTypeId PropertyBase::typeId() const
+{
+    return propertyTypeId<PropertyBase>();
+}
@@ -53,6 +53,8 @@ LocatedEntity * TestWorld::addNewEntity(const std::string &,
 
 // stubs
 
+#include "stubs/common/stubTypeNode.h"
+
 #include "rulesets/StatusProperty.h"
 
 namespace Atlas { namespace Objects { namespace Operation {
@@ -66,6 +68,11 @@ StatusProperty * StatusProperty::copy() const
     return 0;
 }
 
+PropertyTypeId StatusProperty::typeId() const
+{
+    return propertyTypeId<StatusProperty>();
+}
+
 void StatusProperty::apply(LocatedEntity * owner)
 {
 }
@@ -73,6 +73,7 @@
 #include "stubs/modules/stubDateTime.h"
 #include "stubs/rulesets/stubScript.h"
 #include "stubs/common/stubRouter.h"
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/rulesets/stubLocatedEntity.h"
 #include "stubs/rulesets/stubDomain.h"
 
@@ -313,6 +313,7 @@ int main()
 #include "stubs/server/stubExternalMindsManager.h"
 #include "stubs/server/stubExternalMindsConnection.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/modules/stubDateTime.h"
 #include "stubs/modules/stubWorldTime.h"
 #include "stubs/modules/stubLocation.h"
@@ -533,6 +534,11 @@ EntityProperty * EntityProperty::copy() const
     return 0;
 }
 
+PropertyTypeId EntityProperty::typeId() const
+{
+    return propertyTypeId<EntityProperty>();
+}
+
 Task::~Task()
 {
 }
@@ -587,6 +593,11 @@ HandlerResult PropertyBase::operation(LocatedEntity *,
     return OPERATION_IGNORED;
 }
 
+PropertyTypeId PropertyBase::typeId() const
+{
+    return propertyTypeId<PropertyBase>();
+}
+
 template<>
 void Property<int>::set(const Atlas::Message::Element & e)
 {
@@ -635,6 +646,11 @@ SoftProperty * SoftProperty::copy() const
     return 0;
 }
 
+PropertyTypeId SoftProperty::typeId() const
+{
+    return propertyTypeId<SoftProperty>();
+}
+
 ContainsProperty::ContainsProperty(LocatedEntitySet & data) :
       PropertyBase(per_ephem), m_data(data)
 {
@@ -664,6 +680,11 @@ StatusProperty * StatusProperty::copy() const
     return 0;
 }
 
+PropertyTypeId StatusProperty::typeId() const
+{
+    return propertyTypeId<StatusProperty>();
+}
+
 void StatusProperty::apply(LocatedEntity * owner)
 {
 }
@@ -320,6 +320,7 @@ bool restricted_flag;
 #include "stubs/server/stubExternalMindsManager.h"
 #include "stubs/server/stubExternalMindsConnection.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/modules/stubDateTime.h"
 #include "stubs/modules/stubWorldTime.h"
 #include "stubs/modules/stubLocation.h"
@@ -649,6 +650,11 @@ EntityProperty * EntityProperty::copy() const
     return 0;
 }
 
+PropertyTypeId EntityProperty::typeId() const
+{
+    return propertyTypeId<EntityProperty>();
+}
+
 Task::~Task()
 {
 }
@@ -683,6 +689,11 @@ TasksProperty * TasksProperty::copy() const
     return 0;
 }
 
+PropertyTypeId TasksProperty::typeId() const
+{
+    return propertyTypeId<TasksProperty>();
+}
+
 int TasksProperty::startTask(Task *, LocatedEntity *, const Operation &, OpVector &)
 {
     return 0;
@@ -753,6 +764,11 @@ HandlerResult PropertyBase::operation(LocatedEntity *,
     return OPERATION_IGNORED;
 }
 
+PropertyTypeId PropertyBase::typeId() const
+{
+    return propertyTypeId<PropertyBase>();
+}
+
 template<>
 void Property<int>::set(const Atlas::Message::Element & e)
 {
@@ -801,6 +817,11 @@ SoftProperty * SoftProperty::copy() const
     return 0;
 }
 
+PropertyTypeId SoftProperty::typeId() const
+{
+    return propertyTypeId<SoftProperty>();
+}
+
 ContainsProperty::ContainsProperty(LocatedEntitySet & data) :
       PropertyBase(per_ephem), m_data(data)
 {
@@ -830,6 +851,11 @@ StatusProperty * StatusProperty::copy() const
     return 0;
 }
 
+PropertyTypeId StatusProperty::typeId() const
+{
+    return propertyTypeId<StatusProperty>();
+}
+
 void StatusProperty::apply(LocatedEntity * owner)
 {
 }
@@ -686,6 +686,11 @@ EntityProperty * EntityProperty::copy() const
     return 0;
 }
 
+PropertyTypeId EntityProperty::typeId() const
+{
+    return propertyTypeId<EntityProperty>();
+}
+
 
 
 
@@ -0,0 +1,228 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "navigation/Awareness.h"
+#include "navigation/IHeightProvider.h"
+#include "navigation/TileBuildPool.h"
+#include "rulesets/MemEntity.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+class FlatHeightProvider : public IHeightProvider
+{
+    public:
+        void blitHeights(int xMin, int xMax, int yMin, int yMax, std::vector<float>& heights) const override
+        {
+            std::fill(heights.begin(), heights.end(), 0.f);
+        }
+};
+
+/// \brief Measures obstacle avoidance for a herd of agents in one area
+///
+/// Every agent is also a moving obstacle for all the others. Avoidance is
+/// done once for each agent, as steering did before crowd avoidance, and
+/// then for all of them in crowd passes, with and without worker threads.
+class CrowdAvoidanceBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const int s_agentCount = 2000;
+        static const int s_rounds = 5;
+        static constexpr float s_areaSize = 150.f;
+        static constexpr double s_timestamp = 10.;
+
+        FlatHeightProvider m_heightProvider;
+        MemEntity * m_domain;
+        std::vector<MemEntity *> m_agents;
+        std::vector<WFMath::Vector<2>> m_desiredVelocities;
+        Awareness * m_awareness;
+
+        WFMath::Point<2> position(const MemEntity * agent) const;
+
+        void crowdPasses(Awareness & awareness, const std::string & name, int & avoiding);
+
+    public:
+        CrowdAvoidanceBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_perAgent();
+
+        void test_crowd();
+
+        void test_crowdThreads();
+};
+
+CrowdAvoidanceBenchmark::CrowdAvoidanceBenchmark()
+{
+    ADD_TEST(CrowdAvoidanceBenchmark::test_perAgent);
+    ADD_TEST(CrowdAvoidanceBenchmark::test_crowd);
+    ADD_TEST(CrowdAvoidanceBenchmark::test_crowdThreads);
+}
+
+void CrowdAvoidanceBenchmark::setup()
+{
+    m_domain = new MemEntity("1", 1);
+
+    double timestamp = s_timestamp;
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> coord(0, s_areaSize);
+    std::uniform_real_distribution<float> angle(0, WFMath::numeric_constants<float>::pi() * 2);
+    for (long i = 0; i < s_agentCount; ++i) {
+        MemEntity * agent = new MemEntity(std::to_string(i + 2), i + 2);
+        agent->m_location.m_pos = WFMath::Point<3>(coord(random), 0, coord(random));
+        agent->m_location.setBBox(BBox(WFMath::Point<3>(-0.4, 0, -0.4), WFMath::Point<3>(0.4, 1.8, 0.4)));
+        float theta = angle(random);
+        agent->m_location.m_velocity = WFMath::Vector<3>(std::cos(theta), 0, std::sin(theta));
+        agent->m_location.update(timestamp);
+        m_agents.push_back(agent);
+        m_desiredVelocities.emplace_back(std::cos(theta) * 2, std::sin(theta) * 2);
+    }
+    m_awareness = nullptr;
+}
+
+void CrowdAvoidanceBenchmark::teardown()
+{
+    delete m_awareness;
+    for (MemEntity * agent : m_agents) {
+        delete agent;
+    }
+    m_agents.clear();
+    m_desiredVelocities.clear();
+    delete m_domain;
+}
+
+WFMath::Point<2> CrowdAvoidanceBenchmark::position(const MemEntity * agent) const
+{
+    return WFMath::Point<2>(agent->m_location.pos().x(), agent->m_location.pos().z());
+}
+
+/// \brief Run crowd passes for all agents
+///
+/// @param avoiding set to the number of agents which had to avoid something
+void CrowdAvoidanceBenchmark::crowdPasses(Awareness & awareness, const std::string & name, int & avoiding)
+{
+    for (MemEntity * agent : m_agents) {
+        awareness.addEntity(*agent, *agent, true);
+    }
+    for (int i = 0; i < s_agentCount; ++i) {
+        awareness.setCrowdAgent(m_agents[i]->getIntId(), position(m_agents[i]), m_desiredVelocities[i]);
+    }
+    ASSERT_EQUAL(awareness.crowdAgentCount(), (size_t)s_agentCount);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        // Passes closer to each other than the interval are skipped.
+        ASSERT_TRUE(awareness.updateCrowd(s_timestamp + round, 0.5));
+        ASSERT_FALSE(awareness.updateCrowd(s_timestamp + round + 0.1, 0.5));
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    avoiding = 0;
+    WFMath::Vector<2> newVelocity;
+    for (MemEntity * agent : m_agents) {
+        if (awareness.getCrowdAvoidance(agent->getIntId(), newVelocity)) {
+            ++avoiding;
+        }
+    }
+    std::cout << name << ": " << microseconds / (1000. * s_rounds) << " ms per tick, "
+              << avoiding << " agents avoiding" << std::endl;
+}
+
+void CrowdAvoidanceBenchmark::test_perAgent()
+{
+    WFMath::AxisBox<3> extent(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(s_areaSize, 50, s_areaSize));
+    m_awareness = new Awareness(*m_domain, 0.4f, 2.f, m_heightProvider, extent);
+    for (MemEntity * agent : m_agents) {
+        m_awareness->addEntity(*agent, *agent, true);
+    }
+
+    int avoiding = 0;
+    WFMath::Vector<2> newVelocity;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        avoiding = 0;
+        for (int i = 0; i < s_agentCount; ++i) {
+            if (m_awareness->avoidObstacles(m_agents[i]->getIntId(), position(m_agents[i]), m_desiredVelocities[i], newVelocity, s_timestamp + round)) {
+                ++avoiding;
+            }
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "Avoidance per agent: " << microseconds / (1000. * s_rounds) << " ms per tick, "
+              << avoiding << " agents avoiding" << std::endl;
+}
+
+void CrowdAvoidanceBenchmark::test_crowd()
+{
+    WFMath::AxisBox<3> extent(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(s_areaSize, 50, s_areaSize));
+    m_awareness = new Awareness(*m_domain, 0.4f, 2.f, m_heightProvider, extent);
+    int avoiding = -1;
+    crowdPasses(*m_awareness, "Crowd avoidance", avoiding);
+
+    // The last pass must agree with avoiding for each agent on its own.
+    int expected = 0;
+    WFMath::Vector<2> newVelocity;
+    for (int i = 0; i < s_agentCount; ++i) {
+        if (m_awareness->avoidObstacles(m_agents[i]->getIntId(), position(m_agents[i]), m_desiredVelocities[i], newVelocity, s_timestamp + s_rounds - 1)) {
+            ++expected;
+        }
+    }
+    ASSERT_EQUAL(avoiding, expected);
+
+    for (MemEntity * agent : m_agents) {
+        m_awareness->removeCrowdAgent(agent->getIntId());
+    }
+    ASSERT_EQUAL(m_awareness->crowdAgentCount(), 0u);
+    ASSERT_FALSE(m_awareness->updateCrowd(s_timestamp + s_rounds, 0.5));
+}
+
+void CrowdAvoidanceBenchmark::test_crowdThreads()
+{
+    TileBuildPool pool(3);
+    WFMath::AxisBox<3> extent(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(s_areaSize, 50, s_areaSize));
+    Awareness awareness(*m_domain, 0.4f, 2.f, m_heightProvider, extent, 64, &pool);
+    int avoiding = -1;
+    crowdPasses(awareness, "Crowd avoidance with 3 threads", avoiding);
+
+    Awareness single(*m_domain, 0.4f, 2.f, m_heightProvider, extent);
+    int expected = -2;
+    crowdPasses(single, "Crowd avoidance without threads", expected);
+    ASSERT_EQUAL(avoiding, expected);
+}
+
+int main()
+{
+    CrowdAvoidanceBenchmark t;
+
+    return t.run();
+}
@@ -233,10 +233,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 void Location::addToMessage(MapType & omap) const
 {
 }
@@ -52,6 +52,8 @@ LocatedEntity * TestWorld::addNewEntity(const std::string &,
 
 // stubs
 
+#include "stubs/common/stubTypeNode.h"
+
 void addToEntity(const Point3D & p, std::vector<double> & vd)
 {
 }
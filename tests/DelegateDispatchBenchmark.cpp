@@ -0,0 +1,184 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+#include "TestWorld.h"
+#include "TestPropertyManager.h"
+
+#include "rulesets/Entity.h"
+
+#include "common/Property.h"
+#include "common/TypeNode.h"
+#include "common/log.h"
+
+#include <Atlas/Objects/Anonymous.h>
+#include <Atlas/Objects/Operation.h>
+
+#include <chrono>
+#include <sstream>
+
+#include "stubs/common/stubLog.h"
+
+using Atlas::Objects::Entity::Anonymous;
+using Atlas::Objects::Operation::Tick;
+
+/// \brief Property which counts the Tick operations delegated to it
+class CountingProperty : public Property<int> {
+  public:
+    static long s_calls;
+
+    void install(LocatedEntity * owner, const std::string & name) override
+    {
+        owner->installDelegate(Atlas::Objects::Operation::TICK_NO, name);
+    }
+
+    void install(TypeNode * type, const std::string & name) override
+    {
+        type->addDelegate(Atlas::Objects::Operation::TICK_NO, name, this);
+    }
+
+    void remove(LocatedEntity * owner, const std::string & name) override
+    {
+        owner->removeDelegate(Atlas::Objects::Operation::TICK_NO, name);
+    }
+
+    HandlerResult operation(LocatedEntity *,
+                            const Operation &,
+                            OpVector &) override
+    {
+        ++s_calls;
+        return OPERATION_HANDLED;
+    }
+
+    CountingProperty * copy() const override
+    {
+        return new CountingProperty(*this);
+    }
+};
+
+long CountingProperty::s_calls = 0;
+
+class DelegateDispatchBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const long s_entityCount = 100000L;
+        static const int s_rounds = 10;
+        static const int s_delegateCount = 3;
+
+        TestPropertyManager * m_propertyManager;
+        TypeNode * m_type;
+        std::vector<Entity *> m_entities;
+
+    public:
+        DelegateDispatchBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_dispatch();
+};
+
+DelegateDispatchBenchmark::DelegateDispatchBenchmark()
+{
+    ADD_TEST(DelegateDispatchBenchmark::test_dispatch);
+}
+
+void DelegateDispatchBenchmark::setup()
+{
+    m_propertyManager = new TestPropertyManager;
+
+    m_type = new TypeNode("thing", Anonymous());
+    for (int i = 0; i < s_delegateCount; ++i) {
+        CountingProperty * prop = new CountingProperty;
+        prop->setFlags(flag_class);
+        m_type->injectProperty("counting" + std::to_string(i), prop);
+        prop->install(m_type, "counting" + std::to_string(i));
+    }
+
+    // Set up the entities the way the entity factory does, installing
+    // every class property on each entity.
+    m_entities.reserve(s_entityCount);
+    for (long i = 0; i < s_entityCount; ++i) {
+        Entity * entity = new Entity(std::to_string(i + 1), i + 1);
+        entity->setType(m_type);
+        for (auto & entry : m_type->defaults()) {
+            entry.second->install(entity, entry.first);
+        }
+        m_entities.push_back(entity);
+    }
+}
+
+void DelegateDispatchBenchmark::teardown()
+{
+    for (Entity * entity : m_entities) {
+        delete entity;
+    }
+    m_entities.clear();
+    delete m_type;
+    delete m_propertyManager;
+}
+
+void DelegateDispatchBenchmark::test_dispatch()
+{
+    // Every other entity gets an instance copy of one of the properties,
+    // which must be called instead of the class property.
+    for (long i = 0; i < s_entityCount; i += 2) {
+        m_entities[i]->modProperty("counting0");
+    }
+
+    Tick tick;
+    OpVector res;
+    CountingProperty::s_calls = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (Entity * entity : m_entities) {
+            entity->operation(tick, res);
+        }
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(CountingProperty::s_calls, s_rounds * s_entityCount * s_delegateCount);
+    std::stringstream ss;
+    ss << "Delegate dispatch: " << (milliseconds * 1000000.) / (s_rounds * s_entityCount)
+       << " ns per operation, " << s_delegateCount << " delegates";
+    log(INFO, ss.str());
+}
+
+void TestWorld::message(const Operation& op, LocatedEntity& ent)
+{
+}
+
+LocatedEntity* TestWorld::addNewEntity(const std::string&,
+                                       const Atlas::Objects::Entity::RootEntity&)
+{
+    return 0;
+}
+
+int main()
+{
+    DelegateDispatchBenchmark t;
+
+    return t.run();
+}
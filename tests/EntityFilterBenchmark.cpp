@@ -0,0 +1,297 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/entityfilter/Filter.h"
+#include "rulesets/entityfilter/Providers.h"
+#include "rulesets/entityfilter/ParserDefinitions.h"
+
+#include "rulesets/Domain.h"
+#include "rulesets/AtlasProperties.h"
+#include "rulesets/Entity.h"
+#include "common/BaseWorld.h"
+#include "common/Inheritance.h"
+#include "common/Property.h"
+#include "common/TypeNode.h"
+#include "common/log.h"
+
+#include <chrono>
+#include <iostream>
+
+using Atlas::Message::Element;
+
+using namespace EntityFilter;
+
+static std::map<std::string, TypeNode*> types;
+
+class EntityFilterBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const long s_entityCount = 10000L;
+        static const int s_rounds = 100;
+
+        ProviderFactory m_factory;
+        TypeNode * m_thingType;
+        TypeNode * m_creatureType;
+        TypeNode * m_plantType;
+        std::vector<Entity *> m_entities;
+
+        /// \brief Parse a query into a predicate tree, as the filter did
+        /// before queries were compiled
+        Predicate * parse(const std::string & query);
+
+        void compare(const std::string & query);
+
+    public:
+        EntityFilterBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_throughput();
+};
+
+EntityFilterBenchmark::EntityFilterBenchmark()
+{
+    ADD_TEST(EntityFilterBenchmark::test_throughput);
+}
+
+void EntityFilterBenchmark::setup()
+{
+    m_thingType = new TypeNode("thing");
+    types["thing"] = m_thingType;
+    m_creatureType = new TypeNode("creature");
+    m_creatureType->setParent(m_thingType);
+    types["creature"] = m_creatureType;
+    m_plantType = new TypeNode("plant");
+    m_plantType->setParent(m_thingType);
+    types["plant"] = m_plantType;
+
+    m_entities.reserve(s_entityCount);
+    for (long i = 0; i < s_entityCount; ++i) {
+        Entity * entity = new Entity(std::to_string(i + 1), i + 1);
+        entity->setType(i % 3 == 0 ? m_creatureType : m_plantType);
+        entity->setProperty("mass", new SoftProperty(Element((int)(i % 100))));
+        entity->setProperty("status", new SoftProperty(Element(i % 2 ? 1.0 : 0.5)));
+        m_entities.push_back(entity);
+    }
+}
+
+void EntityFilterBenchmark::teardown()
+{
+    for (Entity * entity : m_entities) {
+        delete entity;
+    }
+    m_entities.clear();
+    delete m_plantType;
+    delete m_creatureType;
+    delete m_thingType;
+}
+
+Predicate * EntityFilterBenchmark::parse(const std::string & query)
+{
+    parser::query_parser<std::string::const_iterator> grammar(&m_factory);
+    auto iter_begin = query.begin();
+    auto iter_end = query.end();
+    Predicate * predicate = nullptr;
+    bool parse_success = boost::spirit::qi::phrase_parse(iter_begin, iter_end, grammar,
+                                                         boost::spirit::ascii::space, predicate);
+    ASSERT_TRUE(parse_success && iter_begin == iter_end);
+    return predicate;
+}
+
+void EntityFilterBenchmark::compare(const std::string & query)
+{
+    Predicate * predicate = parse(query);
+    Filter filter(query, &m_factory);
+
+    long treeMatches = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (Entity * entity : m_entities) {
+            treeMatches += predicate->isMatch(QueryContext{*entity});
+        }
+    }
+    long treeNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    long programMatches = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (Entity * entity : m_entities) {
+            programMatches += filter.match(*entity);
+        }
+    }
+    long programNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    ASSERT_EQUAL(treeMatches, programMatches);
+
+    std::cout << "\"" << query << "\": "
+              << (double)treeNanoseconds / (s_rounds * s_entityCount) << " ns per match as tree, "
+              << (double)programNanoseconds / (s_rounds * s_entityCount) << " ns per match compiled, "
+              << filter.program().instructions().size() << " instructions"
+              << std::endl;
+    delete predicate;
+}
+
+void EntityFilterBenchmark::test_throughput()
+{
+    compare("entity.type = types.creature");
+    compare("entity.type instance_of types.thing");
+    compare("entity.type.name = 'plant'");
+    compare("entity.mass > 50");
+    compare("entity.type instance_of types.creature && entity.mass >= 20 && entity.status = 1.0");
+    compare("entity.type = types.plant || entity.id < 100");
+    compare("not entity.mass in [10, 20, 30] and 1 = 1");
+}
+
+int main()
+{
+    EntityFilterBenchmark t;
+
+    return t.run();
+}
+
+//Stubs
+
+#include "stubs/common/stubVariable.h"
+#include "stubs/common/stubMonitors.h"
+#include "stubs/rulesets/stubDomainProperty.h"
+#include "stubs/rulesets/stubIdProperty.h"
+#include "stubs/rulesets/stubDensityProperty.h"
+
+ContainsProperty::ContainsProperty(LocatedEntitySet & data) :
+        PropertyBase(per_ephem), m_data(data)
+{
+}
+
+int ContainsProperty::get(Atlas::Message::Element & e) const
+{
+    return 0;
+}
+
+void ContainsProperty::set(const Atlas::Message::Element & e)
+{
+}
+
+void ContainsProperty::add(const std::string & s,
+                           const Atlas::Objects::Entity::RootEntity & ent) const
+{
+}
+
+ContainsProperty * ContainsProperty::copy() const
+{
+    return 0;
+}
+
+namespace Atlas
+{
+namespace Objects
+{
+namespace Operation
+{
+int ACTUATE_NO = -1;
+int ATTACK_NO = -1;
+int EAT_NO = -1;
+int NOURISH_NO = -1;
+int SETUP_NO = -1;
+int TICK_NO = -1;
+int UPDATE_NO = -1;
+int RELAY_NO = -1;
+}
+}
+}
+Router::Router(const std::string & id, long intId) :
+        m_id(id), m_intId(intId)
+{
+}
+
+Router::~Router()
+{
+}
+
+void Router::addToMessage(Atlas::Message::MapType & omap) const
+{
+}
+
+void Router::addToEntity(const Atlas::Objects::Entity::RootEntity & ent) const
+{
+}
+BaseWorld*BaseWorld::m_instance = 0;
+BaseWorld::BaseWorld(LocatedEntity & gw) :
+        m_gameWorld(gw)
+{
+    m_instance = this;
+}
+
+BaseWorld::~BaseWorld()
+{
+    m_instance = 0;
+}
+
+LocatedEntity * BaseWorld::getEntity(const std::string & id) const
+{
+    return 0;
+}
+
+void Location::addToMessage(MapType & omap) const
+{
+}
+
+Location::Location() :
+        m_loc(0)
+{
+}
+
+void Location::addToEntity(const Atlas::Objects::Entity::RootEntity & ent) const
+{
+}
+void Location::modifyBBox()
+{
+}
+
+Inheritance::Inheritance()
+{
+}
+
+Inheritance & Inheritance::instance()
+{
+    return *(new Inheritance());
+}
+
+const TypeNode * Inheritance::getType(const std::string & parent)
+{
+    auto I = types.find(parent);
+    if (I == types.end()) {
+        return 0;
+    }
+    return I->second;
+}
+
+void log(LogLevel lvl, const std::string & msg)
+{
+}
+
@@ -9,6 +9,7 @@
 #include "TestBase.h"
 
 #include "rulesets/entityfilter/Filter.h"
+#include "rulesets/entityfilter/FilterCache.h"
 
 #include "rulesets/entityfilter/Providers.h"
 
@@ -104,6 +105,12 @@ class EntityFilterTest : public Cyphesis::TestBase {
         //Test contains_recursive function
         void test_ContainsRecursive();
 
+        //Test how queries are compiled
+        void test_Program();
+
+        //Test the cache of compiled filters
+        void test_FilterCache();
+
 };
 
 void EntityFilterTest::test_SoftProperty()
@@ -326,6 +333,114 @@ void EntityFilterTest::test_ContainsRecursive()
             { m_b1, m_bl1 }, { m_b2 });
 }
 
+void EntityFilterTest::test_Program()
+{
+    typedef Program::Opcode Opcode;
+    ProviderFactory factory;
+
+    //Type checks are resolved to the type node
+    {
+        Filter f("entity.type=types.barrel", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 1);
+        assert(instructions[0].opcode == Opcode::TYPE_EQUALS);
+        assert(instructions[0].type == m_barrelType);
+    }
+    {
+        Filter f("entity.type instance_of types.barrel|types.boulder", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 2);
+        assert(instructions[0].opcode == Opcode::INSTANCE_OF);
+        assert(instructions[0].onTrue == Program::ACCEPT);
+        assert(instructions[0].onFalse == 1);
+        assert(instructions[1].opcode == Opcode::INSTANCE_OF);
+        assert(instructions[1].type == m_boulderType);
+        assert(instructions[1].onFalse == Program::REJECT);
+    }
+    //Properties are looked up by key
+    {
+        Filter f("entity.burn_speed>0.3 && entity.id=1", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 2);
+        assert(instructions[0].opcode == Opcode::PROPERTY_COMPARE);
+        assert(instructions[0].key == PropertyKey::find("burn_speed"));
+        assert(instructions[0].onTrue == 1);
+        assert(instructions[1].opcode == Opcode::ID_COMPARE);
+    }
+    //Negated comparisons swap the jumps
+    {
+        Filter f("entity.mass != 30", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 1);
+        assert(instructions[0].onTrue == Program::REJECT);
+        assert(instructions[0].onFalse == Program::ACCEPT);
+        assert(f.match(*m_b2));
+        assert(!f.match(*m_b1));
+        assert(f.match(*m_ch1));
+    }
+    //Constants are folded
+    {
+        Filter f("25 in [25, 30]", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 1);
+        assert(instructions[0].opcode == Opcode::CONSTANT);
+        assert(instructions[0].onTrue == Program::ACCEPT);
+    }
+    {
+        Filter f("'foo' in ['bar'] or entity.mass = 25", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 1);
+        assert(instructions[0].opcode == Opcode::PROPERTY_COMPARE);
+    }
+    //Anything else is left to the predicate
+    {
+        Filter f("contains_recursive(entity.contains, entity.type=types.boulder) = True", &factory);
+        auto& instructions = f.program().instructions();
+        assert(instructions.size() == 1);
+        assert(instructions[0].opcode == Opcode::PREDICATE);
+    }
+}
+
+void EntityFilterTest::test_FilterCache()
+{
+    ProviderFactory factory;
+    FilterCache cache(factory, 2);
+
+    auto barrels = cache.get("entity.type=types.barrel");
+    assert(cache.misses == 1);
+    assert(cache.get("entity.type=types.barrel") == barrels);
+    assert(cache.hits == 1);
+    assert(barrels->program().requiredType() == m_barrelType);
+    assert(barrels->match(*m_b1));
+
+    //Least recently used filters are evicted, but stay usable
+    auto boulders = cache.get("entity.type=types.boulder");
+    cache.get("entity.type=types.barrel");
+    cache.get("entity.mass=25");
+    assert(cache.size() == 2);
+    assert(cache.get("entity.type=types.barrel") == barrels);
+    assert(cache.get("entity.type=types.boulder") != boulders);
+    assert(boulders->match(*m_bl1));
+
+    //Invalid queries aren't cached
+    try {
+        cache.get("entity,type = types.barrel");
+        assert(false);
+    } catch (std::invalid_argument& e) {
+    }
+    assert(cache.size() == 2);
+
+    //Only queries which can't match without the type require it
+    assert(cache.get("entity.type=types.barrel||entity.mass=25")->program().requiredType() == nullptr);
+    assert(cache.get("entity.mass=25&&entity.type=types.barrel")->program().requiredType() == nullptr);
+
+    //Likewise for queries which require a base type
+    assert(cache.get("entity.type instance_of types.barrel")->program().requiredBaseType() == m_barrelType);
+    assert(cache.get("entity.type instance_of types.barrel")->program().requiredType() == nullptr);
+    assert(cache.get("entity.type=types.barrel")->program().requiredBaseType() == nullptr);
+    assert(cache.get("entity.type instance_of types.barrel||entity.mass=25")->program().requiredBaseType() == nullptr);
+}
+
 void EntityFilterTest::setup()
 {
 //Set up testing environment for Type/Soft properties
@@ -447,6 +562,8 @@ EntityFilterTest::EntityFilterTest()
     ADD_TEST(EntityFilterTest::test_Outfit);
     ADD_TEST(EntityFilterTest::test_BBox);
     ADD_TEST(EntityFilterTest::test_ContainsRecursive);
+    ADD_TEST(EntityFilterTest::test_Program);
+    ADD_TEST(EntityFilterTest::test_FilterCache);
 }
 
 int main()
@@ -0,0 +1,189 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/EntityGrid.h"
+#include "rulesets/LocatedEntity.h"
+
+#include <algorithm>
+
+class GridEntity : public LocatedEntity {
+  public:
+    GridEntity(const std::string & id, long intId) :
+        LocatedEntity(id, intId) { }
+
+    void destroy() override { }
+};
+
+class EntityGridtest : public Cyphesis::TestBase
+{
+  protected:
+    EntityGrid * m_grid;
+    LocatedEntity * m_e1;
+    LocatedEntity * m_e2;
+    LocatedEntity * m_e3;
+
+    bool collected(const Point3D & centre, WFMath::CoordType radius,
+                   LocatedEntity * entity);
+
+  public:
+    EntityGridtest();
+
+    void setup();
+    void teardown();
+
+    void test_update();
+    void test_remove();
+    void test_collect();
+    void test_collect_large();
+    void test_negative();
+};
+
+EntityGridtest::EntityGridtest()
+{
+    ADD_TEST(EntityGridtest::test_update);
+    ADD_TEST(EntityGridtest::test_remove);
+    ADD_TEST(EntityGridtest::test_collect);
+    ADD_TEST(EntityGridtest::test_collect_large);
+    ADD_TEST(EntityGridtest::test_negative);
+}
+
+void EntityGridtest::setup()
+{
+    m_grid = new EntityGrid(10.f);
+    m_e1 = new GridEntity("1", 1);
+    m_e2 = new GridEntity("2", 2);
+    m_e3 = new GridEntity("3", 3);
+}
+
+void EntityGridtest::teardown()
+{
+    delete m_grid;
+    delete m_e1;
+    delete m_e2;
+    delete m_e3;
+}
+
+bool EntityGridtest::collected(const Point3D & centre,
+                               WFMath::CoordType radius,
+                               LocatedEntity * entity)
+{
+    std::vector<LocatedEntity *> res;
+    m_grid->collect(centre, radius, res);
+    return std::find(res.begin(), res.end(), entity) != res.end();
+}
+
+void EntityGridtest::test_update()
+{
+    m_grid->update(m_e1, Point3D(1, 0, 1));
+    m_grid->update(m_e2, Point3D(2, 0, 2));
+    ASSERT_EQUAL(m_grid->size(), 2u);
+    ASSERT_EQUAL(m_grid->cellCount(), 1u);
+
+    // Moving within a cell, and then to another one
+    m_grid->update(m_e1, Point3D(5, 0, 5));
+    ASSERT_EQUAL(m_grid->cellCount(), 1u);
+    m_grid->update(m_e1, Point3D(25, 0, 5));
+    ASSERT_EQUAL(m_grid->size(), 2u);
+    ASSERT_EQUAL(m_grid->cellCount(), 2u);
+
+    // Height isn't indexed
+    m_grid->update(m_e2, Point3D(2, 100, 2));
+    ASSERT_EQUAL(m_grid->cellCount(), 2u);
+}
+
+void EntityGridtest::test_remove()
+{
+    m_grid->update(m_e1, Point3D(1, 0, 1));
+    m_grid->update(m_e2, Point3D(25, 0, 1));
+
+    ASSERT_TRUE(m_grid->remove(m_e1));
+    ASSERT_FALSE(m_grid->remove(m_e1));
+    ASSERT_FALSE(m_grid->remove(m_e3));
+    ASSERT_EQUAL(m_grid->size(), 1u);
+    // Empty cells are removed
+    ASSERT_EQUAL(m_grid->cellCount(), 1u);
+
+    m_grid->clear();
+    ASSERT_EQUAL(m_grid->size(), 0u);
+    ASSERT_EQUAL(m_grid->cellCount(), 0u);
+}
+
+void EntityGridtest::test_collect()
+{
+    m_grid->update(m_e1, Point3D(1, 0, 1));
+    m_grid->update(m_e2, Point3D(15, 0, 1));
+    m_grid->update(m_e3, Point3D(55, 0, 55));
+
+    ASSERT_TRUE(collected(Point3D(1, 0, 1), 2, m_e1));
+    ASSERT_FALSE(collected(Point3D(1, 0, 1), 2, m_e2));
+    ASSERT_TRUE(collected(Point3D(1, 0, 1), 10, m_e2));
+    ASSERT_FALSE(collected(Point3D(1, 0, 1), 10, m_e3));
+    ASSERT_TRUE(collected(Point3D(50, 0, 50), 1, m_e3));
+}
+
+void EntityGridtest::test_collect_large()
+{
+    m_grid->update(m_e1, Point3D(1, 0, 1));
+    m_grid->update(m_e2, Point3D(1000, 0, 1000));
+
+    // A radius covering many more cells than there are entities
+    ASSERT_TRUE(collected(Point3D(0, 0, 0), 5000, m_e1));
+    ASSERT_TRUE(collected(Point3D(0, 0, 0), 5000, m_e2));
+    ASSERT_FALSE(collected(Point3D(-3000, 0, 0), 2500, m_e2));
+}
+
+void EntityGridtest::test_negative()
+{
+    m_grid->update(m_e1, Point3D(-1, 0, -1));
+    m_grid->update(m_e2, Point3D(1, 0, 1));
+    ASSERT_EQUAL(m_grid->cellCount(), 2u);
+
+    ASSERT_TRUE(collected(Point3D(-5, 0, -5), 1, m_e1));
+    ASSERT_FALSE(collected(Point3D(-5, 0, -5), 1, m_e2));
+    ASSERT_FALSE(collected(Point3D(-15, 0, 5), 1, m_e1));
+}
+
+int main()
+{
+    EntityGridtest t;
+
+    return t.run();
+}
+
+// stubs
+
+#define STUB_LocatedEntity_LocatedEntity
+LocatedEntity::LocatedEntity(const std::string & id, long intId) :
+    Router(id, intId),
+    m_refCount(0), m_seq(0),
+    m_script(0), m_type(0), m_flags(0), m_contains(0)
+{
+}
+
+#include "stubs/rulesets/stubLocatedEntity.h"
+#include "stubs/common/stubRouter.h"
+#include "stubs/modules/stubLocation.h"
@@ -0,0 +1,210 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+#include "TestWorld.h"
+#include "TestPropertyManager.h"
+#include "ResidentMemory.h"
+
+#include "rulesets/Thing.h"
+#include "rulesets/MemEntity.h"
+
+#include "common/Property.h"
+#include "common/TypeNode.h"
+#include "common/log.h"
+
+#include <Atlas/Objects/Anonymous.h>
+
+#include <chrono>
+#include <sstream>
+
+#include "stubs/common/stubLog.h"
+
+using Atlas::Message::Element;
+using Atlas::Message::MapType;
+using Atlas::Objects::Entity::Anonymous;
+
+class EntityPoolBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const long s_entityCount = 1000000L;
+
+        TestPropertyManager * m_propertyManager;
+        TypeNode * m_type;
+
+        static void logPool(const std::string & name, const PoolStats & stats);
+
+    public:
+        EntityPoolBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_restore();
+
+        void test_churn();
+
+        void test_memEntities();
+};
+
+EntityPoolBenchmark::EntityPoolBenchmark()
+{
+    ADD_TEST(EntityPoolBenchmark::test_restore);
+    ADD_TEST(EntityPoolBenchmark::test_churn);
+    ADD_TEST(EntityPoolBenchmark::test_memEntities);
+}
+
+void EntityPoolBenchmark::logPool(const std::string & name,
+                                  const PoolStats & stats)
+{
+    std::stringstream ss;
+    ss << "Pool " << name << ": " << stats.inUse << " blocks in use, "
+       << stats.reserved << " reserved, " << stats.allocations
+       << " allocations";
+    log(INFO, ss.str());
+}
+
+void EntityPoolBenchmark::setup()
+{
+    m_propertyManager = new TestPropertyManager;
+
+    m_type = new TypeNode("thing", Anonymous());
+    Property<double> * massProp = new Property<double>();
+    massProp->data() = 100;
+    massProp->setFlags(flag_class);
+    m_type->injectProperty("mass", massProp);
+}
+
+void EntityPoolBenchmark::teardown()
+{
+    delete m_type;
+    delete m_propertyManager;
+}
+
+/// \brief Create entities and set attributes in the same way as restoring
+/// the world from the database does
+void EntityPoolBenchmark::test_restore()
+{
+    long baseline = residentBytes();
+    std::vector<Thing *> entities;
+    entities.reserve(s_entityCount);
+
+    MapType attrs;
+    attrs["status"] = 1.0;
+    attrs["mass"] = 50.0;
+    attrs["name"] = "rock";
+    attrs["test_attr"] = 1;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (long i = 0; i < s_entityCount; ++i) {
+        Thing * thing = new Thing(std::to_string(i + 1), i + 1);
+        thing->setType(m_type);
+        for (auto & entry : attrs) {
+            thing->setAttr(entry.first, entry.second);
+        }
+        entities.push_back(thing);
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::stringstream ss;
+    ss << "Restored " << s_entityCount << " entities in " << milliseconds << " ms";
+    log(INFO, ss.str());
+    ss = std::stringstream();
+    ss << "Memory per entity: " << (residentBytes() - baseline) / s_entityCount << " bytes";
+    log(INFO, ss.str());
+    logPool("entity", Entity::pools().stats());
+    logPool("property", PropertyBase::pools().stats());
+
+    start = std::chrono::high_resolution_clock::now();
+    for (Thing * thing : entities) {
+        delete thing;
+    }
+    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ss = std::stringstream();
+    ss << "Destroyed " << s_entityCount << " entities in " << milliseconds << " ms";
+    log(INFO, ss.str());
+    ASSERT_EQUAL(Entity::pools().stats().inUse, 0);
+}
+
+/// \brief Repeatedly create and destroy short lived entities
+void EntityPoolBenchmark::test_churn()
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (long i = 0; i < s_entityCount; ++i) {
+        Thing * thing = new Thing(std::to_string(i + 1), i + 1);
+        thing->setType(m_type);
+        thing->modProperty("mass");
+        delete thing;
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::stringstream ss;
+    ss << "Entity allocation rate: " << (s_entityCount * 1000.) / (milliseconds + 1) << " per second";
+    log(INFO, ss.str());
+}
+
+void EntityPoolBenchmark::test_memEntities()
+{
+    long baseline = residentBytes();
+    std::vector<MemEntity *> entities;
+    entities.reserve(s_entityCount);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (long i = 0; i < s_entityCount; ++i) {
+        MemEntity * entity = new MemEntity(std::to_string(i + 1), i + 1);
+        entity->setType(m_type);
+        entity->setAttr("status", 1.0);
+        entities.push_back(entity);
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::stringstream ss;
+    ss << "Created " << s_entityCount << " mind entities in " << milliseconds << " ms";
+    log(INFO, ss.str());
+    ss = std::stringstream();
+    ss << "Memory per mind entity: " << (residentBytes() - baseline) / s_entityCount << " bytes";
+    log(INFO, ss.str());
+    logPool("mem_entity", MemEntity::pools().stats());
+
+    for (MemEntity * entity : entities) {
+        delete entity;
+    }
+    ASSERT_EQUAL(MemEntity::pools().stats().inUse, 0);
+}
+
+void TestWorld::message(const Operation& op, LocatedEntity& ent)
+{
+}
+
+LocatedEntity* TestWorld::addNewEntity(const std::string&,
+                                       const Atlas::Objects::Entity::RootEntity&)
+{
+    return 0;
+}
+
+int main()
+{
+    EntityPoolBenchmark t;
+
+    return t.run();
+}
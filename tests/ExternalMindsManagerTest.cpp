@@ -0,0 +1,267 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "server/ExternalMindsManager.h"
+#include "server/ExternalMindsConnection.h"
+#include "server/PossessionAuthenticator.h"
+
+#include "rulesets/Character.h"
+#include "rulesets/ExternalMind.h"
+
+#include "common/Link.h"
+
+#include <map>
+
+/// \brief The number of possession requests sent on each link, keyed by link id
+static std::map<std::string, int> s_sent;
+
+class TestLink : public Link
+{
+    public:
+        TestLink(const std::string & id, long iid) : Link(*(CommSocket*)nullptr, id, iid)
+        {
+        }
+
+        void externalOperation(const Operation & op, Link &) override
+        {
+        }
+
+        void operation(const Operation &, OpVector &) override
+        {
+        }
+};
+
+class ExternalMindsManagertest : public Cyphesis::TestBase
+{
+    protected:
+        ExternalMindsManager * m_manager;
+        TestLink * m_linkA;
+        TestLink * m_linkB;
+        TestLink * m_linkC;
+        std::vector<Character *> m_characters;
+
+        Character & newCharacter();
+
+        void possess(Character & character, Link & link);
+
+    public:
+        ExternalMindsManagertest();
+
+        void setup();
+
+        void teardown();
+
+        void test_spread();
+
+        void test_possessedLoad();
+
+        void test_removeConnection();
+
+        void test_addConnectionRetry();
+};
+
+ExternalMindsManagertest::ExternalMindsManagertest()
+{
+    ADD_TEST(ExternalMindsManagertest::test_spread);
+    ADD_TEST(ExternalMindsManagertest::test_possessedLoad);
+    ADD_TEST(ExternalMindsManagertest::test_removeConnection);
+    ADD_TEST(ExternalMindsManagertest::test_addConnectionRetry);
+}
+
+void ExternalMindsManagertest::setup()
+{
+    PossessionAuthenticator::init();
+    m_manager = new ExternalMindsManager();
+    m_linkA = new TestLink("1", 1);
+    m_linkB = new TestLink("2", 2);
+    m_linkC = new TestLink("3", 3);
+    s_sent.clear();
+    ExternalMindsManager::s_possessionRequestTimeout = 1000;
+}
+
+void ExternalMindsManagertest::teardown()
+{
+    delete m_manager;
+    for (Character * character : m_characters) {
+        delete character->m_externalMind;
+        delete character;
+    }
+    m_characters.clear();
+    delete m_linkA;
+    delete m_linkB;
+    delete m_linkC;
+    PossessionAuthenticator::del();
+}
+
+Character & ExternalMindsManagertest::newCharacter()
+{
+    long id = 10 + m_characters.size();
+    Character * character = new Character(std::to_string(id), id);
+    m_characters.push_back(character);
+    return *character;
+}
+
+void ExternalMindsManagertest::possess(Character & character, Link & link)
+{
+    character.m_externalMind = new ExternalMind(character);
+    character.m_externalMind->linkUp(&link);
+    character.externalLinkChanged();
+}
+
+void ExternalMindsManagertest::test_spread()
+{
+    m_manager->addConnection(ExternalMindsConnection(m_linkA, "a"));
+    m_manager->addConnection(ExternalMindsConnection(m_linkB, "b"));
+
+    for (int i = 0; i < 4; ++i) {
+        m_manager->requestPossession(newCharacter(), "", "");
+    }
+
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 2u);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("b"), 2u);
+    ASSERT_EQUAL(s_sent["1"], 2);
+    ASSERT_EQUAL(s_sent["2"], 2);
+}
+
+void ExternalMindsManagertest::test_possessedLoad()
+{
+    m_manager->addConnection(ExternalMindsConnection(m_linkA, "a"));
+
+    Character & first = newCharacter();
+    m_manager->requestPossession(first, "", "");
+    possess(first, *m_linkA);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 1u);
+
+    //A possessed mind counts as much as a requested one.
+    m_manager->addConnection(ExternalMindsConnection(m_linkB, "b"));
+    m_manager->requestPossession(newCharacter(), "", "");
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 1u);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("b"), 1u);
+    ASSERT_EQUAL(s_sent["2"], 1);
+}
+
+void ExternalMindsManagertest::test_removeConnection()
+{
+    m_manager->addConnection(ExternalMindsConnection(m_linkA, "a"));
+    m_manager->addConnection(ExternalMindsConnection(m_linkB, "b"));
+    m_manager->requestPossession(newCharacter(), "", "");
+    m_manager->requestPossession(newCharacter(), "", "");
+    ASSERT_EQUAL(s_sent["1"], 1);
+
+    //The request which the removed connection didn't fulfil is sent to the one left.
+    ASSERT_EQUAL(m_manager->removeConnection("b"), 0);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 2u);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("b"), 0u);
+    ASSERT_EQUAL(s_sent["1"], 2);
+
+    ASSERT_EQUAL(m_manager->removeConnection("b"), -1);
+}
+
+void ExternalMindsManagertest::test_addConnectionRetry()
+{
+    m_manager->addConnection(ExternalMindsConnection(m_linkA, "a"));
+    m_manager->requestPossession(newCharacter(), "", "");
+    ASSERT_EQUAL(s_sent["1"], 1);
+
+    //A recent request is left with the connection it was sent to.
+    m_manager->addConnection(ExternalMindsConnection(m_linkB, "b"));
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 1u);
+    ASSERT_EQUAL(s_sent["2"], 0);
+
+    //One which has gone unanswered for too long is sent again.
+    ExternalMindsManager::s_possessionRequestTimeout = 0;
+    m_manager->addConnection(ExternalMindsConnection(m_linkC, "c"));
+    ASSERT_EQUAL(m_manager->getConnectionLoad("a"), 0u);
+    ASSERT_EQUAL(m_manager->getConnectionLoad("c"), 1u);
+    ASSERT_EQUAL(s_sent["3"], 1);
+}
+
+int main()
+{
+    ExternalMindsManagertest t;
+
+    return t.run();
+}
+
+// stubs
+
+namespace Atlas { namespace Objects { namespace Operation {
+int POSSESS_NO = -1;
+} } }
+
+#define STUB_Link_send
+void Link::send(const Operation & op) const
+{
+    s_sent[getId()]++;
+}
+
+void Link::send(const OpVector& opVector) const
+{
+    s_sent[getId()] += (int)opVector.size();
+}
+
+#define STUB_PossessionAuthenticator_getPossessionKey
+boost::optional<std::string> PossessionAuthenticator::getPossessionKey(const std::string& entity_id)
+{
+    return std::string("key");
+}
+
+PossessionAuthenticator * PossessionAuthenticator::m_instance = nullptr;
+
+ExternalMind::ExternalMind(LocatedEntity & e) : Router(e.getId(), e.getIntId()),
+                                         m_link(0), m_entity(e)
+{
+}
+
+void ExternalMind::externalOperation(const Operation &, Link &)
+{
+}
+
+void ExternalMind::operation(const Operation & op, OpVector & res)
+{
+}
+
+void ExternalMind::linkUp(Link * c)
+{
+    m_link = c;
+}
+
+#include "stubs/server/stubPossessionAuthenticator.h"
+#include "stubs/rulesets/stubCharacter.h"
+#include "stubs/rulesets/stubThing.h"
+#include "stubs/rulesets/stubEntity.h"
+#include "stubs/rulesets/stubLocatedEntity.h"
+#include "stubs/common/stubLink.h"
+#include "stubs/common/stubRouter.h"
+#include "stubs/common/stubTypeNode.h"
+#include "stubs/common/stubMonitors.h"
+#include "stubs/modules/stubLocation.h"
+#include "stubs/common/stubProperty.h"
+
+void log(LogLevel lvl, const std::string & msg)
+{
+}
@@ -26,6 +26,7 @@
 #include "server/HttpCache.h"
 
 #include "common/globals.h"
+#include "common/ScriptProfiler.h"
 
 #include <varconf/config.h>
 
@@ -140,6 +141,28 @@ int main()
         HttpCache::del();
     }
 
+    // HTTP script profiling
+    {
+        HttpCache *hc = HttpCache::instance();
+
+        std::list<std::string> headers;
+        headers.push_back("GET /profile/scripts/enable HTTP/1.0");
+        hc->processQuery(std::cout, headers);
+        assert(ScriptProfiler::enabled());
+
+        headers.clear();
+        headers.push_back("GET /profile/scripts HTTP/1.0");
+        hc->processQuery(std::cout, headers);
+
+        headers.clear();
+        headers.push_back("GET /profile/scripts/disable HTTP/1.0");
+        hc->processQuery(std::cout, headers);
+        assert(!ScriptProfiler::enabled());
+
+        HttpCache::del();
+        ScriptProfiler::cleanup();
+    }
+
     {
         TestHttpCache hc;
 
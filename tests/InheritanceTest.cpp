@@ -99,6 +99,8 @@ class Inheritancetest : public Cyphesis::TestBase
     void test_isTypeOf_string();
     void test_isTypeOf_TypeNode();
     void test_isTypeOf_TypeNode2();
+    void test_renumber();
+    void test_renumber_addChild();
     void test_flush();
 };
 
@@ -125,6 +127,8 @@ Inheritancetest::Inheritancetest()
     ADD_TEST(Inheritancetest::test_isTypeOf_string);
     ADD_TEST(Inheritancetest::test_isTypeOf_TypeNode);
     ADD_TEST(Inheritancetest::test_isTypeOf_TypeNode2);
+    ADD_TEST(Inheritancetest::test_renumber);
+    ADD_TEST(Inheritancetest::test_renumber_addChild);
     ADD_TEST(Inheritancetest::test_flush);
 }
 
@@ -337,6 +341,63 @@ void Inheritancetest::test_isTypeOf_TypeNode2()
     assert(i.isTypeOf(root_operation, root_operation));
 }
 
+void Inheritancetest::test_renumber()
+{
+    Inheritance & i = Inheritance::instance();
+
+    const TypeNode * root = i.getType("root");
+    ASSERT_NOT_NULL(root);
+    const TypeNode * root_operation = i.getType("root_operation");
+    ASSERT_NOT_NULL(root_operation);
+    const TypeNode * disappearance = i.getType("disappearance");
+    ASSERT_NOT_NULL(disappearance);
+    const TypeNode * root_entity = i.getType("root_entity");
+    ASSERT_NOT_NULL(root_entity);
+
+    // The tree is numbered as soon as the standard types are installed.
+    ASSERT_EQUAL(root->treeIndex(), 0);
+    ASSERT_EQUAL(root->treeLast(), (int)i.getAllObjects().size() - 1);
+
+    // Every node lies within the interval of all its ancestors.
+    for (auto & entry : i.getAllObjects()) {
+        const TypeNode * node = entry.second;
+        ASSERT_TRUE(node->treeIndex() != -1);
+        ASSERT_TRUE(node->treeIndex() <= node->treeLast());
+        for (const TypeNode * p = node->parent(); p != nullptr; p = p->parent()) {
+            ASSERT_TRUE(p->treeIndex() < node->treeIndex());
+            ASSERT_TRUE(node->treeLast() <= p->treeLast());
+        }
+    }
+
+    ASSERT_TRUE(root_operation->treeIndex() < disappearance->treeIndex());
+    ASSERT_TRUE(disappearance->treeIndex() <= root_operation->treeLast());
+    ASSERT_TRUE(disappearance->treeIndex() < root_entity->treeIndex() ||
+                disappearance->treeIndex() > root_entity->treeLast());
+}
+
+void Inheritancetest::test_renumber_addChild()
+{
+    Inheritance & i = Inheritance::instance();
+
+    Root r;
+    r->setId("squigglymuff");
+    r->setParent("disappearance");
+    TypeNode * squigglymuff = i.addChild(r);
+    ASSERT_NOT_NULL(squigglymuff);
+
+    // A node added after numbering stays unnumbered until renumbered.
+    ASSERT_EQUAL(squigglymuff->treeIndex(), -1);
+
+    i.renumber();
+
+    const TypeNode * disappearance = i.getType("disappearance");
+    ASSERT_NOT_NULL(disappearance);
+    ASSERT_TRUE(squigglymuff->treeIndex() > disappearance->treeIndex());
+    ASSERT_TRUE(squigglymuff->treeIndex() <= disappearance->treeLast());
+    ASSERT_TRUE(i.isTypeOf(squigglymuff, "root_operation"));
+    ASSERT_TRUE(!i.isTypeOf(squigglymuff, "root_entity"));
+}
+
 void Inheritancetest::test_flush()
 {
     Inheritance & i = Inheritance::instance();
@@ -0,0 +1,204 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/MemEntity.h"
+#include "rulesets/MemMap.h"
+
+#include <Atlas/Objects/Anonymous.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using Atlas::Objects::Entity::Anonymous;
+
+/// \brief Measures the location searches done by minds on every think
+///
+/// One memory with 5000 entities is searched once for each of 1000 minds,
+/// which is what a server with that many minds does on each think, without
+/// the need to keep 5 million remembered entities around.
+class MemMapBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const int s_entityCount = 5000;
+        static const int s_queryCount = 1000;
+        static const int s_rounds = 10;
+        static constexpr float s_worldSize = 1000.f;
+        static constexpr float s_radius = 30.f;
+
+        Script * m_script;
+        MemMap * m_memMap;
+        LocatedEntity * m_world;
+        std::vector<Location> m_queries;
+        std::mt19937 m_random;
+
+        void move(long id, double time);
+
+        long scan(const Location & where);
+
+    public:
+        MemMapBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_scan();
+
+        void test_index();
+
+        void test_moves();
+};
+
+MemMapBenchmark::MemMapBenchmark()
+{
+    ADD_TEST(MemMapBenchmark::test_scan);
+    ADD_TEST(MemMapBenchmark::test_index);
+    ADD_TEST(MemMapBenchmark::test_moves);
+}
+
+void MemMapBenchmark::move(long id, double time)
+{
+    std::uniform_real_distribution<float> coord(0, s_worldSize);
+    Anonymous ent;
+    ent->setId(std::to_string(id));
+    ent->setLoc("1");
+    double x = coord(m_random);
+    double z = coord(m_random);
+    ent->setPosAsList({x, 0., z});
+    MemEntity * entity = m_memMap->updateAdd(ent, time);
+    entity->setVisible();
+}
+
+void MemMapBenchmark::setup()
+{
+    m_random.seed(1);
+    m_script = nullptr;
+    m_memMap = new MemMap(m_script);
+    for (long i = 0; i < s_entityCount; ++i) {
+        move(i + 2, 0);
+    }
+    m_world = m_memMap->get("1");
+
+    std::uniform_real_distribution<float> coord(0, s_worldSize);
+    m_queries.clear();
+    for (int i = 0; i < s_queryCount; ++i) {
+        float x = coord(m_random);
+        float z = coord(m_random);
+        m_queries.push_back(Location(m_world, Point3D(x, 0, z)));
+    }
+}
+
+void MemMapBenchmark::teardown()
+{
+    m_memMap->flush();
+    delete m_memMap;
+}
+
+/// \brief Search the way it was done before the spatial index
+long MemMapBenchmark::scan(const Location & where)
+{
+    long found = 0;
+    float square_range = s_radius * s_radius;
+    for (LocatedEntity * item : *m_world->m_contains) {
+        if (item->isVisible() && squareDistance(where.pos(), item->m_location.pos()) < square_range) {
+            ++found;
+        }
+    }
+    return found;
+}
+
+void MemMapBenchmark::test_scan()
+{
+    long found = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & where : m_queries) {
+            found += scan(where);
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "Scanning the location: " << (microseconds * 1000.) / (s_rounds * s_queryCount)
+              << " ns per query, " << found / (s_rounds * s_queryCount) << " entities found per query" << std::endl;
+}
+
+void MemMapBenchmark::test_index()
+{
+    long expected = 0;
+    for (auto & where : m_queries) {
+        expected += scan(where);
+    }
+
+    long found = 0;
+    EntityVector res;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & where : m_queries) {
+            res.clear();
+            m_memMap->findInRange(where, s_radius, nullptr, res);
+            found += res.size();
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(found, expected * s_rounds);
+    std::cout << "Spatial index: " << (microseconds * 1000.) / (s_rounds * s_queryCount)
+              << " ns per query, " << found / (s_rounds * s_queryCount) << " entities found per query" << std::endl;
+}
+
+void MemMapBenchmark::test_moves()
+{
+    // Index the location, so that moves have to update it.
+    EntityVector res;
+    m_memMap->findInRange(m_queries.front(), s_radius, nullptr, res);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (long i = 0; i < s_entityCount; ++i) {
+            move(i + 2, round + 1);
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "Moving entities: " << (microseconds * 1000.) / (s_rounds * s_entityCount)
+              << " ns per update" << std::endl;
+
+    long expected = 0;
+    long found = 0;
+    for (auto & where : m_queries) {
+        expected += scan(where);
+        res.clear();
+        m_memMap->findInRange(where, s_radius, nullptr, res);
+        found += res.size();
+    }
+    ASSERT_EQUAL(found, expected);
+}
+
+int main()
+{
+    MemMapBenchmark t;
+
+    return t.run();
+}
@@ -69,6 +69,8 @@ class MemMaptest : public Cyphesis::TestBase
     void test_readEntity();
     void test_readEntity_type();
     void test_readEntity_type_nonexist();
+    void test_entitiesOfType();
+    void test_entitiesOfTypes();
     void test_addEntityMemory();
     void test_recallEntityMemory();
     void test_getEntityRelatedMemory();
@@ -76,6 +78,9 @@ class MemMaptest : public Cyphesis::TestBase
     void test_findByLoc_results();
     void test_findByLoc_invalid();
     void test_findByLoc_consistency_check();
+    void test_findInRange();
+    void test_check_budget();
+    void test_check_forget();
 
     static void Script_hook_called(const std::string &, LocatedEntity *);
 };
@@ -112,6 +117,8 @@ MemMaptest::MemMaptest()
     ADD_TEST(MemMaptest::test_readEntity);
     ADD_TEST(MemMaptest::test_readEntity_type);
     ADD_TEST(MemMaptest::test_readEntity_type_nonexist);
+    ADD_TEST(MemMaptest::test_entitiesOfType);
+    ADD_TEST(MemMaptest::test_entitiesOfTypes);
     ADD_TEST(MemMaptest::test_addEntityMemory);
     ADD_TEST(MemMaptest::test_recallEntityMemory);
     ADD_TEST(MemMaptest::test_getEntityRelatedMemory)
@@ -119,6 +126,9 @@ MemMaptest::MemMaptest()
     ADD_TEST(MemMaptest::test_findByLoc_results);
     ADD_TEST(MemMaptest::test_findByLoc_invalid);
     ADD_TEST(MemMaptest::test_findByLoc_consistency_check);
+    ADD_TEST(MemMaptest::test_findInRange);
+    ADD_TEST(MemMaptest::test_check_budget);
+    ADD_TEST(MemMaptest::test_check_forget);
 }
 
 void MemMaptest::setup()
@@ -246,6 +256,70 @@ void MemMaptest::test_readEntity_type_nonexist()
     ASSERT_NOT_EQUAL(ent->getType(), m_sampleType);
 }
 
+void MemMaptest::test_entitiesOfType()
+{
+    MemEntity * ent = new MemEntity("3", 3);
+    ent->setType(MemMap::m_entity_type);
+    m_memMap->addEntity(ent);
+
+    ASSERT_NULL(m_memMap->getEntitiesOfType(m_sampleType));
+    ASSERT_NOT_NULL(m_memMap->getEntitiesOfType(MemMap::m_entity_type));
+
+    // Learning the real type moves the entity in the index
+    Anonymous data;
+    data->setParent("sample_type");
+    m_memMap->readEntity(ent, data, 0);
+
+    const MemEntityDict * entities = m_memMap->getEntitiesOfType(m_sampleType);
+    ASSERT_NOT_NULL(entities);
+    ASSERT_EQUAL(entities->size(), 1u);
+    ASSERT_EQUAL(entities->begin()->second, ent);
+    ASSERT_TRUE(m_memMap->getEntitiesOfType(MemMap::m_entity_type)->empty());
+
+    m_memMap->del("3");
+    ASSERT_NULL(m_memMap->getEntitiesOfType(m_sampleType));
+}
+
+void MemMaptest::test_entitiesOfTypes()
+{
+    Root sub_desc;
+    sub_desc->setId("sub_type");
+    TypeNode * subType = Inheritance::instance().addChild(sub_desc);
+    subType->setParent(m_sampleType);
+
+    MemEntity * ent = new MemEntity("3", 3);
+    ent->setType(m_sampleType);
+    m_memMap->addEntity(ent);
+    MemEntity * sub_ent = new MemEntity("4", 4);
+    sub_ent->setType(subType);
+    m_memMap->addEntity(sub_ent);
+
+    std::vector<const MemEntityDict *> groups;
+    m_memMap->getEntitiesOfTypes(m_sampleType, false, groups);
+    ASSERT_EQUAL(groups.size(), 1u);
+    ASSERT_EQUAL(groups.front()->begin()->second, ent);
+
+    // Subtypes are found through the base type, but not the other way around
+    groups.clear();
+    m_memMap->getEntitiesOfTypes(m_sampleType, true, groups);
+    ASSERT_EQUAL(groups.size(), 2u);
+    groups.clear();
+    m_memMap->getEntitiesOfTypes(subType, true, groups);
+    ASSERT_EQUAL(groups.size(), 1u);
+    ASSERT_EQUAL(groups.front()->begin()->second, sub_ent);
+
+    ent->setVisible();
+    sub_ent->setVisible();
+    ASSERT_EQUAL(m_memMap->findByType("sample_type").size(), 1u);
+    ASSERT_EQUAL(m_memMap->findByType("sample_type", true).size(), 2u);
+    ASSERT_EQUAL(m_memMap->findByType("sub_type", true).size(), 1u);
+
+    m_memMap->del("4");
+    groups.clear();
+    m_memMap->getEntitiesOfTypes(m_sampleType, true, groups);
+    ASSERT_EQUAL(groups.size(), 1u);
+}
+
 void MemMaptest::test_addEntityMemory(){
     using Atlas::Message::Element;
 
@@ -433,6 +507,114 @@ void MemMaptest::test_findByLoc_consistency_check()
     ASSERT_TRUE(res.empty());
 }
 
+void MemMaptest::test_findInRange()
+{
+    MemEntity * tlve = new MemEntity("3", 3);
+    tlve->setType(m_sampleType);
+    m_memMap->addEntity(tlve);
+    tlve->m_contains = new LocatedEntitySet;
+
+    MemEntity * e4 = new MemEntity("4", 4);
+    e4->setVisible();
+    e4->setType(m_sampleType);
+    m_memMap->addEntity(e4);
+    e4->m_location.m_loc = tlve;
+    e4->m_location.m_pos = Point3D(1,0,1);
+    tlve->m_contains->insert(e4);
+
+    MemEntity * e5 = new MemEntity("5", 5);
+    e5->setVisible();
+    e5->setType(m_sampleType);
+    m_memMap->addEntity(e5);
+    e5->m_location.m_loc = tlve;
+    e5->m_location.m_pos = Point3D(30,0,30);
+    tlve->m_contains->insert(e5);
+
+    Location find_here(tlve);
+    find_here.m_pos = Point3D(0,0,0);
+
+    // The first search indexes the location
+    EntityVector res;
+    m_memMap->findInRange(find_here, 5.f, nullptr, res);
+    ASSERT_EQUAL(res.size(), 1u);
+    ASSERT_EQUAL(res.front(), e4);
+    ASSERT_EQUAL(m_memMap->m_grids.size(), 1u);
+    ASSERT_EQUAL(m_memMap->m_grids.begin()->second.size(), 2u);
+
+    // Moves are tracked by the index
+    e5->m_location.m_pos = Point3D(2,0,2);
+    m_memMap->updateGrid(e5, tlve);
+    res.clear();
+    m_memMap->findInRange(find_here, 5.f, m_sampleType, res, true);
+    ASSERT_EQUAL(res.size(), 2u);
+    ASSERT_EQUAL(res[0], e4);
+    ASSERT_EQUAL(res[1], e5);
+
+    find_here.m_pos = Point3D(3,0,3);
+    res.clear();
+    m_memMap->findInRange(find_here, 5.f, m_sampleType, res, true);
+    ASSERT_EQUAL(res.size(), 2u);
+    ASSERT_EQUAL(res[0], e5);
+    ASSERT_EQUAL(res[1], e4);
+
+    // Deleted entities are removed from the index
+    m_memMap->del("5");
+    res.clear();
+    m_memMap->findInRange(find_here, 5.f, nullptr, res);
+    ASSERT_EQUAL(res.size(), 1u);
+    ASSERT_EQUAL(res.front(), e4);
+    ASSERT_EQUAL(m_memMap->m_grids.begin()->second.size(), 1u);
+}
+
+void MemMaptest::test_check_budget()
+{
+    m_memMap->setBudget(10);
+    ASSERT_EQUAL(m_memMap->getBudget(), 10u);
+
+    for (long i = 10; i < 30; ++i) {
+        MemEntity * ent = new MemEntity(std::to_string(i), i);
+        ent->setType(m_sampleType);
+        ent->update(i);
+        m_memMap->addEntity(ent);
+    }
+    // Visible entities are never forgotten
+    m_memMap->get("10")->setVisible();
+
+    int evicted = MemMap::s_statistics.evicted;
+    m_memMap->check(30);
+
+    // The memory shrinks to below the budget, forgetting the entities
+    // which have gone unseen the longest.
+    ASSERT_EQUAL(m_memMap->m_entities.size(), 9u);
+    ASSERT_EQUAL(MemMap::s_statistics.evicted - evicted, 11);
+    ASSERT_NOT_NULL(m_memMap->get("10"));
+    ASSERT_NULL(m_memMap->get("11"));
+    ASSERT_NULL(m_memMap->get("21"));
+    ASSERT_NOT_NULL(m_memMap->get("22"));
+    ASSERT_NOT_NULL(m_memMap->get("29"));
+    ASSERT_EQUAL(m_memMap->getEntitiesOfType(m_sampleType)->size(), 9u);
+}
+
+void MemMaptest::test_check_forget()
+{
+    MemEntity * ent = new MemEntity("10", 10);
+    ent->setType(m_sampleType);
+    ent->update(0);
+    m_memMap->addEntity(ent);
+
+    // Without a budget nothing is forgotten, however long ago it was seen.
+    ASSERT_EQUAL(m_memMap->getBudget(), 0u);
+    m_memMap->check(10000);
+    m_memMap->check(10000);
+    ASSERT_NOT_NULL(m_memMap->get("10"));
+
+    // With one, entities unseen for long enough are.
+    m_memMap->setBudget(100);
+    m_memMap->check(10000);
+    m_memMap->check(10000);
+    ASSERT_NULL(m_memMap->get("10"));
+}
+
 int main()
 {
     MemMaptest t;
@@ -442,6 +624,26 @@ int main()
 
 // stubs
 
+#define STUB_Router_Router
+Router::Router(const std::string & id, long intId) : m_id(id), m_intId(intId)
+{
+}
+
+#define STUB_MemEntity_MemEntity
+MemEntity::MemEntity(const std::string & id, long intId) :
+           LocatedEntity(id, intId), m_lastSeen(0.)
+{
+}
+
+#define STUB_Location_Location
+Location::Location() : m_loc(nullptr)
+{
+}
+
+Location::Location(LocatedEntity * rf) : m_loc(rf)
+{
+}
+
 #include "stubs/rulesets/stubMemEntity.h"
 #include "stubs/rulesets/stubLocatedEntity.h"
 #include "stubs/common/stubRouter.h"
@@ -495,6 +697,18 @@ TypeNode::TypeNode(const std::string & name) : m_name(name), m_parent(0)
 {
 }
 
+bool TypeNode::isTypeOf(const TypeNode * base_type) const
+{
+    const TypeNode * node = this;
+    do {
+        if (node == base_type) {
+            return true;
+        }
+        node = node->parent();
+    } while (node != 0);
+    return false;
+}
+
 float squareDistance(const Point3D & u, const Point3D & v)
 {
     return 1.f;
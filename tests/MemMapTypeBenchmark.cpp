@@ -0,0 +1,220 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/MemEntity.h"
+#include "rulesets/MemMap.h"
+
+#include "common/Inheritance.h"
+#include "common/TypeNode.h"
+
+#include <Atlas/Objects/Anonymous.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+using Atlas::Objects::Entity::Anonymous;
+
+/// \brief Measures the type searches done by mind scripts
+///
+/// One memory with 5000 entities of 40 types is searched for each type,
+/// both the way it was done before the entities were indexed by type, by
+/// comparing the type name of every entity, and through the index. Then the
+/// same is done for the types with subtypes, including those.
+class MemMapTypeBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const int s_entityCount = 5000;
+        static const int s_categoryCount = 8;
+        static const int s_subtypeCount = 4;
+        static const int s_rounds = 100;
+
+        Script * m_script;
+        MemMap * m_memMap;
+        std::vector<std::string> m_types;
+        std::vector<std::string> m_categories;
+
+        long scan(const std::string & what);
+
+        long scanSubtypes(const TypeNode * type);
+
+    public:
+        MemMapTypeBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_exact();
+
+        void test_subtypes();
+};
+
+MemMapTypeBenchmark::MemMapTypeBenchmark()
+{
+    ADD_TEST(MemMapTypeBenchmark::test_exact);
+    ADD_TEST(MemMapTypeBenchmark::test_subtypes);
+}
+
+void MemMapTypeBenchmark::setup()
+{
+    m_types.clear();
+    m_categories.clear();
+    Anonymous thing_desc;
+    thing_desc->setId("thing");
+    thing_desc->setParent("root");
+    Inheritance::instance().addChild(thing_desc);
+    for (int i = 0; i < s_categoryCount; ++i) {
+        Anonymous category_desc;
+        category_desc->setId("category" + std::to_string(i));
+        category_desc->setParent("thing");
+        Inheritance::instance().addChild(category_desc);
+        m_categories.push_back(category_desc->getId());
+        m_types.push_back(category_desc->getId());
+        for (int j = 0; j < s_subtypeCount; ++j) {
+            Anonymous type_desc;
+            type_desc->setId(category_desc->getId() + "_" + std::to_string(j));
+            type_desc->setParent(category_desc->getId());
+            Inheritance::instance().addChild(type_desc);
+            m_types.push_back(type_desc->getId());
+        }
+    }
+    Inheritance::instance().renumber();
+
+    m_script = nullptr;
+    m_memMap = new MemMap(m_script);
+    std::mt19937 random(1);
+    std::uniform_int_distribution<size_t> type(0, m_types.size() - 1);
+    for (long i = 0; i < s_entityCount; ++i) {
+        Anonymous ent;
+        ent->setId(std::to_string(i + 2));
+        ent->setParent(m_types[type(random)]);
+        ent->setLoc("1");
+        ent->setPosAsList({0., 0., 0.});
+        MemEntity * entity = m_memMap->updateAdd(ent, 0);
+        entity->setVisible();
+    }
+}
+
+void MemMapTypeBenchmark::teardown()
+{
+    m_memMap->flush();
+    delete m_memMap;
+    Inheritance::clear();
+}
+
+/// \brief Search the way it was done before the type index
+long MemMapTypeBenchmark::scan(const std::string & what)
+{
+    long found = 0;
+    for (auto & entry : m_memMap->getEntities()) {
+        MemEntity * item = entry.second;
+        if (item->getType()->name() == what && item->isVisible()) {
+            ++found;
+        }
+    }
+    return found;
+}
+
+long MemMapTypeBenchmark::scanSubtypes(const TypeNode * type)
+{
+    long found = 0;
+    for (auto & entry : m_memMap->getEntities()) {
+        MemEntity * item = entry.second;
+        if (item->getType()->isTypeOf(type) && item->isVisible()) {
+            ++found;
+        }
+    }
+    return found;
+}
+
+void MemMapTypeBenchmark::test_exact()
+{
+    long expected = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & what : m_types) {
+            expected += scan(what);
+        }
+    }
+    long scanMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    long found = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & what : m_types) {
+            found += m_memMap->findByType(what).size();
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(found, expected);
+
+    long queries = s_rounds * m_types.size();
+    std::cout << "Scanning for a type: " << (scanMicroseconds * 1000.) / queries
+              << " ns per query, " << expected / queries << " entities found per query" << std::endl;
+    std::cout << "Type index: " << (microseconds * 1000.) / queries
+              << " ns per query, " << found / queries << " entities found per query" << std::endl;
+}
+
+void MemMapTypeBenchmark::test_subtypes()
+{
+    long expected = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & what : m_categories) {
+            expected += scanSubtypes(Inheritance::instance().getType(what));
+        }
+    }
+    long scanMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    long found = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        for (auto & what : m_categories) {
+            found += m_memMap->findByType(what, true).size();
+        }
+    }
+    long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(found, expected);
+
+    // All entities are things.
+    ASSERT_EQUAL(m_memMap->findByType("thing", true).size(), (size_t)s_entityCount);
+    ASSERT_TRUE(m_memMap->findByType("thing").empty());
+
+    long queries = s_rounds * m_categories.size();
+    std::cout << "Scanning for a type and its subtypes: " << (scanMicroseconds * 1000.) / queries
+              << " ns per query, " << expected / queries << " entities found per query" << std::endl;
+    std::cout << "Type index with subtypes: " << (microseconds * 1000.) / queries
+              << " ns per query, " << found / queries << " entities found per query" << std::endl;
+}
+
+int main()
+{
+    MemMapTypeBenchmark t;
+
+    return t.run();
+}
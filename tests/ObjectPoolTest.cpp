@@ -0,0 +1,90 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "common/ObjectPool.h"
+
+#include <cassert>
+#include <cstdint>
+
+class PooledBase : public PoolAllocated<PooledBase> {
+  public:
+    long m_a = 1;
+    virtual ~PooledBase() = default;
+};
+
+class PooledDerived : public PooledBase {
+  public:
+    char m_padding[100];
+};
+
+class PooledHuge : public PooledBase {
+  public:
+    char m_padding[SizedPools::max_size + 1];
+};
+
+int main()
+{
+    {
+        ObjectPool pool(32, 32 * 4);
+        assert(pool.capacity() == 0);
+        void * a = pool.allocate();
+        assert(pool.capacity() == 4);
+        void * b = pool.allocate();
+        assert(a != b);
+        assert(reinterpret_cast<std::uintptr_t>(a) % 16 == 0);
+        pool.deallocate(a);
+        // The most recently freed block is reused first.
+        assert(pool.allocate() == a);
+        pool.deallocate(a);
+        pool.deallocate(b);
+    }
+
+    PoolStats & stats = PooledBase::pools().stats();
+    assert(stats.inUse == 0);
+
+    PooledBase * base = new PooledBase;
+    PooledBase * derived = new PooledDerived;
+    assert(stats.inUse == 2);
+    assert(stats.allocations == 2);
+    assert(stats.reserved > 2);
+
+    // Deleting through the base returns the block to the derived size pool.
+    delete derived;
+    assert(stats.inUse == 1);
+    PooledBase * again = new PooledDerived;
+    assert(again == derived);
+    delete again;
+
+    // Objects too large for any pool still work.
+    PooledBase * huge = new PooledHuge;
+    assert(stats.inUse == 1);
+    delete huge;
+
+    delete base;
+    assert(stats.inUse == 0);
+    assert(stats.allocations == 4);
+
+    return 0;
+}
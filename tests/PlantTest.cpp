@@ -42,6 +42,17 @@
 
 #include "stubs/common/stubCustom.h"
 #include "stubs/common/stubRouter.h"
+/// \brief The number of entities added to systems
+static int s_systemEntities = 0;
+
+#define STUB_SystemScheduler_addEntity
+bool SystemScheduler::addEntity(int system, LocatedEntity & entity, int slice)
+{
+    ++s_systemEntities;
+    return false;
+}
+
+#include "stubs/common/stubSystemScheduler.h"
 #include "stubs/common/stubTypeNode.h"
 #include "stubs/modules/stubLocation.h"
 #include "stubs/rulesets/stubThing.h"
@@ -83,6 +94,21 @@ using Atlas::Message::Element;
 using Atlas::Message::ListType;
 using Atlas::Message::MapType;
 using Atlas::Objects::Entity::RootEntity;
+using Atlas::Objects::Operation::Tick;
+
+class SystemsWorld : public TestWorld {
+  public:
+    SystemsWorld(LocatedEntity & gw, SystemScheduler & systems) : TestWorld(gw) {
+        m_systems = &systems;
+    }
+};
+
+class TickScript : public Script {
+  public:
+    bool handlesOperation(const std::string & opname, int op_no) override {
+        return opname == "tick";
+    }
+};
 
 int main()
 {
@@ -102,6 +128,29 @@ int main()
     // Throw an op of every type at the entity again now it is subscribed
     ee.runOperations();
 
+    {
+        delete &BaseWorld::instance();
+        SystemScheduler systems(nullptr, nullptr);
+        SystemsWorld world(e, systems);
+
+        // The growth of a plant is left to the world.
+        OpVector res;
+        e.TickOperation(Tick(), res);
+        assert(s_systemEntities == 1);
+        assert(res.empty());
+
+        // A plant whose script handles Tick keeps ticking, so that the
+        // script is called again.
+        e.m_script = new TickScript;
+        e.TickOperation(Tick(), res);
+        assert(s_systemEntities == 1);
+        assert(!res.empty());
+        assert(res.front()->getClassNo() == Atlas::Objects::Operation::TICK_NO);
+        assert(res.front()->getTo() == e.getId());
+        delete e.m_script;
+        e.m_script = 0;
+    }
+
     return 0;
 }
 
@@ -179,10 +228,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 PropertyManager * PropertyManager::m_instance = 0;
 
 PropertyManager::PropertyManager()
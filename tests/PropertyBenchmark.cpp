@@ -0,0 +1,181 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+#include "TestWorld.h"
+#include "TestPropertyManager.h"
+#include "ResidentMemory.h"
+
+#include "rulesets/Entity.h"
+
+#include "common/Property.h"
+#include "common/TypeNode.h"
+#include "common/log.h"
+
+#include <Atlas/Objects/Anonymous.h>
+
+#include <chrono>
+#include <sstream>
+
+#include "stubs/common/stubLog.h"
+
+using Atlas::Message::Element;
+using Atlas::Objects::Entity::Anonymous;
+
+class PropertyBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const long s_entityCount = 1000000L;
+
+        TestPropertyManager * m_propertyManager;
+        TypeNode * m_type;
+        std::vector<Entity *> m_entities;
+
+    public:
+        PropertyBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_throughput();
+};
+
+PropertyBenchmark::PropertyBenchmark()
+{
+    ADD_TEST(PropertyBenchmark::test_throughput);
+}
+
+void PropertyBenchmark::setup()
+{
+    m_propertyManager = new TestPropertyManager;
+
+    m_type = new TypeNode("thing", Anonymous());
+    Property<double> * massProp = new Property<double>();
+    massProp->data() = 100;
+    massProp->setFlags(flag_class);
+    m_type->injectProperty("mass", massProp);
+    Property<std::string> * statusProp = new Property<std::string>();
+    statusProp->setFlags(flag_class);
+    m_type->injectProperty("status", statusProp);
+    m_type->injectProperty("test_class_attr", new SoftProperty(1));
+}
+
+void PropertyBenchmark::teardown()
+{
+    for (Entity * entity : m_entities) {
+        delete entity;
+    }
+    m_entities.clear();
+    delete m_type;
+    delete m_propertyManager;
+}
+
+void PropertyBenchmark::test_throughput()
+{
+    long baseline = residentBytes();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    m_entities.reserve(s_entityCount);
+    for (long i = 0; i < s_entityCount; ++i) {
+        Entity * entity = new Entity(std::to_string(i + 1), i + 1);
+        entity->setType(m_type);
+        m_entities.push_back(entity);
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::stringstream ss;
+    ss << "Created " << s_entityCount << " entities in " << milliseconds << " ms";
+    log(INFO, ss.str());
+
+    // Every entity gets two instance properties of its own.
+    start = std::chrono::high_resolution_clock::now();
+    for (Entity * entity : m_entities) {
+        entity->setAttr("test_instance_attr", Element(1));
+        entity->setAttr("speed", Element(2.0));
+    }
+    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ss = std::stringstream();
+    ss << "setAttr: " << (milliseconds * 1000000.) / (2. * s_entityCount) << " ns per call";
+    log(INFO, ss.str());
+
+    ss = std::stringstream();
+    ss << "Memory per entity: " << (residentBytes() - baseline) / s_entityCount << " bytes";
+    log(INFO, ss.str());
+
+    // Lookups hit the instance, the class defaults, and miss entirely.
+    long found = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (Entity * entity : m_entities) {
+        found += entity->getProperty("speed") != nullptr;
+        found += entity->getProperty("mass") != nullptr;
+        found += entity->getProperty("test_missing_attr") != nullptr;
+    }
+    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(found, 2 * s_entityCount);
+    ss = std::stringstream();
+    ss << "getProperty: " << (milliseconds * 1000000.) / (3. * s_entityCount) << " ns per call";
+    log(INFO, ss.str());
+
+    // Reading never copies the class defaults.
+    int copies = Entity::propertyDefaultCopies();
+    ss = std::stringstream();
+    ss << "Class default copies after reads: " << copies;
+    log(INFO, ss.str());
+
+    // The first modProperty copies the class default into the instance,
+    // the second finds the instance copy.
+    start = std::chrono::high_resolution_clock::now();
+    for (Entity * entity : m_entities) {
+        entity->modProperty("test_class_attr");
+        entity->modProperty("test_class_attr");
+    }
+    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ss = std::stringstream();
+    ss << "modProperty: " << (milliseconds * 1000000.) / (2. * s_entityCount) << " ns per call";
+    log(INFO, ss.str());
+
+    ASSERT_EQUAL(Entity::propertyDefaultCopies() - copies, s_entityCount);
+
+    ss = std::stringstream();
+    ss << "Memory per entity after modProperty: " << (residentBytes() - baseline) / s_entityCount << " bytes";
+    log(INFO, ss.str());
+}
+
+void TestWorld::message(const Operation& op, LocatedEntity& ent)
+{
+}
+
+LocatedEntity* TestWorld::addNewEntity(const std::string&,
+                                       const Atlas::Objects::Entity::RootEntity&)
+{
+    return 0;
+}
+
+int main()
+{
+    PropertyBenchmark t;
+
+    return t.run();
+}
@@ -0,0 +1,113 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "common/PropertyDict.h"
+
+#include <cassert>
+
+int main()
+{
+    // Well known names have fixed ids.
+    assert(PropertyKey::find("id").id() == PropertyKey::key_id);
+    assert(PropertyKey::find("mass").id() == PropertyKey::key_mass);
+    assert(PropertyKey::find("visibility").id() == PropertyKey::key_visibility);
+    assert(PropertyKey::count() == PropertyKey::key_well_known_count);
+
+    // Finding an unknown name does not intern it.
+    assert(!PropertyKey::find("test_unknown").isValid());
+    assert(PropertyKey::count() == PropertyKey::key_well_known_count);
+
+    PropertyKey fooKey = PropertyKey::intern("test_foo");
+    assert(fooKey.isValid());
+    assert(fooKey.id() == PropertyKey::key_well_known_count);
+    assert(fooKey.name() == "test_foo");
+    assert(PropertyKey::intern("test_foo") == fooKey);
+    assert(PropertyKey::find("test_foo") == fooKey);
+
+    PropertyBase * p1 = reinterpret_cast<PropertyBase *>(0x100);
+    PropertyBase * p2 = reinterpret_cast<PropertyBase *>(0x200);
+    PropertyBase * p3 = reinterpret_cast<PropertyBase *>(0x300);
+    PropertyBase * p4 = reinterpret_cast<PropertyBase *>(0x400);
+
+    PropertyDict dict;
+    assert(dict.empty());
+    assert(dict.find("mass") == dict.end());
+    assert(dict.find("test_unknown") == dict.end());
+
+    dict["test_foo"] = p1;
+    dict["mass"] = p2;
+    assert(dict.emplace("id", p3).second);
+    assert(!dict.emplace("id", p1).second);
+    assert(dict.insert(std::make_pair(std::string("test_bar"), p4)).second);
+    assert(dict.size() == 4);
+
+    // Entries are held in name order, whatever order the keys were
+    // interned in, as entities are sent and stored in that order.
+    PropertyKey barKey = PropertyKey::find("test_bar");
+    assert(fooKey < barKey);
+    auto I = dict.begin();
+    assert(I->first == "id" && I->second == p3);
+    ++I;
+    assert(I->first == "mass" && I->second == p2);
+    ++I;
+    assert(I->first == barKey && I->second == p4);
+    ++I;
+    assert(I->first == fooKey && I->second == p1);
+    ++I;
+    assert(I == dict.end());
+
+    // Entries hold the key, which stands in for the name.
+    const std::string & name = dict.find(barKey)->first;
+    assert(&name == &barKey.name());
+    assert("test_bar" == dict.find(barKey)->first);
+    assert(dict.find(barKey)->first != "test_foo");
+
+    assert(dict.find(fooKey)->second == p1);
+    assert(dict.find(PropertyKey(PropertyKey::key_mass))->second == p2);
+    assert(dict.count("mass") == 1);
+    assert(dict.count("bbox") == 0);
+
+    // Erasing returns the following entry, and the rest can still be found.
+    I = dict.erase(dict.find("mass"));
+    assert(I->first == "test_bar");
+    assert(dict.erase("mass") == 0);
+    assert(dict.find(fooKey)->second == p1);
+    assert(dict.find(barKey)->second == p4);
+    assert(dict.erase("id") == 1);
+    assert(dict.size() == 2);
+    assert(dict.find("test_bar")->second == p4);
+
+    // Adding in front of other entries keeps them reachable.
+    dict["bbox"] = p2;
+    assert(dict.begin()->first == "bbox");
+    assert(dict.find(fooKey)->second == p1);
+    assert(dict.find(barKey)->second == p4);
+    assert(dict.find(PropertyKey(PropertyKey::key_bbox))->second == p2);
+
+    dict.clear();
+    assert(dict.empty());
+
+    return 0;
+}
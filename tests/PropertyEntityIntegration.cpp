@@ -32,6 +32,8 @@
 #include "common/PropertyManager.h"
 #include "common/TypeNode.h"
 
+#include <Atlas/Objects/Operation.h>
+
 #include <cstdlib>
 
 #include <cassert>
@@ -39,6 +41,8 @@
 using Atlas::Message::Element;
 using Atlas::Message::MapType;
 using Atlas::Message::ListType;
+using Atlas::Objects::Operation::Touch;
+using Atlas::Objects::Operation::TOUCH_NO;
 
 // If tests fail, and print out the message below, you'll have to actually
 // implement this function to find out the details.
@@ -136,6 +140,36 @@ PropertyBase * TestPropertyManager::addProperty(const std::string & name,
     }
 }
 
+/// \brief Property which counts the Touch operations delegated to it
+class DelegateProperty : public Property<long>
+{
+  public:
+    int m_calls = 0;
+
+    void install(LocatedEntity * owner, const std::string & name) override
+    {
+        owner->installDelegate(TOUCH_NO, name);
+    }
+
+    void install(TypeNode * type, const std::string & name) override
+    {
+        type->addDelegate(TOUCH_NO, name, this);
+    }
+
+    HandlerResult operation(LocatedEntity *,
+                            const Operation &,
+                            OpVector &) override
+    {
+        ++m_calls;
+        return OPERATION_HANDLED;
+    }
+
+    DelegateProperty * copy() const override
+    {
+        return new DelegateProperty(*this);
+    }
+};
+
 class PropertyEntityintegration : public Cyphesis::TestBase
 {
   private:
@@ -158,6 +192,8 @@ class PropertyEntityintegration : public Cyphesis::TestBase
 
     template<class T>
     void test_modPropertyClass();
+
+    void test_delegates();
 };
 
 template<class T>
@@ -220,6 +256,45 @@ void PropertyEntityintegration::test_modPropertyClass()
     ASSERT_EQUAL(p->data(), test_values<T>::initial_value);
 }
 
+void PropertyEntityintegration::test_delegates()
+{
+    Entity * other = new Entity("2", 2L);
+    other->setType(m_type);
+    OpVector res;
+
+    // A delegate installed on one entity doesn't apply to the others of
+    // its type.
+    DelegateProperty * instance = new DelegateProperty;
+    m_entity->setProperty("test_instance_delegate", instance);
+    instance->install(m_entity, "test_instance_delegate");
+    ASSERT_FALSE(m_type->hasDelegate(TOUCH_NO, PropertyKey::find("test_instance_delegate")));
+    m_entity->operation(Touch(), res);
+    other->operation(Touch(), res);
+    ASSERT_EQUAL(instance->m_calls, 1);
+
+    // A class property installed on the type is delegated to once for
+    // each entity of the type.
+    DelegateProperty * cls = new DelegateProperty;
+    cls->setFlags(flag_class);
+    m_type->injectProperty("test_class_delegate", cls);
+    cls->install(m_type, "test_class_delegate");
+    ASSERT_TRUE(m_type->hasDelegate(TOUCH_NO, PropertyKey::find("test_class_delegate")));
+    cls->install(m_entity, "test_class_delegate");
+    cls->install(other, "test_class_delegate");
+    m_entity->operation(Touch(), res);
+    other->operation(Touch(), res);
+    ASSERT_EQUAL(cls->m_calls, 2);
+    ASSERT_EQUAL(instance->m_calls, 2);
+
+    // Removing it from one entity leaves it with the others.
+    other->removeDelegate(TOUCH_NO, "test_class_delegate");
+    other->operation(Touch(), res);
+    m_entity->operation(Touch(), res);
+    ASSERT_EQUAL(cls->m_calls, 3);
+
+    delete other;
+}
+
 PropertyEntityintegration::PropertyEntityintegration()
 {
     ADD_TEST(PropertyEntityintegration::test_requirePropertyClass<long>);
@@ -241,6 +316,8 @@ PropertyEntityintegration::PropertyEntityintegration()
     ADD_TEST(PropertyEntityintegration::test_modPropertyClass<double>);
     ADD_TEST(PropertyEntityintegration::test_modPropertyClass<std::string>);
     ADD_TEST(PropertyEntityintegration::test_modPropertyClass<MapType>);
+
+    ADD_TEST(PropertyEntityintegration::test_delegates);
 }
 
 void PropertyEntityintegration::setup()
@@ -378,10 +455,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 void Location::addToMessage(MapType & omap) const
 {
 }
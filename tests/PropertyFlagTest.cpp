@@ -89,6 +89,8 @@ int main(int argc, char ** argv)
 
 // stubs
 
+#include "stubs/common/stubTypeNode.h"
+
 void TestWorld::message(const Operation & op, LocatedEntity & ent)
 {
 }
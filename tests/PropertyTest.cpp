@@ -179,4 +179,25 @@ int main()
     exerciseProperty(pb);
     delete pb;
     }
+
+    {
+    // Classes with their own tag are cast without RTTI.
+    PropertyBase * pb = new Property<double>;
+    assert(pb->typeId() == propertyTypeId<Property<double>>());
+    assert(property_cast<Property<double>>(pb) == pb);
+    assert(property_cast<Property<int>>(pb) == nullptr);
+    assert(property_cast<SoftProperty>(pb) == nullptr);
+    delete pb;
+    }
+
+    {
+    // Classes without their own tag fall back to dynamic_cast.
+    PropertyBase * pb = new MinimalProperty;
+    assert(pb->typeId() == propertyTypeId<PropertyBase>());
+    assert(property_cast<MinimalProperty>(pb) == pb);
+    assert(property_cast<Property<int>>(pb) == nullptr);
+    const PropertyBase * cpb = pb;
+    assert(property_cast<MinimalProperty>(cpb) == pb);
+    delete pb;
+    }
 }
@@ -43,6 +43,12 @@ int main()
     run_python_string("assert(f.match_entity(le1))");
     run_python_string("assert(not f.match_entity(le2))");
 
+    //The same query again is served from the cache
+    int hits = filter_cache().hits;
+    run_python_string("f2 = entity_filter.get_filter('entity.id=1')");
+    assert(filter_cache().hits == hits + 1);
+    run_python_string("assert(f2.match_entity(le1))");
+
     shutdown_python_api();
     return 0;
 }
@@ -56,6 +56,16 @@ static PyObject * null_wrapper(PyObject * self, PyLocation * o)
     return Py_None;
 }
 
+/// \brief Get the reference count of the entity in a script variable
+static int entity_refs(const char * name)
+{
+    PyObject * main = PyModule_GetDict(PyImport_AddModule("__main__"));
+    PyObject * o = PyDict_GetItemString(main, name);
+    assert(o != nullptr);
+    assert(PyLocatedEntity_Check(o));
+    return ((PyEntity*)o)->m_entity.l->checkRef();
+}
+
 static PyMethodDef sabotage_methods[] = {
     {"null", (PyCFunction)null_wrapper,                 METH_O},
     {nullptr,          nullptr}                       /* Sentinel */
@@ -127,6 +137,27 @@ int main()
     run_python_string("atlas.Location(common_parent, Point3D(0,0,0)) - atlas.Location(common_parent, Point3D(1,0,0))");
     expect_python_error("atlas.Location(common_parent, Point3D(0,0,0)) - Point3D(1,0,0)", PyExc_TypeError);
 
+    // Locations held by scripts keep the entity they refer to alive.
+    run_python_string("ref_ent = server.Thing('1')");
+    int refs = entity_refs("ref_ent");
+    run_python_string("ref_loc = atlas.Location(ref_ent)");
+    assert(entity_refs("ref_ent") == refs + 1);
+    run_python_string("ref_copy = ref_loc.copy()");
+    assert(entity_refs("ref_ent") == refs + 2);
+    run_python_string("del ref_copy");
+    assert(entity_refs("ref_ent") == refs + 1);
+    run_python_string("ref_loc.parent = server.Thing('2')");
+    assert(entity_refs("ref_ent") == refs);
+    run_python_string("ref_loc.parent = ref_ent");
+    assert(entity_refs("ref_ent") == refs + 1);
+    run_python_string("del ref_loc");
+    assert(entity_refs("ref_ent") == refs);
+    // The location of an entity keeps the entity itself alive.
+    run_python_string("ref_own = ref_ent.location");
+    assert(entity_refs("ref_ent") == refs + 1);
+    run_python_string("del ref_own");
+    assert(entity_refs("ref_ent") == refs);
+
 #ifdef CYPHESIS_DEBUG
     run_python_string("import sabotage");
     // Hit the assert checks.
@@ -98,6 +98,8 @@ int main()
     expect_python_error("m.add(Entity('1', type='oak'))", PyExc_TypeError);
     run_python_string("m.add(Entity('1', type='thing'), 1.1)");
     run_python_string("m.find_by_type('thing')");
+    run_python_string("m.find_by_type('thing', 1)");
+    expect_python_error("m.find_by_type('thing', 'foo')", PyExc_TypeError);
     expect_python_error("m.get()", PyExc_TypeError);
     expect_python_error("m.get(1)", PyExc_TypeError);
     run_python_string("m.get('1')");
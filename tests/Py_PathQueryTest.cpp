@@ -0,0 +1,100 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include <Python.h>
+
+#include "python_testers.h"
+
+#include "navigation/Awareness.h"
+#include "navigation/IHeightProvider.h"
+#include "navigation/Steering.h"
+#include "rulesets/MemEntity.h"
+#include "rulesets/Python_API.h"
+#include "rulesets/Py_Thing.h"
+#include "rulesets/mind/AwareMind.h"
+#include "rulesets/mind/AwarenessStoreProvider.h"
+#include "rulesets/mind/SharedTerrain.h"
+
+#include <algorithm>
+#include <cassert>
+
+class FlatHeightProvider : public IHeightProvider
+{
+    public:
+        void blitHeights(int xMin, int xMax, int yMin, int yMax, std::vector<float>& heights) const override
+        {
+            std::fill(heights.begin(), heights.end(), 0.f);
+        }
+};
+
+class TestAwareness : public Awareness
+{
+    public:
+        using Awareness::Awareness;
+        using Awareness::rebuildTile;
+};
+
+int main()
+{
+    init_python_api("8d3c1f5e-7b2a-4c61-9e0d-2f4a6b8c1d3e");
+
+    SharedTerrain sharedTerrain;
+    AwarenessStoreProvider awarenessStoreProvider(sharedTerrain);
+    AwareMind * mind = new AwareMind("1", 1, sharedTerrain, awarenessStoreProvider);
+    mind->m_location.m_pos = WFMath::Point<3>(2, 0, 2);
+
+    // A single built tile is enough for the searches to find a path.
+    MemEntity domain("2", 2);
+    FlatHeightProvider heightProvider;
+    TestAwareness awareness(domain, 0.4f, 2.f, heightProvider, WFMath::AxisBox<3>(WFMath::Point<3>(0, -50, 0), WFMath::Point<3>(64, 50, 64)));
+    awareness.rebuildTile(0, 0);
+    mind->getSteering().setAwareness(&awareness);
+    mind->getSteering().setDestination(2, WFMath::Point<3>(10, 0, 10), 1, 0);
+
+    PyObject * wrapper = wrapEntity(mind);
+    assert(wrapper != nullptr);
+    PyObject * main_module = PyImport_AddModule("__main__");
+    assert(main_module != nullptr);
+    PyObject_SetAttrString(main_module, "mind", wrapper);
+    Py_DECREF(wrapper);
+
+    // Path queries release the GIL while searching, so hammer them from
+    // several Python threads at once to make sure it's always reacquired.
+    run_python_string("import threading");
+    run_python_string("results = []");
+    run_python_string("def refresh(count):\n"
+                      " for i in xrange(count):\n"
+                      "  results.append(mind.refreshPath())\n");
+    run_python_string("threads = [threading.Thread(target=refresh, args=(1000,)) for i in range(8)]");
+    run_python_string("for t in threads: t.start()");
+    run_python_string("for t in threads: t.join()");
+    run_python_string("assert len(results) == 8000");
+    run_python_string("assert all(type(r) is int for r in results)");
+    // A positive result is the number of points in the path found.
+    run_python_string("assert all(r > 0 for r in results)");
+
+    shutdown_python_api();
+    return 0;
+}
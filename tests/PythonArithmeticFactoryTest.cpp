@@ -153,6 +153,7 @@ PyObject * wrapEntity(LocatedEntity * le)
 #include "stubs/rulesets/stubScript.h"
 #include "stubs/modules/stubLocation.h"
 #include "stubs/rulesets/stubEntity.h"
+#include "stubs/rulesets/stubPythonOperationHandlers.h"
 
 
 #define STUB_LocatedEntity_makeContainer
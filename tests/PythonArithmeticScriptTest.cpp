@@ -115,6 +115,11 @@ PyObject * Get_PyClass(PyObject * module,
     return py_class;
 }
 
+std::string Get_PyTypeName(PyObject * o)
+{
+    return Py_TYPE(o)->tp_name;
+}
+
 ArithmeticScript::~ArithmeticScript()
 {
 }
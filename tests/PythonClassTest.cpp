@@ -172,3 +172,5 @@ struct _object * Get_PyModule(const std::string & package)
     }
     return 0;
 }
+
+#include "stubs/rulesets/stubPythonOperationHandlers.h"
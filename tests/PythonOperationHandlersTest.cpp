@@ -0,0 +1,169 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include <Python.h>
+
+#include "python_testers.h"
+
+#include "rulesets/PythonOperationHandlers.h"
+
+#include <cassert>
+
+class TestPythonOperationHandlers : public PythonOperationHandlers {
+  public:
+    using PythonOperationHandlers::PythonOperationHandlers;
+    using PythonOperationHandlers::m_handlers;
+};
+
+static PyMethodDef no_methods[] = {
+    {nullptr,          nullptr}                       /* Sentinel */
+};
+
+int main()
+{
+    Py_Initialize();
+
+    PyObject * testmod = Py_InitModule("testmod", no_methods);
+    assert(testmod != 0);
+
+    run_python_string("import testmod");
+    run_python_string("class BaseClass(object):\n"
+                      " def move_operation(self, op): pass\n");
+    run_python_string("class TestClass(BaseClass):\n"
+                      " tick_operation = 1\n"
+                      " def look_operation(self, op): pass\n"
+                      " def look_hook(self, ent): pass\n");
+    run_python_string("class GetattrClass(BaseClass):\n"
+                      " def __getattr__(self, name):\n"
+                      "  if name == 'talk_operation': return self.move_operation\n"
+                      "  raise AttributeError, name\n");
+    run_python_string("testmod.TestClass=TestClass");
+    run_python_string("testmod.GetattrClass=GetattrClass");
+    run_python_string("testmod.instance=TestClass()");
+    run_python_string("testmod.instance.talk_operation=lambda op: None");
+    run_python_string("testmod.instance.sight_operation=1");
+    run_python_string("testmod.getattr_instance=GetattrClass()");
+
+    PyObject * test_class = PyObject_GetAttrString(testmod, "TestClass");
+    assert(test_class != 0);
+
+    {
+        PythonOperationHandlers handlers(test_class);
+
+        // Inherited methods are found, attributes which can't be called
+        // and other methods are not.
+        assert(handlers.size() == 2);
+
+        int * calls = nullptr;
+        PyObject * look = handlers.handler(1, "look", calls);
+        assert(look != nullptr);
+        assert(calls != nullptr);
+        assert(*calls == 0);
+
+        // Resolved once, then found by class number.
+        int * again = nullptr;
+        assert(handlers.handler(1, "look", again) == look);
+        assert(again == calls);
+
+        calls = nullptr;
+        assert(handlers.handler(2, "move", calls) != nullptr);
+        assert(calls != nullptr);
+
+        calls = nullptr;
+        assert(handlers.handler(3, "tick", calls) == nullptr);
+        assert(handlers.handler(4, "talk", calls) == nullptr);
+
+        // An operation sharing the class number of another is looked up
+        // by name.
+        assert(handlers.handler(1, "move", calls) != nullptr);
+        assert(handlers.handler(1, "sight", calls) == nullptr);
+        assert(handlers.handler(-1, "look", calls) == look);
+    }
+
+    {
+        // Minds call the script under several names for each operation;
+        // each name is resolved once for the class number.
+        TestPythonOperationHandlers handlers(test_class);
+        int * calls = nullptr;
+        PyObject * look = handlers.handler(1, "look", calls);
+        assert(handlers.handler(1, "call_triggers", calls) == nullptr);
+        assert(handlers.handler(1, "look", calls) == look);
+        assert(handlers.handler(1, "call_triggers", calls) == nullptr);
+        assert(handlers.m_handlers[1].size() == 2);
+    }
+
+    {
+        // Call counts are shared by all classes handling an operation.
+        int * calls1 = nullptr;
+        int * calls2 = nullptr;
+        PythonOperationHandlers handlers1(test_class);
+        PythonOperationHandlers handlers2(test_class);
+        handlers1.handler(1, "look", calls1);
+        handlers2.handler(5, "look", calls2);
+        assert(calls1 != nullptr);
+        assert(calls1 == calls2);
+    }
+
+    {
+        // Handlers set on an instance aren't in the table of the class,
+        // but are found in the instance.
+        PythonOperationHandlers handlers(test_class);
+        PyObject * instance = PyObject_GetAttrString(testmod, "instance");
+        assert(instance != 0);
+        int * calls = nullptr;
+        assert(handlers.handler(4, "talk", calls) == nullptr);
+        assert(handlers.instanceHandles(instance, "talk"));
+        assert(!handlers.instanceHandles(instance, "sight"));
+        assert(!handlers.instanceHandles(instance, "tick"));
+        assert(!handlers.instanceHandles(test_class, "talk"));
+        Py_DECREF(instance);
+    }
+
+    {
+        // Handlers provided through __getattr__ are looked up.
+        PyObject * getattr_class = PyObject_GetAttrString(testmod, "GetattrClass");
+        assert(getattr_class != 0);
+        PyObject * instance = PyObject_GetAttrString(testmod, "getattr_instance");
+        assert(instance != 0);
+        PythonOperationHandlers handlers(getattr_class);
+        assert(handlers.size() == 1);
+        int * calls = nullptr;
+        assert(handlers.handler(4, "talk", calls) == nullptr);
+        assert(handlers.instanceHandles(instance, "talk"));
+        assert(!handlers.instanceHandles(instance, "look"));
+        assert(PyErr_Occurred() == nullptr);
+        Py_DECREF(instance);
+        Py_DECREF(getattr_class);
+    }
+
+    Py_DECREF(test_class);
+
+    return 0;
+}
+
+// stubs
+
+#include "stubs/common/stubMonitors.h"
+#include "stubs/common/stubVariable.h"
@@ -0,0 +1,82 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include <Python.h>
+
+#include "python_testers.h"
+
+#include "rulesets/Python_API.h"
+#include "rulesets/Py_FreeList.h"
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+
+static const int iterations = 200000;
+
+int main()
+{
+    init_python_api("5a0e3b1c-2c55-4f0e-9a43-7d8c0f7c1e2a");
+
+    run_python_string("from atlas import Operation, Oplist, Location");
+    run_python_string("from physics import Vector3D, Point3D");
+    run_python_string("import gc");
+    // Roughly what a mind does when it reacts to a sight: look at the
+    // operation, work out a position and a direction, and reply.
+    run_python_string("def think(count):\n"
+                      " origin = Point3D(0, 0, 0)\n"
+                      " for i in xrange(count):\n"
+                      "  op = Operation('sight')\n"
+                      "  pos = Point3D(i, 1, 2)\n"
+                      "  direction = pos - origin\n"
+                      "  loc = Location()\n"
+                      "  loc.velocity = Vector3D(1, 0, 0)\n"
+                      "  res = Oplist(op, Operation('move'))\n");
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::string call = "think(" + std::to_string(iterations) + ")";
+    run_python_string(call.c_str());
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "Mind think loop: " << (milliseconds * 1000000.) / iterations
+              << " ns per iteration" << std::endl;
+
+    int allocations = 0;
+    int reuses = 0;
+    for (PyFreeListBase * free_list : PyFreeListBase::registry()) {
+        std::cout << free_list->name() << ": "
+                  << free_list->allocations << " allocations, "
+                  << free_list->reuses << " reuses" << std::endl;
+        // Every wrapper type is used in the loop, so every list must be reused.
+        assert(free_list->reuses > 0);
+        allocations += free_list->allocations;
+        reuses += free_list->reuses;
+    }
+    // Nearly every wrapper should come from the free lists.
+    assert(reuses > allocations * 100);
+
+    shutdown_python_api();
+    return 0;
+}
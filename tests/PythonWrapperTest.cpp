@@ -34,6 +34,19 @@ int main()
     Py_Initialize();
 
     PythonWrapper * pw = new PythonWrapper(PyInt_FromLong(1L));
+    // Wrappers come from the pool
+    assert(PythonWrapper::pools().stats().inUse == 1);
+    delete pw;
+    assert(PythonWrapper::pools().stats().inUse == 0);
+
+    PyObject * o = PyList_New(0);
+    pw = new PythonWrapper(o);
+    // The wrapper holds the only reference
+    assert(!pw->isReferenced());
+    Py_INCREF(o);
+    assert(pw->isReferenced());
+    Py_DECREF(o);
+    assert(!pw->isReferenced());
     delete pw;
 
     Py_Finalize();
@@ -59,10 +72,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 void log(LogLevel lvl, const std::string & msg)
 {
 }
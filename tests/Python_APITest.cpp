@@ -95,6 +95,14 @@ int main()
     run_python_string("import atlas");
 
     run_python_string("l=atlas.Location()");
+    // Script classes are named with their module, as types already are.
+    run_python_string("class TypeNameTest(object): pass");
+    run_python_string("type_name_test=TypeNameTest()");
+    PyObject * main_dict = PyModule_GetDict(PyImport_AddModule("__main__"));
+    assert(Get_PyTypeName(PyDict_GetItemString(main_dict, "l")) ==
+           "atlas.Location");
+    assert(Get_PyTypeName(PyDict_GetItemString(main_dict, "type_name_test")) ==
+           "__main__.TypeNameTest");
     run_python_string("atlas.isLocation(l)");
     run_python_string("atlas.isLocation(1)");
     run_python_string("l1=atlas.Location()");
@@ -560,6 +560,10 @@ void Inheritance::flush()
 {
 }
 
+void Inheritance::renumber()
+{
+}
+
 void Inheritance::clear()
 {
     if (m_instance != nullptr) {
@@ -0,0 +1,133 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "common/ScriptProfiler.h"
+
+#include <sstream>
+
+class ScriptProfilertest : public Cyphesis::TestBase
+{
+  public:
+    ScriptProfilertest();
+
+    void setup();
+    void teardown();
+
+    void test_disabled();
+    void test_scope();
+    void test_record();
+    void test_report();
+};
+
+ScriptProfilertest::ScriptProfilertest()
+{
+    ADD_TEST(ScriptProfilertest::test_disabled);
+    ADD_TEST(ScriptProfilertest::test_scope);
+    ADD_TEST(ScriptProfilertest::test_record);
+    ADD_TEST(ScriptProfilertest::test_report);
+}
+
+void ScriptProfilertest::setup()
+{
+}
+
+void ScriptProfilertest::teardown()
+{
+    ScriptProfiler::cleanup();
+}
+
+void ScriptProfilertest::test_disabled()
+{
+    ASSERT_FALSE(ScriptProfiler::enabled());
+    std::string type("Thing"), handler("tick");
+    {
+        ScriptProfiler::Scope profile(type, handler);
+        // Enabling during a call doesn't record it, as the start is unknown.
+        ScriptProfiler::instance()->setEnabled(true);
+    }
+    ASSERT_TRUE(ScriptProfiler::instance()->entries().empty());
+}
+
+void ScriptProfilertest::test_scope()
+{
+    long objects = 0;
+    ScriptProfiler * profiler = ScriptProfiler::instance();
+    profiler->setObjectCounter([&]() { return objects; });
+    profiler->setEnabled(true);
+    ASSERT_TRUE(ScriptProfiler::enabled());
+
+    std::string type("Thing"), handler("tick");
+    {
+        ScriptProfiler::Scope profile(type, handler);
+        objects += 3;
+    }
+    {
+        ScriptProfiler::Scope profile(type, handler);
+    }
+
+    auto I = profiler->entries().find(std::make_pair(type, handler));
+    ASSERT_TRUE(I != profiler->entries().end());
+    ASSERT_EQUAL(I->second.calls, 2);
+    ASSERT_EQUAL(I->second.objects, 3);
+    ASSERT_EQUAL(I->second.samples.size(), 2u);
+}
+
+void ScriptProfilertest::test_record()
+{
+    ScriptProfiler * profiler = ScriptProfiler::instance();
+    for (std::size_t i = 0; i < ScriptProfiler::sample_count + 10; ++i) {
+        profiler->record("Thing", "tick", 0.001, -1);
+    }
+    const ScriptProfiler::Entry & entry = profiler->entries().begin()->second;
+    ASSERT_EQUAL(entry.calls, (long)ScriptProfiler::sample_count + 10);
+    ASSERT_EQUAL(entry.samples.size(), ScriptProfiler::sample_count);
+    // Collections during a call are not counted as negative allocations.
+    ASSERT_EQUAL(entry.objects, 0);
+
+    profiler->reset();
+    ASSERT_TRUE(profiler->entries().empty());
+}
+
+void ScriptProfilertest::test_report()
+{
+    ScriptProfiler * profiler = ScriptProfiler::instance();
+    profiler->record("Thing", "tick", 0.001, 0);
+    profiler->record("Plant", "tick", 0.5, 0);
+
+    std::stringstream ss;
+    profiler->report(ss);
+    std::string report = ss.str();
+    // The most expensive handler comes first.
+    ASSERT_TRUE(report.find("Plant tick") < report.find("Thing tick"));
+}
+
+int main()
+{
+    ScriptProfilertest t;
+
+    return t.run();
+}
@@ -0,0 +1,171 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "rulesets/mind/SharedTerrain.h"
+
+#include <Mercator/Segment.h>
+
+#include <cmath>
+
+class SharedTerrainTest : public Cyphesis::TestBase
+{
+    protected:
+        SharedTerrain* m_terrain;
+        std::vector<SharedTerrain::BasePointDefinition> m_points;
+
+        void checkHeights(int xMin, int xMax, int yMin, int yMax);
+
+    public:
+        SharedTerrainTest();
+
+        void setup();
+
+        void teardown();
+
+        void test_blit();
+
+        void test_cache();
+
+        void test_invalidate();
+};
+
+SharedTerrainTest::SharedTerrainTest()
+{
+    ADD_TEST(SharedTerrainTest::test_blit);
+    ADD_TEST(SharedTerrainTest::test_cache);
+    ADD_TEST(SharedTerrainTest::test_invalidate);
+}
+
+void SharedTerrainTest::setup()
+{
+    m_terrain = new SharedTerrain();
+    m_points.clear();
+    for (int x = 0; x <= 2; ++x) {
+        for (int y = 0; y <= 2; ++y) {
+            m_points.push_back(SharedTerrain::BasePointDefinition { x, y, Mercator::BasePoint(x * 10 + y) });
+        }
+    }
+    ASSERT_EQUAL(m_terrain->setBasePoints(m_points).size(), m_points.size());
+}
+
+void SharedTerrainTest::teardown()
+{
+    delete m_terrain;
+}
+
+/**
+ * Compares a blit with the heights of a terrain made from the same points.
+ */
+void SharedTerrainTest::checkHeights(int xMin, int xMax, int yMin, int yMax)
+{
+    Mercator::Terrain reference;
+    for (auto& point : m_points) {
+        reference.setBasePoint(point.x, point.y, point.basePoint);
+    }
+    int res = reference.getResolution();
+
+    std::vector<float> heights((xMax - xMin) * (yMax - yMin));
+    m_terrain->blitHeights(xMin, xMax, yMin, yMax, heights);
+
+    for (int y = yMin; y < yMax; ++y) {
+        for (int x = xMin; x < xMax; ++x) {
+            int segmentX = (int)std::floor(x / (double)res);
+            int segmentY = (int)std::floor(y / (double)res);
+            float expected = -10;
+            Mercator::Segment* segment = reference.getSegmentAtIndex(segmentX, segmentY);
+            if (segment) {
+                if (!segment->isValid()) {
+                    segment->populate();
+                }
+                expected = segment->get(x - segmentX * res, y - segmentY * res);
+            }
+            ASSERT_EQUAL(heights[(y - yMin) * (xMax - xMin) + (x - xMin)], expected);
+        }
+    }
+}
+
+void SharedTerrainTest::test_blit()
+{
+    //Covers all four segments, as well as the area outside of them.
+    checkHeights(-5, 140, 10, 100);
+    checkHeights(60, 70, -20, 130);
+}
+
+void SharedTerrainTest::test_cache()
+{
+    int populated = SharedTerrain::s_heightStatistics.segmentsPopulated;
+    int blits = SharedTerrain::s_heightStatistics.blits;
+    std::vector<float> heights(20 * 20);
+
+    m_terrain->blitHeights(50, 70, 50, 70, heights);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 4);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.blits - blits, 1);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.blitBytes, (int)(20 * 20 * sizeof(float)));
+
+    //A neighbouring tile uses the same segments.
+    m_terrain->blitHeights(60, 80, 60, 80, heights);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 4);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.blits - blits, 2);
+
+    //Samples without a segment aren't copied.
+    m_terrain->blitHeights(120, 140, 0, 20, heights);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.blitBytes, (int)(8 * 20 * sizeof(float)));
+    ASSERT_EQUAL(heights[19], -10.f);
+
+    checkHeights(0, 128, 0, 128);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 4);
+}
+
+void SharedTerrainTest::test_invalidate()
+{
+    checkHeights(0, 128, 0, 128);
+    int populated = SharedTerrain::s_heightStatistics.segmentsPopulated;
+
+    //Setting the same points again changes nothing.
+    ASSERT_TRUE(m_terrain->setBasePoints(m_points).empty());
+    checkHeights(0, 128, 0, 128);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 0);
+
+    //The center point is a corner of all four segments.
+    m_points[4].basePoint = Mercator::BasePoint(50);
+    ASSERT_EQUAL(m_terrain->setBasePoints({m_points[4]}).size(), 1u);
+    checkHeights(0, 128, 0, 128);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 4);
+
+    //A point in the corner only touches one.
+    m_points[8].basePoint = Mercator::BasePoint(-5);
+    m_terrain->setBasePoints({m_points[8]});
+    checkHeights(0, 128, 0, 128);
+    ASSERT_EQUAL(SharedTerrain::s_heightStatistics.segmentsPopulated - populated, 5);
+}
+
+int main()
+{
+    SharedTerrainTest t;
+
+    return t.run();
+}
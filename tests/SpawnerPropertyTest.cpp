@@ -54,6 +54,8 @@ LocatedEntity * TestWorld::addNewEntity(const std::string &,
 
 // stubs
 
+#include "stubs/common/stubTypeNode.h"
+
 Inheritance& Inheritance::instance() {
     return *(Inheritance*)(nullptr);
 }
@@ -272,10 +272,20 @@ bool Script::operation(const std::string & opname,
    return false;
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 EntityRef::EntityRef(LocatedEntity* e) : m_inner(e)
 {
 }
@@ -336,6 +346,7 @@ template class Variable<std::string>;
 
 #include "stubs/common/stubMonitors.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 
 
 MindInspector::MindInspector() :
@@ -394,6 +405,11 @@ HandlerResult PropertyBase::operation(LocatedEntity *,
     return OPERATION_IGNORED;
 }
 
+PropertyTypeId PropertyBase::typeId() const
+{
+    return propertyTypeId<PropertyBase>();
+}
+
 template <typename T>
 Property<T>::Property(unsigned int flags) :
                       PropertyBase(flags)
@@ -430,6 +446,12 @@ Property<T> * Property<T>::copy() const
     return new Property<T>(*this);
 }
 
+template <typename T>
+PropertyTypeId Property<T>::typeId() const
+{
+    return propertyTypeId<Property<T>>();
+}
+
 
 template class Property<MapType>;
 
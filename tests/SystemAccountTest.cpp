@@ -167,7 +167,7 @@ LocatedEntity * Account::createCharacterEntity(const std::string &,
     return 0;
 }
 
-int Account::connectCharacter(LocatedEntity *chr)
+int Account::connectCharacter(LocatedEntity *chr, bool possessed)
 {
     return 0;
 }
@@ -0,0 +1,216 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+#include "TestWorld.h"
+#include "TestPropertyManager.h"
+
+#include "rulesets/Character.h"
+
+#include "common/OperationsDispatcher.h"
+#include "common/const.h"
+#include "common/Property.h"
+#include "common/SystemScheduler.h"
+#include "common/TypeNode.h"
+#include "common/log.h"
+
+#include <Atlas/Objects/Anonymous.h>
+#include <Atlas/Objects/Operation.h>
+
+#include <chrono>
+#include <sstream>
+
+#include "stubs/common/stubLog.h"
+
+using Atlas::Objects::Entity::Anonymous;
+using Atlas::Objects::Operation::Tick;
+
+/// \brief World which lets the benchmark attach a system scheduler
+class SchedulingTestWorld : public TestWorld {
+  public:
+    explicit SchedulingTestWorld(LocatedEntity & gw) : TestWorld(gw) { }
+
+    void setSystems(SystemScheduler * systems)
+    {
+        m_systems = systems;
+    }
+};
+
+class SystemSchedulerBenchmark : public Cyphesis::TestBase
+{
+    protected:
+        static const long s_characterCount = 100000L;
+        static const int s_rounds = 10;
+
+        TestPropertyManager * m_propertyManager;
+        TypeNode * m_type;
+        Entity * m_rootEntity;
+        SchedulingTestWorld * m_world;
+        std::vector<Character *> m_characters;
+        double m_time;
+        long m_results;
+
+    public:
+        SystemSchedulerBenchmark();
+
+        void setup();
+
+        void teardown();
+
+        void test_tickOperations();
+
+        void test_batchedSystem();
+};
+
+SystemSchedulerBenchmark::SystemSchedulerBenchmark()
+{
+    ADD_TEST(SystemSchedulerBenchmark::test_tickOperations);
+    ADD_TEST(SystemSchedulerBenchmark::test_batchedSystem);
+}
+
+void SystemSchedulerBenchmark::setup()
+{
+    m_time = 0;
+    m_results = 0;
+    m_propertyManager = new TestPropertyManager;
+    m_rootEntity = new Entity("0", 0);
+    m_world = new SchedulingTestWorld(*m_rootEntity);
+
+    m_type = new TypeNode("character", Anonymous());
+    Property<double> * massProp = new Property<double>();
+    massProp->data() = 60;
+    massProp->setFlags(flag_class);
+    m_type->injectProperty("mass", massProp);
+
+    m_characters.reserve(s_characterCount);
+    for (long i = 0; i < s_characterCount; ++i) {
+        Character * character = new Character(std::to_string(i + 1), i + 1);
+        character->setType(m_type);
+        m_world->addEntity(character);
+        m_characters.push_back(character);
+    }
+}
+
+void SystemSchedulerBenchmark::teardown()
+{
+    for (Character * character : m_characters) {
+        character->decRef();
+    }
+    m_characters.clear();
+    delete m_world;
+    delete m_type;
+    delete m_rootEntity;
+    delete m_propertyManager;
+}
+
+/// \brief Metabolise by sending every character a Tick operation, which
+/// reschedules itself through the operation queue
+void SystemSchedulerBenchmark::test_tickOperations()
+{
+    OperationsDispatcher dispatcher([&](const Operation & op, LocatedEntity & from) {
+        LocatedEntity * to = m_world->getEntity(op->getTo());
+        if (to == nullptr) {
+            return;
+        }
+        OpVector res;
+        to->operation(op, res);
+        for (auto & resOp : res) {
+            ++m_results;
+            if (resOp->getClassNo() == Atlas::Objects::Operation::TICK_NO) {
+                resOp->setTo(to->getId());
+                dispatcher.addOperationToQueue(resOp, *to);
+            }
+        }
+    }, [&]() { return m_time; });
+
+    for (Character * character : m_characters) {
+        Tick tick;
+        tick->setTo(character->getId());
+        dispatcher.addOperationToQueue(tick, *character);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        while (dispatcher.idle()) {
+        }
+        m_time += consts::basic_tick * 30;
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::stringstream ss;
+    ss << "Tick operations: " << (milliseconds * 1000000.) / (s_rounds * s_characterCount)
+       << " ns per character update, " << m_results << " resulting ops";
+    log(INFO, ss.str());
+    dispatcher.clearQueues();
+}
+
+/// \brief Metabolise through the batched system scheduler
+void SystemSchedulerBenchmark::test_batchedSystem()
+{
+    SystemScheduler systems([&](const Operation &, LocatedEntity &) {
+        ++m_results;
+    }, [&]() { return m_time; });
+    m_world->setSystems(&systems);
+
+    // The first Tick adds each character to the metabolism system.
+    for (Character * character : m_characters) {
+        Tick tick;
+        tick->setTo(character->getId());
+        OpVector res;
+        character->operation(tick, res);
+    }
+
+    std::size_t updated = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < s_rounds; ++round) {
+        m_time += consts::basic_tick * 30;
+        updated += systems.run();
+    }
+    long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    ASSERT_EQUAL(updated, (std::size_t)(s_rounds * s_characterCount));
+    std::stringstream ss;
+    ss << "Batched system: " << (milliseconds * 1000000.) / (s_rounds * s_characterCount)
+       << " ns per character update, " << m_results << " resulting ops";
+    log(INFO, ss.str());
+
+    systems.clear();
+    m_world->setSystems(nullptr);
+}
+
+void TestWorld::message(const Operation& op, LocatedEntity& ent)
+{
+}
+
+LocatedEntity* TestWorld::addNewEntity(const std::string&,
+                                       const Atlas::Objects::Entity::RootEntity&)
+{
+    return 0;
+}
+
+int main()
+{
+    SystemSchedulerBenchmark t;
+
+    return t.run();
+}
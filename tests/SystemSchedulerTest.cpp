@@ -0,0 +1,264 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "common/SystemScheduler.h"
+
+#include "rulesets/LocatedEntity.h"
+
+#include <Atlas/Objects/Operation.h>
+
+using Atlas::Objects::Operation::Update;
+
+class ScheduledEntity : public LocatedEntity {
+  public:
+    int m_updates = 0;
+
+    ScheduledEntity(const std::string & id, long intId) :
+        LocatedEntity(id, intId) { }
+
+    void destroy() override
+    {
+        m_flags |= entity_destroyed;
+    }
+};
+
+class SystemSchedulertest : public Cyphesis::TestBase
+{
+  protected:
+    double m_time;
+    int m_results;
+    SystemScheduler * m_scheduler;
+    int m_system;
+
+  public:
+    SystemSchedulertest();
+
+    void setup();
+    void teardown();
+
+    void test_addEntity();
+    void test_run();
+    void test_interval();
+    void test_destroyed();
+    void test_removeDuringRun();
+    void test_slices();
+};
+
+SystemSchedulertest::SystemSchedulertest()
+{
+    ADD_TEST(SystemSchedulertest::test_addEntity);
+    ADD_TEST(SystemSchedulertest::test_run);
+    ADD_TEST(SystemSchedulertest::test_interval);
+    ADD_TEST(SystemSchedulertest::test_destroyed);
+    ADD_TEST(SystemSchedulertest::test_removeDuringRun);
+    ADD_TEST(SystemSchedulertest::test_slices);
+}
+
+void SystemSchedulertest::setup()
+{
+    m_time = 0;
+    m_results = 0;
+    m_scheduler = new SystemScheduler([&](const Operation &, LocatedEntity &) { ++m_results; },
+                                      [&]() { return m_time; });
+    m_system = m_scheduler->addSystem("test", 10,
+                                      [](LocatedEntity & entity, OpVector & res) {
+                                          ++static_cast<ScheduledEntity &>(entity).m_updates;
+                                          res.push_back(Update());
+                                      });
+}
+
+void SystemSchedulertest::teardown()
+{
+    delete m_scheduler;
+}
+
+void SystemSchedulertest::test_addEntity()
+{
+    ScheduledEntity entity("1", 1);
+    entity.incRef();
+
+    ASSERT_TRUE(m_scheduler->addEntity(m_system, entity));
+    ASSERT_FALSE(m_scheduler->addEntity(m_system, entity));
+    ASSERT_TRUE(m_scheduler->hasEntity(m_system, entity));
+    ASSERT_EQUAL(m_scheduler->entityCount(m_system), 1u);
+
+    // Registering the same name again gives the existing system.
+    ASSERT_EQUAL(m_scheduler->addSystem("test", 5, SystemScheduler::UpdateFunction()), m_system);
+
+    ASSERT_TRUE(m_scheduler->removeEntity(m_system, entity));
+    ASSERT_FALSE(m_scheduler->removeEntity(m_system, entity));
+    ASSERT_EQUAL(m_scheduler->entityCount(m_system), 0u);
+}
+
+void SystemSchedulertest::test_run()
+{
+    ScheduledEntity entity1("1", 1);
+    ScheduledEntity entity2("2", 2);
+    entity1.incRef();
+    entity2.incRef();
+    m_scheduler->addEntity(m_system, entity1);
+    m_scheduler->addEntity(m_system, entity2);
+
+    // Nothing is due before the interval has passed.
+    ASSERT_EQUAL(m_scheduler->run(), 0u);
+    ASSERT_EQUAL(m_scheduler->secondsUntilNextRun(), 10.);
+
+    m_time = 10;
+    ASSERT_EQUAL(m_scheduler->secondsUntilNextRun(), 0.);
+    ASSERT_EQUAL(m_scheduler->run(), 2u);
+    ASSERT_EQUAL(entity1.m_updates, 1);
+    ASSERT_EQUAL(entity2.m_updates, 1);
+    ASSERT_EQUAL(m_results, 2);
+
+    m_scheduler->clear();
+}
+
+void SystemSchedulertest::test_interval()
+{
+    ScheduledEntity entity("1", 1);
+    entity.incRef();
+    m_scheduler->addEntity(m_system, entity);
+
+    m_time = 10;
+    m_scheduler->run();
+    m_time = 15;
+    ASSERT_EQUAL(m_scheduler->run(), 0u);
+    ASSERT_EQUAL(m_scheduler->secondsUntilNextRun(), 5.);
+    m_time = 20;
+    ASSERT_EQUAL(m_scheduler->run(), 1u);
+    ASSERT_EQUAL(entity.m_updates, 2);
+
+    m_scheduler->clear();
+}
+
+void SystemSchedulertest::test_destroyed()
+{
+    ScheduledEntity entity1("1", 1);
+    ScheduledEntity entity2("2", 2);
+    entity1.incRef();
+    entity2.incRef();
+    m_scheduler->addEntity(m_system, entity1);
+    m_scheduler->addEntity(m_system, entity2);
+
+    entity1.destroy();
+    m_time = 10;
+    ASSERT_EQUAL(m_scheduler->run(), 1u);
+    ASSERT_EQUAL(entity1.m_updates, 0);
+    ASSERT_EQUAL(entity2.m_updates, 1);
+    ASSERT_FALSE(m_scheduler->hasEntity(m_system, entity1));
+
+    m_scheduler->clear();
+    ASSERT_EQUAL(m_scheduler->secondsUntilNextRun(), -1.);
+}
+
+void SystemSchedulertest::test_removeDuringRun()
+{
+    ScheduledEntity entity1("1", 1);
+    ScheduledEntity entity2("2", 2);
+    entity1.incRef();
+    entity2.incRef();
+    int system = -1;
+    system = m_scheduler->addSystem("remove", 10,
+                                    [&](LocatedEntity & entity, OpVector &) {
+                                        ++static_cast<ScheduledEntity &>(entity).m_updates;
+                                        m_scheduler->removeEntity(system, entity);
+                                    });
+    m_scheduler->addEntity(system, entity1);
+    m_scheduler->addEntity(system, entity2);
+
+    // The entity moved into the slot of the removed one is still updated.
+    m_time = 10;
+    ASSERT_EQUAL(m_scheduler->run(), 2u);
+    ASSERT_EQUAL(entity1.m_updates, 1);
+    ASSERT_EQUAL(entity2.m_updates, 1);
+    ASSERT_EQUAL(m_scheduler->entityCount(system), 0u);
+}
+
+void SystemSchedulertest::test_slices()
+{
+    ScheduledEntity entity1("1", 1);
+    ScheduledEntity entity2("2", 2);
+    ScheduledEntity entity3("3", 3);
+    entity1.incRef();
+    entity2.incRef();
+    entity3.incRef();
+    int system = m_scheduler->addSystem("sliced", 10,
+                                        [](LocatedEntity & entity, OpVector &) {
+                                            ++static_cast<ScheduledEntity &>(entity).m_updates;
+                                        }, 2);
+    m_scheduler->addEntity(system, entity1, 0);
+    m_scheduler->addEntity(system, entity2, 1);
+    // The slice wraps around.
+    m_scheduler->addEntity(system, entity3, 3);
+
+    // Each run updates one slice, so runs are twice as often.
+    ASSERT_EQUAL(m_scheduler->secondsUntilNextRun(), 5.);
+    m_time = 5;
+    ASSERT_EQUAL(m_scheduler->run(), 1u);
+    ASSERT_EQUAL(entity1.m_updates, 1);
+    ASSERT_EQUAL(entity2.m_updates, 0);
+    ASSERT_EQUAL(entity3.m_updates, 0);
+
+    m_time = 10;
+    ASSERT_EQUAL(m_scheduler->run(), 2u);
+    ASSERT_EQUAL(entity1.m_updates, 1);
+    ASSERT_EQUAL(entity2.m_updates, 1);
+    ASSERT_EQUAL(entity3.m_updates, 1);
+
+    // Removing an entity keeps the slices of the others.
+    m_scheduler->removeEntity(system, entity1);
+    m_time = 15;
+    ASSERT_EQUAL(m_scheduler->run(), 0u);
+    m_time = 20;
+    ASSERT_EQUAL(m_scheduler->run(), 2u);
+    ASSERT_EQUAL(entity2.m_updates, 2);
+    ASSERT_EQUAL(entity3.m_updates, 2);
+
+    m_scheduler->clear();
+}
+
+int main()
+{
+    SystemSchedulertest t;
+
+    return t.run();
+}
+
+// stubs
+
+#define STUB_LocatedEntity_LocatedEntity
+LocatedEntity::LocatedEntity(const std::string & id, long intId) :
+    Router(id, intId),
+    m_refCount(0), m_seq(0),
+    m_script(0), m_type(0), m_flags(0), m_contains(0)
+{
+}
+
+#include "stubs/rulesets/stubLocatedEntity.h"
+#include "stubs/common/stubRouter.h"
+#include "stubs/common/stubLog.h"
+#include "stubs/modules/stubLocation.h"
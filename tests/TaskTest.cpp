@@ -246,10 +246,20 @@ bool Script::operation(const std::string & opname,
    return Tasktest::get_Script_operation_ret();
 }
 
+bool Script::handlesOperation(const std::string & opname, int op_no)
+{
+    return false;
+}
+
 void Script::hook(const std::string & function, LocatedEntity * entity)
 {
 }
 
+bool Script::isReferenced() const
+{
+    return false;
+}
+
 void log(LogLevel lvl, const std::string & msg)
 {
 }
@@ -120,9 +120,9 @@ int main()
 
 
 #define STUB_Entity_getProperty
-const PropertyBase * Entity::getProperty(const std::string & name) const
+const PropertyBase * Entity::getProperty(const PropertyKey & key) const
 {
-    PropertyDict::const_iterator I = m_properties.find(name);
+    PropertyDict::const_iterator I = m_properties.find(key);
     if (I != m_properties.end()) {
         return I->second;
     }
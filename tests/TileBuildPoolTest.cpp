@@ -0,0 +1,106 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "navigation/TileBuildPool.h"
+
+#include <atomic>
+#include <set>
+
+class TileBuildPoolTest : public Cyphesis::TestBase
+{
+    public:
+        TileBuildPoolTest();
+
+        void setup();
+
+        void teardown();
+
+        void test_threadCount();
+
+        void test_drainOnDestruction();
+
+        void test_workerThreads();
+};
+
+TileBuildPoolTest::TileBuildPoolTest()
+{
+    ADD_TEST(TileBuildPoolTest::test_threadCount);
+    ADD_TEST(TileBuildPoolTest::test_drainOnDestruction);
+    ADD_TEST(TileBuildPoolTest::test_workerThreads);
+}
+
+void TileBuildPoolTest::setup()
+{
+}
+
+void TileBuildPoolTest::teardown()
+{
+}
+
+void TileBuildPoolTest::test_threadCount()
+{
+    TileBuildPool pool(3);
+    ASSERT_EQUAL(pool.getThreadCount(), 3u);
+}
+
+void TileBuildPoolTest::test_drainOnDestruction()
+{
+    std::atomic<int> ran(0);
+    {
+        TileBuildPool pool(2);
+        for (int i = 0; i < 100; ++i) {
+            pool.post([&ran]() { ++ran; });
+        }
+    }
+    ASSERT_EQUAL(ran.load(), 100);
+}
+
+void TileBuildPoolTest::test_workerThreads()
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    {
+        TileBuildPool pool(2);
+        for (int i = 0; i < 20; ++i) {
+            pool.post([&]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                threadIds.insert(std::this_thread::get_id());
+            });
+        }
+    }
+    // No jobs may run on the thread posting them.
+    ASSERT_TRUE(threadIds.count(std::this_thread::get_id()) == 0);
+    ASSERT_TRUE(!threadIds.empty());
+    ASSERT_TRUE(threadIds.size() <= 2);
+}
+
+int main()
+{
+    TileBuildPoolTest t;
+
+    return t.run();
+}
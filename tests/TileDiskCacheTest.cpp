@@ -0,0 +1,246 @@
+// Cyphesis Online RPG Server and AI Engine
+// Copyright (C) 2026 Erik Ogenvik
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#ifndef DEBUG
+#define DEBUG
+#endif
+
+#include "TestBase.h"
+
+#include "navigation/TileDiskCache.h"
+#include "navigation/Awareness.h"
+#include "navigation/AwarenessUtils.h"
+
+#include "DetourAlloc.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+class TileDiskCacheTest : public Cyphesis::TestBase
+{
+    protected:
+        std::string m_directory;
+        TileDiskCache* m_cache;
+        unsigned char m_layer1[16];
+        unsigned char m_layer2[40];
+        TileCacheData m_layers[2];
+        TileDiskCache::Key m_key;
+
+        static void freeLayers(TileCacheData* tiles, int ntiles);
+
+        /**
+         * @brief Sets the time an entry was last used to some seconds ago.
+         */
+        void age(const TileDiskCache::Key& key, std::time_t seconds);
+
+    public:
+        TileDiskCacheTest();
+
+        void setup();
+
+        void teardown();
+
+        void test_roundTrip();
+
+        void test_missing();
+
+        void test_tooManyLayers();
+
+        void test_truncated();
+
+        void test_check();
+
+        void test_prune();
+
+        void test_pruneTemporary();
+};
+
+TileDiskCacheTest::TileDiskCacheTest()
+{
+    ADD_TEST(TileDiskCacheTest::test_roundTrip);
+    ADD_TEST(TileDiskCacheTest::test_missing);
+    ADD_TEST(TileDiskCacheTest::test_tooManyLayers);
+    ADD_TEST(TileDiskCacheTest::test_truncated);
+    ADD_TEST(TileDiskCacheTest::test_check);
+    ADD_TEST(TileDiskCacheTest::test_prune);
+    ADD_TEST(TileDiskCacheTest::test_pruneTemporary);
+}
+
+void TileDiskCacheTest::setup()
+{
+    m_directory = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+    m_cache = new TileDiskCache(m_directory);
+
+    for (size_t i = 0; i < sizeof(m_layer1); ++i) {
+        m_layer1[i] = i;
+    }
+    for (size_t i = 0; i < sizeof(m_layer2); ++i) {
+        m_layer2[i] = 255 - i;
+    }
+    m_layers[0].data = m_layer1;
+    m_layers[0].dataSize = sizeof(m_layer1);
+    m_layers[1].data = m_layer2;
+    m_layers[1].dataSize = sizeof(m_layer2);
+    m_key = TileDiskCache::Key{1, 1};
+}
+
+void TileDiskCacheTest::teardown()
+{
+    delete m_cache;
+    boost::filesystem::remove_all(m_directory);
+}
+
+void TileDiskCacheTest::freeLayers(TileCacheData* tiles, int ntiles)
+{
+    for (int i = 0; i < ntiles; ++i) {
+        dtFree(tiles[i].data);
+    }
+}
+
+void TileDiskCacheTest::age(const TileDiskCache::Key& key, std::time_t seconds)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.tile", (unsigned long long)key.hash);
+    boost::filesystem::last_write_time(boost::filesystem::path(m_directory) / name, std::time(nullptr) - seconds);
+}
+
+void TileDiskCacheTest::test_roundTrip()
+{
+    ASSERT_TRUE(boost::filesystem::is_directory(m_directory));
+    m_cache->store(m_key, m_layers, 2);
+
+    TileCacheData tiles[MAX_LAYERS];
+    memset(tiles, 0, sizeof(tiles));
+    int ntiles = m_cache->load(m_key, tiles, MAX_LAYERS);
+    ASSERT_EQUAL(ntiles, 2);
+    ASSERT_EQUAL(tiles[0].dataSize, (int)sizeof(m_layer1));
+    ASSERT_EQUAL(tiles[1].dataSize, (int)sizeof(m_layer2));
+    ASSERT_EQUAL(memcmp(tiles[0].data, m_layer1, sizeof(m_layer1)), 0);
+    ASSERT_EQUAL(memcmp(tiles[1].data, m_layer2, sizeof(m_layer2)), 0);
+    freeLayers(tiles, ntiles);
+
+    // Entries are replaced
+    m_cache->store(m_key, m_layers, 1);
+    ntiles = m_cache->load(m_key, tiles, MAX_LAYERS);
+    ASSERT_EQUAL(ntiles, 1);
+    freeLayers(tiles, ntiles);
+}
+
+void TileDiskCacheTest::test_missing()
+{
+    m_cache->store(m_key, m_layers, 2);
+
+    TileCacheData tiles[MAX_LAYERS];
+    ASSERT_EQUAL(m_cache->load(TileDiskCache::Key{2, 1}, tiles, MAX_LAYERS), -1);
+}
+
+void TileDiskCacheTest::test_tooManyLayers()
+{
+    m_cache->store(m_key, m_layers, 2);
+
+    TileCacheData tiles[1];
+    ASSERT_EQUAL(m_cache->load(m_key, tiles, 1), -1);
+}
+
+void TileDiskCacheTest::test_truncated()
+{
+    m_cache->store(m_key, m_layers, 2);
+
+    // Only one entry and no temporary files should be left.
+    boost::filesystem::directory_iterator I(m_directory), Iend;
+    ASSERT_TRUE(I != Iend);
+    boost::filesystem::path entry = I->path();
+    ASSERT_TRUE(++I == Iend);
+
+    boost::filesystem::resize_file(entry, boost::filesystem::file_size(entry) - 1);
+
+    TileCacheData tiles[MAX_LAYERS];
+    ASSERT_EQUAL(m_cache->load(m_key, tiles, MAX_LAYERS), -1);
+}
+
+void TileDiskCacheTest::test_check()
+{
+    m_cache->store(m_key, m_layers, 2);
+
+    // An entry for other input with the same hash isn't used.
+    TileCacheData tiles[MAX_LAYERS];
+    ASSERT_EQUAL(m_cache->load(TileDiskCache::Key{1, 2}, tiles, MAX_LAYERS), -1);
+}
+
+void TileDiskCacheTest::test_prune()
+{
+    delete m_cache;
+    // Room for two entries of both layers, but not three.
+    m_cache = new TileDiskCache(m_directory, 250);
+
+    TileDiskCache::Key key1{1, 1}, key2{2, 2}, key3{3, 3};
+    m_cache->store(key1, m_layers, 2);
+    m_cache->store(key2, m_layers, 2);
+    age(key1, 100);
+    age(key2, 50);
+
+    // Loading an entry makes it the most recently used.
+    TileCacheData tiles[MAX_LAYERS];
+    int ntiles = m_cache->load(key1, tiles, MAX_LAYERS);
+    ASSERT_EQUAL(ntiles, 2);
+    freeLayers(tiles, ntiles);
+
+    m_cache->store(key3, m_layers, 2);
+    ASSERT_EQUAL(m_cache->load(key2, tiles, MAX_LAYERS), -1);
+    ntiles = m_cache->load(key1, tiles, MAX_LAYERS);
+    ASSERT_EQUAL(ntiles, 2);
+    freeLayers(tiles, ntiles);
+    ntiles = m_cache->load(key3, tiles, MAX_LAYERS);
+    ASSERT_EQUAL(ntiles, 2);
+    freeLayers(tiles, ntiles);
+
+    // Nothing is removed while within the limit.
+    ASSERT_EQUAL(m_cache->prune(), 0u);
+}
+
+void TileDiskCacheTest::test_pruneTemporary()
+{
+    boost::filesystem::path stale = boost::filesystem::path(m_directory) / "0000000000000001.tile.1.0";
+    boost::filesystem::path recent = boost::filesystem::path(m_directory) / "0000000000000001.tile.1.1";
+    std::ofstream(stale.string()) << "stale";
+    std::ofstream(recent.string()) << "recent";
+    boost::filesystem::last_write_time(stale, std::time(nullptr) - 2 * 60 * 60);
+
+    // Temporary files are only removed once they're old enough that no process can still be writing them.
+    ASSERT_EQUAL(m_cache->prune(), 1u);
+    ASSERT_TRUE(!boost::filesystem::exists(stale));
+    ASSERT_TRUE(boost::filesystem::exists(recent));
+}
+
+int main()
+{
+    TileDiskCacheTest t;
+
+    return t.run();
+}
+
+// stubs
+
+#include "stubs/common/stubLog.h"
@@ -44,6 +44,38 @@ int main()
     assert(!foo.isTypeOf(&bar));
     assert(bar.isTypeOf(&foo));
 
+    // Once numbered, inheritance is decided by the intervals alone.
+    TypeNode baz("character");
+    baz.setParent(&foo);
+
+    foo.setTreeInterval(0, 2);
+    bar.setTreeInterval(1, 1);
+    baz.setTreeInterval(2, 2);
+
+    assert(foo.isTypeOf(&foo));
+    assert(bar.isTypeOf(&foo));
+    assert(baz.isTypeOf(&foo));
+    assert(!foo.isTypeOf(&bar));
+    assert(!baz.isTypeOf(&bar));
+    assert(!bar.isTypeOf(&baz));
+
+    // Re-parenting invalidates the numbering, and falls back to the chain.
+    baz.setParent(&bar);
+    assert(baz.treeIndex() == -1);
+    assert(baz.isTypeOf(&bar));
+    assert(baz.isTypeOf(&foo));
+
+    // Delegates are added by the class properties of the type.
+    assert(foo.delegates(3) == nullptr);
+    assert(!foo.hasDelegate(3, PropertyKey::intern("decays")));
+    foo.addDelegate(3, "decays", nullptr);
+    assert(foo.hasDelegate(3, PropertyKey::find("decays")));
+    assert(!foo.hasDelegate(4, PropertyKey::find("decays")));
+    assert(!bar.hasDelegate(3, PropertyKey::find("decays")));
+    foo.addDelegate(3, "decays", nullptr);
+    assert(foo.delegates(3)->size() == 1);
+    foo.addDelegate(-1, "decays", nullptr);
+
     foo.defaults();
     return 0;
 }
@@ -25,6 +25,7 @@
 
 #include "common/Variable.h"
 
+#include <cstdint>
 #include <iostream>
 
 #include <cassert>
@@ -34,6 +35,10 @@ int main()
     int i = 1;
     Variable<int> v1(i);
 
+    std::int64_t l = 1;
+    Variable<std::int64_t> v4(l);
+    assert(v4.isNumeric());
+
     std::string s;
     Variable<std::string> v2(s);
 
@@ -43,4 +48,5 @@ int main()
     v1.send(std::cout);
     v2.send(std::cout);
     v3.send(std::cout);
+    v4.send(std::cout);
 }
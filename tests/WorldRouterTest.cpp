@@ -295,6 +295,7 @@ int TICK_NO = -1;
 #include "stubs/rulesets/stubEntity.h"
 #include "stubs/rulesets/stubDomain.h"
 #include "stubs/common/stubOperationsDispatcher.h"
+#include "stubs/common/stubSystemScheduler.h"
 
 #define STUB_LocatedEntity_LocatedEntity_DTOR
 // Deletions and reference count decrements are required to ensure map
@@ -165,6 +165,14 @@
 #endif //STUB_LocalStreamClientSocket_do_read
 
 
+#ifndef STUB_AtlasStreamClient_writeBatch
+//#define STUB_AtlasStreamClient_writeBatch
+  void AtlasStreamClient::writeBatch()
+  {
+    
+  }
+#endif //STUB_AtlasStreamClient_writeBatch
+
 #ifndef STUB_AtlasStreamClient_waitForLoginResponse
 //#define STUB_AtlasStreamClient_waitForLoginResponse
   int AtlasStreamClient::waitForLoginResponse()
@@ -279,6 +287,22 @@
   }
 #endif //STUB_AtlasStreamClient_send
 
+#ifndef STUB_AtlasStreamClient_beginBatch
+//#define STUB_AtlasStreamClient_beginBatch
+  void AtlasStreamClient::beginBatch()
+  {
+    
+  }
+#endif //STUB_AtlasStreamClient_beginBatch
+
+#ifndef STUB_AtlasStreamClient_flush
+//#define STUB_AtlasStreamClient_flush
+  void AtlasStreamClient::flush()
+  {
+    
+  }
+#endif //STUB_AtlasStreamClient_flush
+
 #ifndef STUB_AtlasStreamClient_connect
 //#define STUB_AtlasStreamClient_connect
   int AtlasStreamClient::connect(const std::string & host, unsigned short port )
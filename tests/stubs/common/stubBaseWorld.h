@@ -10,7 +10,7 @@
 #ifndef STUB_BaseWorld_BaseWorld
 //#define STUB_BaseWorld_BaseWorld
    BaseWorld::BaseWorld(LocatedEntity & gw)
-    : m_defaultLocation(nullptr),m_limboLocation(nullptr)
+    : m_defaultLocation(nullptr),m_limboLocation(nullptr),m_systems(nullptr)
   {
     
   }
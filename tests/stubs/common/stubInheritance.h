@@ -95,6 +95,14 @@
   }
 #endif //STUB_Inheritance_isTypeOf
 
+#ifndef STUB_Inheritance_renumber
+//#define STUB_Inheritance_renumber
+  void Inheritance::renumber()
+  {
+    
+  }
+#endif //STUB_Inheritance_renumber
+
 #ifndef STUB_Inheritance_flush
 //#define STUB_Inheritance_flush
   void Inheritance::flush()
@@ -55,6 +55,14 @@
   }
 #endif //STUB_Monitors_watch
 
+#ifndef STUB_Monitors_watchPool
+//#define STUB_Monitors_watchPool
+  void Monitors::watchPool(const std::string &, const PoolStats &)
+  {
+    
+  }
+#endif //STUB_Monitors_watchPool
+
 #ifndef STUB_Monitors_send
 //#define STUB_Monitors_send
   void Monitors::send(std::ostream &)
@@ -98,6 +98,14 @@
   }
 #endif //STUB_OperationsDispatcher_addOperationToQueue
 
+#ifndef STUB_OperationsDispatcher_getDispatchLag
+//#define STUB_OperationsDispatcher_getDispatchLag
+  double OperationsDispatcher::getDispatchLag() const
+  {
+    return 0;
+  }
+#endif //STUB_OperationsDispatcher_getDispatchLag
+
 #ifndef STUB_OperationsDispatcher_dispatchOperation
 //#define STUB_OperationsDispatcher_dispatchOperation
   void OperationsDispatcher::dispatchOperation(const OpQueEntry& opQueueEntry)
@@ -95,6 +95,14 @@
   }
 #endif //STUB_PropertyBase_copy
 
+#ifndef STUB_PropertyBase_typeId
+//#define STUB_PropertyBase_typeId
+  PropertyTypeId PropertyBase::typeId() const
+  {
+    return propertyTypeId<PropertyBase>();
+  }
+#endif //STUB_PropertyBase_typeId
+
 
 #ifndef STUB_Property_Property
 //#define STUB_Property_Property
@@ -151,6 +159,15 @@
   }
 #endif //STUB_Property_copy
 
+#ifndef STUB_Property_typeId
+//#define STUB_Property_typeId
+  template <typename T>
+  PropertyTypeId Property<T>::typeId() const
+  {
+    return propertyTypeId<Property<T>>();
+  }
+#endif //STUB_Property_typeId
+
 
 #ifndef STUB_SoftProperty_SoftProperty
 //#define STUB_SoftProperty_SoftProperty
@@ -185,5 +202,13 @@
   }
 #endif //STUB_SoftProperty_copy
 
+#ifndef STUB_SoftProperty_typeId
+//#define STUB_SoftProperty_typeId
+  PropertyTypeId SoftProperty::typeId() const
+  {
+    return propertyTypeId<SoftProperty>();
+  }
+#endif //STUB_SoftProperty_typeId
+
 
 #endif
\ No newline at end of file
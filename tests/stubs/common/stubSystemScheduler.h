@@ -0,0 +1,107 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubSystemScheduler_custom.h file.
+
+#include "common/SystemScheduler.h"
+#include "stubSystemScheduler_custom.h"
+
+#ifndef STUB_COMMON_SYSTEMSCHEDULER_H
+#define STUB_COMMON_SYSTEMSCHEDULER_H
+
+#ifndef STUB_SystemScheduler_SystemScheduler
+//#define STUB_SystemScheduler_SystemScheduler
+   SystemScheduler::SystemScheduler(const std::function<void(const Operation &, LocatedEntity &)> & resultProcessor, const std::function<double()> & timeProviderFn)
+  {
+    
+  }
+#endif //STUB_SystemScheduler_SystemScheduler
+
+#ifndef STUB_SystemScheduler_SystemScheduler_DTOR
+//#define STUB_SystemScheduler_SystemScheduler_DTOR
+   SystemScheduler::~SystemScheduler()
+  {
+    
+  }
+#endif //STUB_SystemScheduler_SystemScheduler_DTOR
+
+#ifndef STUB_SystemScheduler_addSystem
+//#define STUB_SystemScheduler_addSystem
+  int SystemScheduler::addSystem(const std::string & name, double interval, const UpdateFunction & update, int slices )
+  {
+    return 0;
+  }
+#endif //STUB_SystemScheduler_addSystem
+
+#ifndef STUB_SystemScheduler_addEntity
+//#define STUB_SystemScheduler_addEntity
+  bool SystemScheduler::addEntity(int system, LocatedEntity & entity, int slice )
+  {
+    return false;
+  }
+#endif //STUB_SystemScheduler_addEntity
+
+#ifndef STUB_SystemScheduler_removeEntity
+//#define STUB_SystemScheduler_removeEntity
+  bool SystemScheduler::removeEntity(int system, LocatedEntity & entity)
+  {
+    return false;
+  }
+#endif //STUB_SystemScheduler_removeEntity
+
+#ifndef STUB_SystemScheduler_hasEntity
+//#define STUB_SystemScheduler_hasEntity
+  bool SystemScheduler::hasEntity(int system, const LocatedEntity & entity) const
+  {
+    return false;
+  }
+#endif //STUB_SystemScheduler_hasEntity
+
+#ifndef STUB_SystemScheduler_entityCount
+//#define STUB_SystemScheduler_entityCount
+  std::size_t SystemScheduler::entityCount(int system) const
+  {
+    return 0;
+  }
+#endif //STUB_SystemScheduler_entityCount
+
+#ifndef STUB_SystemScheduler_run
+//#define STUB_SystemScheduler_run
+  std::size_t SystemScheduler::run()
+  {
+    return 0;
+  }
+#endif //STUB_SystemScheduler_run
+
+#ifndef STUB_SystemScheduler_secondsUntilNextRun
+//#define STUB_SystemScheduler_secondsUntilNextRun
+  double SystemScheduler::secondsUntilNextRun() const
+  {
+    return 0;
+  }
+#endif //STUB_SystemScheduler_secondsUntilNextRun
+
+#ifndef STUB_SystemScheduler_clear
+//#define STUB_SystemScheduler_clear
+  void SystemScheduler::clear()
+  {
+    
+  }
+#endif //STUB_SystemScheduler_clear
+
+#ifndef STUB_SystemScheduler_removeAt
+//#define STUB_SystemScheduler_removeAt
+  void SystemScheduler::removeAt(System & system, std::size_t index)
+  {
+    
+  }
+#endif //STUB_SystemScheduler_removeAt
+
+#ifndef STUB_SystemScheduler_runSystem
+//#define STUB_SystemScheduler_runSystem
+  std::size_t SystemScheduler::runSystem(System & system)
+  {
+    return 0;
+  }
+#endif //STUB_SystemScheduler_runSystem
+
+
+#endif
\ No newline at end of file
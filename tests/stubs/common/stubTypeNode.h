@@ -7,6 +7,15 @@
 #ifndef STUB_COMMON_TYPENODE_H
 #define STUB_COMMON_TYPENODE_H
 
+
+#ifndef STUB_TypeNode_updateDelegates
+//#define STUB_TypeNode_updateDelegates
+  void TypeNode::updateDelegates(const PropertyKey & key, PropertyBase * property)
+  {
+    
+  }
+#endif //STUB_TypeNode_updateDelegates
+
 #ifndef STUB_TypeNode_TypeNode
 //#define STUB_TypeNode_TypeNode
    TypeNode::TypeNode(const std::string &)
@@ -73,5 +82,21 @@
   }
 #endif //STUB_TypeNode_isTypeOf
 
+#ifndef STUB_TypeNode_addDelegate
+//#define STUB_TypeNode_addDelegate
+  void TypeNode::addDelegate(int class_no, const std::string & name, PropertyBase * property)
+  {
+    
+  }
+#endif //STUB_TypeNode_addDelegate
+
+#ifndef STUB_TypeNode_hasDelegate
+//#define STUB_TypeNode_hasDelegate
+  bool TypeNode::hasDelegate(int class_no, const PropertyKey & key) const
+  {
+    return false;
+  }
+#endif //STUB_TypeNode_hasDelegate
+
 
 #endif
\ No newline at end of file
@@ -18,3 +18,5 @@
 
 #include "stubAwareness.h"
 #include "stubSteering.h"
+#include "stubTileBuildPool.h"
+#include "stubTileDiskCache.h"
@@ -11,8 +11,8 @@
 
 #ifndef STUB_Awareness_Awareness
 //#define STUB_Awareness_Awareness
-   Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize )
-    : mTalloc(nullptr),mTcomp(nullptr),mTmproc(nullptr),mCtx(nullptr),mTileCache(nullptr),mNavMesh(nullptr),mNavQuery(nullptr),mFilter(nullptr),mObstacleAvoidanceQuery(nullptr),mObstacleAvoidanceParams(nullptr),mActiveTileList(nullptr)
+   Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize , TileBuildPool* tileBuildPool , TileDiskCache* tileDiskCache )
+    : mTileBuildPool(nullptr),mTileDiskCache(nullptr),mTalloc(nullptr),mTcomp(nullptr),mTmproc(nullptr),mCtx(nullptr),mTileCache(nullptr),mNavMesh(nullptr),mNavQuery(nullptr),mSlicedNavQuery(nullptr),mFilter(nullptr),mObstacleAvoidanceQuery(nullptr),mObstacleAvoidanceParams(nullptr),mActiveTileList(nullptr)
   {
     
   }
@@ -58,6 +58,14 @@
   }
 #endif //STUB_Awareness_rebuildDirtyTile
 
+#ifndef STUB_Awareness_tilesInProgress
+//#define STUB_Awareness_tilesInProgress
+  size_t Awareness::tilesInProgress() const
+  {
+    return 0;
+  }
+#endif //STUB_Awareness_tilesInProgress
+
 #ifndef STUB_Awareness_findPath
 //#define STUB_Awareness_findPath
   int Awareness::findPath(const WFMath::Point<3>& start, const WFMath::Point<3>& end, float radius, std::list<WFMath::Point<3>>& path) const
@@ -66,6 +74,38 @@
   }
 #endif //STUB_Awareness_findPath
 
+#ifndef STUB_Awareness_requestPath
+//#define STUB_Awareness_requestPath
+  long Awareness::requestPath(const WFMath::Point<3>& start, const WFMath::Point<3>& end, float radius, PathCallback callback)
+  {
+    return 0;
+  }
+#endif //STUB_Awareness_requestPath
+
+#ifndef STUB_Awareness_cancelPathRequest
+//#define STUB_Awareness_cancelPathRequest
+  void Awareness::cancelPathRequest(long requestId)
+  {
+    
+  }
+#endif //STUB_Awareness_cancelPathRequest
+
+#ifndef STUB_Awareness_processPathRequests
+//#define STUB_Awareness_processPathRequests
+  bool Awareness::processPathRequests(int maxIterations, double currentTimestamp, double minInterval)
+  {
+    return false;
+  }
+#endif //STUB_Awareness_processPathRequests
+
+#ifndef STUB_Awareness_pendingPathRequests
+//#define STUB_Awareness_pendingPathRequests
+  size_t Awareness::pendingPathRequests() const
+  {
+    return 0;
+  }
+#endif //STUB_Awareness_pendingPathRequests
+
 #ifndef STUB_Awareness_processTile
 //#define STUB_Awareness_processTile
   void Awareness::processTile(const int tx, const int ty, const TileProcessor& processor) const
@@ -98,6 +138,46 @@
   }
 #endif //STUB_Awareness_avoidObstacles
 
+#ifndef STUB_Awareness_setCrowdAgent
+//#define STUB_Awareness_setCrowdAgent
+  void Awareness::setCrowdAgent(long avatarEntityId, const WFMath::Point<2>& position, const WFMath::Vector<2>& desiredVelocity)
+  {
+    
+  }
+#endif //STUB_Awareness_setCrowdAgent
+
+#ifndef STUB_Awareness_removeCrowdAgent
+//#define STUB_Awareness_removeCrowdAgent
+  void Awareness::removeCrowdAgent(long avatarEntityId)
+  {
+    
+  }
+#endif //STUB_Awareness_removeCrowdAgent
+
+#ifndef STUB_Awareness_updateCrowd
+//#define STUB_Awareness_updateCrowd
+  bool Awareness::updateCrowd(double currentTimestamp, double minInterval)
+  {
+    return false;
+  }
+#endif //STUB_Awareness_updateCrowd
+
+#ifndef STUB_Awareness_getCrowdAvoidance
+//#define STUB_Awareness_getCrowdAvoidance
+  bool Awareness::getCrowdAvoidance(long avatarEntityId, WFMath::Vector<2>& newVelocity) const
+  {
+    return false;
+  }
+#endif //STUB_Awareness_getCrowdAvoidance
+
+#ifndef STUB_Awareness_crowdAgentCount
+//#define STUB_Awareness_crowdAgentCount
+  size_t Awareness::crowdAgentCount() const
+  {
+    return 0;
+  }
+#endif //STUB_Awareness_crowdAgentCount
+
 #ifndef STUB_Awareness_pruneTiles
 //#define STUB_Awareness_pruneTiles
   void Awareness::pruneTiles()
@@ -204,12 +284,68 @@
 
 #ifndef STUB_Awareness_rebuildTile
 //#define STUB_Awareness_rebuildTile
-  void Awareness::rebuildTile(int tx, int ty, const std::vector<WFMath::RotBox<2>>& entityAreas)
+  void Awareness::rebuildTile(int tx, int ty)
   {
     
   }
 #endif //STUB_Awareness_rebuildTile
 
+#ifndef STUB_Awareness_prepareTile
+//#define STUB_Awareness_prepareTile
+  void Awareness::prepareTile(int tx, int ty, TileBuildInput& input)
+  {
+    
+  }
+#endif //STUB_Awareness_prepareTile
+
+#ifndef STUB_Awareness_addTileLayers
+//#define STUB_Awareness_addTileLayers
+  void Awareness::addTileLayers(int tx, int ty, TileCacheData* tiles, int ntiles)
+  {
+    
+  }
+#endif //STUB_Awareness_addTileLayers
+
+#ifndef STUB_Awareness_findNextDirtyTile
+//#define STUB_Awareness_findNextDirtyTile
+  std::list<std::pair<int, int>>::iterator Awareness::findNextDirtyTile()
+  {
+    return mDirtyAwareOrderedTiles.end();
+  }
+#endif //STUB_Awareness_findNextDirtyTile
+
+#ifndef STUB_Awareness_collectBuiltTiles
+//#define STUB_Awareness_collectBuiltTiles
+  void Awareness::collectBuiltTiles()
+  {
+    
+  }
+#endif //STUB_Awareness_collectBuiltTiles
+
+#ifndef STUB_Awareness_beginPathSearch
+//#define STUB_Awareness_beginPathSearch
+  bool Awareness::beginPathSearch(ActivePathSearch& search)
+  {
+    return false;
+  }
+#endif //STUB_Awareness_beginPathSearch
+
+#ifndef STUB_Awareness_finishPathSearch
+//#define STUB_Awareness_finishPathSearch
+  void Awareness::finishPathSearch(ActivePathSearch& search)
+  {
+    
+  }
+#endif //STUB_Awareness_finishPathSearch
+
+#ifndef STUB_Awareness_straightenPath
+//#define STUB_Awareness_straightenPath
+  void Awareness::straightenPath(ActivePathSearch& search)
+  {
+    
+  }
+#endif //STUB_Awareness_straightenPath
+
 #ifndef STUB_Awareness_buildEntityAreas
 //#define STUB_Awareness_buildEntityAreas
   void Awareness::buildEntityAreas(const EntityEntry& entity, std::map<const EntityEntry*, WFMath::RotBox<2>>& entityAreas)
@@ -226,14 +362,38 @@
   }
 #endif //STUB_Awareness_findEntityAreas
 
+#ifndef STUB_Awareness_setEntityArea
+//#define STUB_Awareness_setEntityArea
+  void Awareness::setEntityArea(const EntityEntry& entity, const WFMath::RotBox<2>& area)
+  {
+    
+  }
+#endif //STUB_Awareness_setEntityArea
+
+#ifndef STUB_Awareness_removeEntityArea
+//#define STUB_Awareness_removeEntityArea
+  bool Awareness::removeEntityArea(const EntityEntry& entity)
+  {
+    return false;
+  }
+#endif //STUB_Awareness_removeEntityArea
+
 #ifndef STUB_Awareness_rasterizeTileLayers
 //#define STUB_Awareness_rasterizeTileLayers
-  int Awareness::rasterizeTileLayers(const std::vector<WFMath::RotBox<2>>& entityAreas, const int tx, const int ty, TileCacheData* tiles, const int maxTiles)
+   int Awareness::rasterizeTileLayers(rcContext& ctx, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles)
   {
     return 0;
   }
 #endif //STUB_Awareness_rasterizeTileLayers
 
+#ifndef STUB_Awareness_buildTileLayers
+//#define STUB_Awareness_buildTileLayers
+   int Awareness::buildTileLayers(rcContext& ctx, TileDiskCache* tileDiskCache, const TileBuildInput& input, TileCacheData* tiles, const int maxTiles, bool& fromCache)
+  {
+    return 0;
+  }
+#endif //STUB_Awareness_buildTileLayers
+
 #ifndef STUB_Awareness_processTiles
 //#define STUB_Awareness_processTiles
   void Awareness::processTiles(std::vector<const dtCompressedTile*> tiles, const std::function<void(unsigned int, dtTileCachePolyMesh&, float* origin, float cellsize, float cellheight, dtTileCacheLayer& layer)>& processor) const
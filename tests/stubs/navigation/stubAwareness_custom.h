@@ -1,7 +1,17 @@
 //Add custom implementations of stubbed functions here; this file won't be rewritten when re-generating stubs.
+
+//Only defined in Awareness.cpp, but needed to destroy the members holding them.
+struct ActivePathSearch
+{
+};
+
+struct PathCorridorCache
+{
+};
+
 #ifndef STUB_Awareness_Awareness
 #define STUB_Awareness_Awareness
-Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize )
+Awareness::Awareness(const LocatedEntity& domainEntity, float agentRadius, float agentHeight, IHeightProvider& heightProvider, const WFMath::AxisBox<3>& extent, int tileSize, TileBuildPool* tileBuildPool, TileDiskCache* tileDiskCache)
     : mHeightProvider(heightProvider), mDomainEntity(domainEntity)
 {
 
@@ -18,6 +18,14 @@
   }
 #endif //STUB_Steering_Steering
 
+#ifndef STUB_Steering_Steering_DTOR
+//#define STUB_Steering_Steering_DTOR
+   Steering::~Steering()
+  {
+    
+  }
+#endif //STUB_Steering_Steering_DTOR
+
 #ifndef STUB_Steering_setAwareness
 //#define STUB_Steering_setAwareness
   void Steering::setAwareness(Awareness* awareness)
@@ -26,6 +34,14 @@
   }
 #endif //STUB_Steering_setAwareness
 
+#ifndef STUB_Steering_setCrowdAvoidance
+//#define STUB_Steering_setCrowdAvoidance
+  void Steering::setCrowdAvoidance(bool enabled)
+  {
+    
+  }
+#endif //STUB_Steering_setCrowdAvoidance
+
 #ifndef STUB_Steering_setDestination
 //#define STUB_Steering_setDestination
   void Steering::setDestination(int entityId, const WFMath::Point<3>& entityRelativePosition, float radius, double currentServerTimestamp)
@@ -50,6 +66,38 @@
   }
 #endif //STUB_Steering_updatePath
 
+#ifndef STUB_Steering_preparePathQuery
+//#define STUB_Steering_preparePathQuery
+  int Steering::preparePathQuery(double currentTimestamp, PathQuery& query)
+  {
+    return 0;
+  }
+#endif //STUB_Steering_preparePathQuery
+
+#ifndef STUB_Steering_preparePathQuery
+//#define STUB_Steering_preparePathQuery
+  int Steering::preparePathQuery(const WFMath::Point<3>& currentAvatarPosition, PathQuery& query)
+  {
+    return 0;
+  }
+#endif //STUB_Steering_preparePathQuery
+
+#ifndef STUB_Steering_runPathQuery
+//#define STUB_Steering_runPathQuery
+   int Steering::runPathQuery(const PathQuery& query, std::list<WFMath::Point<3>>& path)
+  {
+    return 0;
+  }
+#endif //STUB_Steering_runPathQuery
+
+#ifndef STUB_Steering_applyPathQuery
+//#define STUB_Steering_applyPathQuery
+  int Steering::applyPathQuery(int result, std::list<WFMath::Point<3>>& path)
+  {
+    return 0;
+  }
+#endif //STUB_Steering_applyPathQuery
+
 #ifndef STUB_Steering_requestUpdate
 //#define STUB_Steering_requestUpdate
   void Steering::requestUpdate()
@@ -98,6 +146,14 @@
   }
 #endif //STUB_Steering_getPath
 
+#ifndef STUB_Steering_hasPendingPathRequest
+//#define STUB_Steering_hasPendingPathRequest
+  bool Steering::hasPendingPathRequest() const
+  {
+    return false;
+  }
+#endif //STUB_Steering_hasPendingPathRequest
+
 #ifndef STUB_Steering_getIsExpectingServerMovement
 //#define STUB_Steering_getIsExpectingServerMovement
   bool Steering::getIsExpectingServerMovement() const
@@ -162,6 +218,30 @@
   }
 #endif //STUB_Steering_setAwarenessArea
 
+#ifndef STUB_Steering_requestPathUpdate
+//#define STUB_Steering_requestPathUpdate
+  void Steering::requestPathUpdate(const WFMath::Point<3>& currentAvatarPosition)
+  {
+    
+  }
+#endif //STUB_Steering_requestPathUpdate
+
+#ifndef STUB_Steering_cancelPathRequest
+//#define STUB_Steering_cancelPathRequest
+  void Steering::cancelPathRequest()
+  {
+    
+  }
+#endif //STUB_Steering_cancelPathRequest
+
+#ifndef STUB_Steering_leaveCrowd
+//#define STUB_Steering_leaveCrowd
+  void Steering::leaveCrowd()
+  {
+    
+  }
+#endif //STUB_Steering_leaveCrowd
+
 #ifndef STUB_Steering_Awareness_TileUpdated
 //#define STUB_Steering_Awareness_TileUpdated
   void Steering::Awareness_TileUpdated(int tx, int ty)
@@ -0,0 +1,52 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubTileBuildPool_custom.h file.
+
+#include "navigation/TileBuildPool.h"
+#include "stubTileBuildPool_custom.h"
+
+#ifndef STUB_NAVIGATION_TILEBUILDPOOL_H
+#define STUB_NAVIGATION_TILEBUILDPOOL_H
+
+#ifndef STUB_TileBuildPool_TileBuildPool
+//#define STUB_TileBuildPool_TileBuildPool
+   TileBuildPool::TileBuildPool(unsigned int threadCount)
+    : mShutdown(false)
+  {
+    
+  }
+#endif //STUB_TileBuildPool_TileBuildPool
+
+#ifndef STUB_TileBuildPool_TileBuildPool_DTOR
+//#define STUB_TileBuildPool_TileBuildPool_DTOR
+   TileBuildPool::~TileBuildPool()
+  {
+    
+  }
+#endif //STUB_TileBuildPool_TileBuildPool_DTOR
+
+#ifndef STUB_TileBuildPool_post
+//#define STUB_TileBuildPool_post
+  void TileBuildPool::post(std::function<void()> job)
+  {
+    
+  }
+#endif //STUB_TileBuildPool_post
+
+#ifndef STUB_TileBuildPool_getThreadCount
+//#define STUB_TileBuildPool_getThreadCount
+  unsigned int TileBuildPool::getThreadCount() const
+  {
+    return 0;
+  }
+#endif //STUB_TileBuildPool_getThreadCount
+
+#ifndef STUB_TileBuildPool_run
+//#define STUB_TileBuildPool_run
+  void TileBuildPool::run()
+  {
+    
+  }
+#endif //STUB_TileBuildPool_run
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubTileDiskCache_custom.h file.
+
+#include "navigation/TileDiskCache.h"
+#include "stubTileDiskCache_custom.h"
+
+#ifndef STUB_NAVIGATION_TILEDISKCACHE_H
+#define STUB_NAVIGATION_TILEDISKCACHE_H
+
+#ifndef STUB_TileDiskCache_TileDiskCache
+//#define STUB_TileDiskCache_TileDiskCache
+   TileDiskCache::TileDiskCache(std::string directory, std::uintmax_t maxSize )
+    : mDisabled(false), mTemporaryCounter(0), mMaxSize(maxSize), mStoredSincePrune(0)
+  {
+    
+  }
+#endif //STUB_TileDiskCache_TileDiskCache
+
+#ifndef STUB_TileDiskCache_load
+//#define STUB_TileDiskCache_load
+  int TileDiskCache::load(const Key& key, TileCacheData* tiles, int maxTiles) const
+  {
+    return 0;
+  }
+#endif //STUB_TileDiskCache_load
+
+#ifndef STUB_TileDiskCache_store
+//#define STUB_TileDiskCache_store
+  void TileDiskCache::store(const Key& key, const TileCacheData* tiles, int ntiles)
+  {
+    
+  }
+#endif //STUB_TileDiskCache_store
+
+#ifndef STUB_TileDiskCache_prune
+//#define STUB_TileDiskCache_prune
+  std::size_t TileDiskCache::prune()
+  {
+    return 0;
+  }
+#endif //STUB_TileDiskCache_prune
+
+#ifndef STUB_TileDiskCache_getDirectory
+//#define STUB_TileDiskCache_getDirectory
+  const std::string& TileDiskCache::getDirectory() const
+  {
+    static std::string instance; return instance;
+  }
+#endif //STUB_TileDiskCache_getDirectory
+
+#ifndef STUB_TileDiskCache_entryPath
+//#define STUB_TileDiskCache_entryPath
+  std::string TileDiskCache::entryPath(const Key& key) const
+  {
+    return "";
+  }
+#endif //STUB_TileDiskCache_entryPath
+
+
+#endif
\ No newline at end of file
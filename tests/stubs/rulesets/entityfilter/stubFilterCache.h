@@ -0,0 +1,39 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubFilterCache_custom.h file.
+
+#include "rulesets/entityfilter/FilterCache.h"
+#include "stubFilterCache_custom.h"
+
+#ifndef STUB_RULESETS_ENTITYFILTER_FILTERCACHE_H
+#define STUB_RULESETS_ENTITYFILTER_FILTERCACHE_H
+
+namespace EntityFilter {
+
+#ifndef STUB_FilterCache_FilterCache
+//#define STUB_FilterCache_FilterCache
+   FilterCache::FilterCache(ProviderFactory& factory, std::size_t capacity )
+  {
+    
+  }
+#endif //STUB_FilterCache_FilterCache
+
+#ifndef STUB_FilterCache_get
+//#define STUB_FilterCache_get
+  std::shared_ptr<Filter> FilterCache::get(const std::string& query)
+  {
+    return nullptr;
+  }
+#endif //STUB_FilterCache_get
+
+#ifndef STUB_FilterCache_clear
+//#define STUB_FilterCache_clear
+  void FilterCache::clear()
+  {
+    
+  }
+#endif //STUB_FilterCache_clear
+
+
+}  // namespace EntityFilter
+
+#endif
\ No newline at end of file
@@ -40,6 +40,14 @@ namespace EntityFilter {
   }
 #endif //STUB_ComparePredicate_isMatch
 
+#ifndef STUB_ComparePredicate_compare
+//#define STUB_ComparePredicate_compare
+   bool ComparePredicate::compare(Comparator comparator, const Atlas::Message::Element& left, const Atlas::Message::Element& right)
+  {
+    return false;
+  }
+#endif //STUB_ComparePredicate_compare
+
 
 }  // namespace EntityFilter
 
@@ -0,0 +1,103 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubProgram_custom.h file.
+
+#include "rulesets/entityfilter/Program.h"
+#include "stubProgram_custom.h"
+
+#ifndef STUB_RULESETS_ENTITYFILTER_PROGRAM_H
+#define STUB_RULESETS_ENTITYFILTER_PROGRAM_H
+
+namespace EntityFilter {
+
+#ifndef STUB_Program_Program
+//#define STUB_Program_Program
+   Program::Program(const Predicate& predicate)
+  {
+    
+  }
+#endif //STUB_Program_Program
+
+#ifndef STUB_Program_isMatch
+//#define STUB_Program_isMatch
+  bool Program::isMatch(const QueryContext& context) const
+  {
+    return false;
+  }
+#endif //STUB_Program_isMatch
+
+#ifndef STUB_Program_requiredType
+//#define STUB_Program_requiredType
+  const TypeNode* Program::requiredType() const
+  {
+    return nullptr;
+  }
+#endif //STUB_Program_requiredType
+
+#ifndef STUB_Program_requiredBaseType
+//#define STUB_Program_requiredBaseType
+  const TypeNode* Program::requiredBaseType() const
+  {
+    return nullptr;
+  }
+#endif //STUB_Program_requiredBaseType
+
+#ifndef STUB_Program_newLabel
+//#define STUB_Program_newLabel
+  int Program::newLabel()
+  {
+    return 0;
+  }
+#endif //STUB_Program_newLabel
+
+#ifndef STUB_Program_placeLabel
+//#define STUB_Program_placeLabel
+  void Program::placeLabel(int label)
+  {
+    
+  }
+#endif //STUB_Program_placeLabel
+
+#ifndef STUB_Program_compile
+//#define STUB_Program_compile
+  void Program::compile(const Predicate& predicate, int onTrue, int onFalse)
+  {
+    
+  }
+#endif //STUB_Program_compile
+
+#ifndef STUB_Program_compileComparison
+//#define STUB_Program_compileComparison
+  void Program::compileComparison(const ComparePredicate& predicate, int onTrue, int onFalse)
+  {
+    
+  }
+#endif //STUB_Program_compileComparison
+
+#ifndef STUB_Program_emit
+//#define STUB_Program_emit
+  void Program::emit(Instruction instruction, int onTrue, int onFalse)
+  {
+    
+  }
+#endif //STUB_Program_emit
+
+#ifndef STUB_Program_constantValue
+//#define STUB_Program_constantValue
+   int Program::constantValue(const Predicate& predicate)
+  {
+    return 0;
+  }
+#endif //STUB_Program_constantValue
+
+#ifndef STUB_Program_test
+//#define STUB_Program_test
+   bool Program::test(const Instruction& instruction, const QueryContext& context)
+  {
+    return false;
+  }
+#endif //STUB_Program_test
+
+
+}  // namespace EntityFilter
+
+#endif
\ No newline at end of file
@@ -105,6 +105,14 @@
   }
 #endif //STUB_AwareMind_getCurrentServerTime
 
+#ifndef STUB_AwareMind_getTickIntervalScale
+//#define STUB_AwareMind_getTickIntervalScale
+  double AwareMind::getTickIntervalScale() const
+  {
+    return 0;
+  }
+#endif //STUB_AwareMind_getTickIntervalScale
+
 #ifndef STUB_AwareMind_onContainered
 //#define STUB_AwareMind_onContainered
   void AwareMind::onContainered(const LocatedEntity * new_loc)
@@ -121,6 +129,14 @@
   }
 #endif //STUB_AwareMind_processMoveTick
 
+#ifndef STUB_AwareMind_updateLodLevel
+//#define STUB_AwareMind_updateLodLevel
+  void AwareMind::updateLodLevel()
+  {
+    
+  }
+#endif //STUB_AwareMind_updateLodLevel
+
 #ifndef STUB_AwareMind_requestAwareness
 //#define STUB_AwareMind_requestAwareness
   void AwareMind::requestAwareness(const MemEntity& entity)
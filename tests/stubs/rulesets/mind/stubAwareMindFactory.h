@@ -9,7 +9,7 @@
 
 #ifndef STUB_AwareMindFactory_AwareMindFactory
 //#define STUB_AwareMindFactory_AwareMindFactory
-   AwareMindFactory::AwareMindFactory()
+   AwareMindFactory::AwareMindFactory(unsigned int tileBuildThreads , const std::string& tileCacheDirectory , std::uintmax_t tileCacheSize )
     : MindKit()
     , mSharedTerrain(nullptr),mAwarenessStoreProvider(nullptr)
   {
@@ -17,6 +17,14 @@
   }
 #endif //STUB_AwareMindFactory_AwareMindFactory
 
+#ifndef STUB_AwareMindFactory_AwareMindFactory_DTOR
+//#define STUB_AwareMindFactory_AwareMindFactory_DTOR
+   AwareMindFactory::~AwareMindFactory()
+  {
+    
+  }
+#endif //STUB_AwareMindFactory_AwareMindFactory_DTOR
+
 #ifndef STUB_AwareMindFactory_newMind
 //#define STUB_AwareMindFactory_newMind
   BaseMind* AwareMindFactory::newMind(const std::string & id, long) const
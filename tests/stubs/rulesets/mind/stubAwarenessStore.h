@@ -9,7 +9,8 @@
 
 #ifndef STUB_AwarenessStore_AwarenessStore
 //#define STUB_AwarenessStore_AwarenessStore
-   AwarenessStore::AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize )
+   AwarenessStore::AwarenessStore(float agentRadius, float agentHeight, IHeightProvider& heightProvider, int tileSize , TileBuildPool* tileBuildPool , TileDiskCache* tileDiskCache )
+    : mTileBuildPool(nullptr),mTileDiskCache(nullptr)
   {
     
   }
@@ -9,7 +9,8 @@
 
 #ifndef STUB_AwarenessStoreProvider_AwarenessStoreProvider
 //#define STUB_AwarenessStoreProvider_AwarenessStoreProvider
-   AwarenessStoreProvider::AwarenessStoreProvider(IHeightProvider& heightProvider)
+   AwarenessStoreProvider::AwarenessStoreProvider(IHeightProvider& heightProvider, TileBuildPool* tileBuildPool , TileDiskCache* tileDiskCache )
+    : m_tileBuildPool(nullptr),m_tileDiskCache(nullptr)
   {
     
   }
@@ -48,5 +48,13 @@
   }
 #endif //STUB_SharedTerrain_getTerrain
 
+#ifndef STUB_SharedTerrain_getSegmentHeights
+//#define STUB_SharedTerrain_getSegmentHeights
+  SharedTerrain::SegmentHeights SharedTerrain::getSegmentHeights(int segmentX, int segmentY) const
+  {
+    return SharedTerrain::SegmentHeights();
+  }
+#endif //STUB_SharedTerrain_getSegmentHeights
+
 
 #endif
\ No newline at end of file
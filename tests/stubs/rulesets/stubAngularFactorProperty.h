@@ -15,6 +15,14 @@
   }
 #endif //STUB_AngularFactorProperty_copy
 
+#ifndef STUB_AngularFactorProperty_typeId
+//#define STUB_AngularFactorProperty_typeId
+  PropertyTypeId AngularFactorProperty::typeId() const
+  {
+    return propertyTypeId<AngularFactorProperty>();
+  }
+#endif //STUB_AngularFactorProperty_typeId
+
 #ifndef STUB_AngularFactorProperty_get
 //#define STUB_AngularFactorProperty_get
   int AngularFactorProperty::get(Atlas::Message::Element & val) const
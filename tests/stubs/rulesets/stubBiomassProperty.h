@@ -15,6 +15,14 @@
   }
 #endif //STUB_BiomassProperty_install
 
+#ifndef STUB_BiomassProperty_install
+//#define STUB_BiomassProperty_install
+  void BiomassProperty::install(TypeNode*, const std::string&)
+  {
+    
+  }
+#endif //STUB_BiomassProperty_install
+
 #ifndef STUB_BiomassProperty_remove
 //#define STUB_BiomassProperty_remove
   void BiomassProperty::remove(LocatedEntity*, const std::string&)
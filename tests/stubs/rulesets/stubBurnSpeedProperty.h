@@ -15,6 +15,14 @@
   }
 #endif //STUB_BurnSpeedProperty_install
 
+#ifndef STUB_BurnSpeedProperty_install
+//#define STUB_BurnSpeedProperty_install
+  void BurnSpeedProperty::install(TypeNode*, const std::string&)
+  {
+    
+  }
+#endif //STUB_BurnSpeedProperty_install
+
 #ifndef STUB_BurnSpeedProperty_remove
 //#define STUB_BurnSpeedProperty_remove
   void BurnSpeedProperty::remove(LocatedEntity*, const std::string&)
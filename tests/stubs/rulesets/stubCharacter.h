@@ -67,7 +67,7 @@
 
 #ifndef STUB_Character_linkExternal
 //#define STUB_Character_linkExternal
-  int Character::linkExternal(Link *)
+  int Character::linkExternal(Link *, bool possessed )
   {
     return 0;
   }
@@ -15,6 +15,14 @@
   }
 #endif //STUB_DecaysProperty_install
 
+#ifndef STUB_DecaysProperty_install
+//#define STUB_DecaysProperty_install
+  void DecaysProperty::install(TypeNode*, const std::string&)
+  {
+    
+  }
+#endif //STUB_DecaysProperty_install
+
 #ifndef STUB_DecaysProperty_remove
 //#define STUB_DecaysProperty_remove
   void DecaysProperty::remove(LocatedEntity*, const std::string&)
@@ -23,6 +23,14 @@
   }
 #endif //STUB_DensityProperty_copy
 
+#ifndef STUB_DensityProperty_typeId
+//#define STUB_DensityProperty_typeId
+  PropertyTypeId DensityProperty::typeId() const
+  {
+    return propertyTypeId<DensityProperty>();
+  }
+#endif //STUB_DensityProperty_typeId
+
 #ifndef STUB_DensityProperty_updateMass
 //#define STUB_DensityProperty_updateMass
   void DensityProperty::updateMass(LocatedEntity *entity) const
@@ -15,6 +15,14 @@
   }
 #endif //STUB_DomainProperty_install
 
+#ifndef STUB_DomainProperty_install
+//#define STUB_DomainProperty_install
+  void DomainProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_DomainProperty_install
+
 #ifndef STUB_DomainProperty_remove
 //#define STUB_DomainProperty_remove
   void DomainProperty::remove(LocatedEntity *, const std::string &)
@@ -31,6 +39,14 @@
   }
 #endif //STUB_DomainProperty_copy
 
+#ifndef STUB_DomainProperty_typeId
+//#define STUB_DomainProperty_typeId
+  PropertyTypeId DomainProperty::typeId() const
+  {
+    return propertyTypeId<DomainProperty>();
+  }
+#endif //STUB_DomainProperty_typeId
+
 #ifndef STUB_DomainProperty_apply
 //#define STUB_DomainProperty_apply
   void DomainProperty::apply(LocatedEntity *)
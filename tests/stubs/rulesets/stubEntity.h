@@ -42,7 +42,7 @@
 
 #ifndef STUB_Entity_getProperty
 //#define STUB_Entity_getProperty
-  const PropertyBase* Entity::getProperty(const std::string & name) const
+  const PropertyBase* Entity::getProperty(const PropertyKey & key) const
   {
     return nullptr;
   }
@@ -50,7 +50,7 @@
 
 #ifndef STUB_Entity_modProperty
 //#define STUB_Entity_modProperty
-  PropertyBase* Entity::modProperty(const std::string & name, const Atlas::Message::Element& def_val )
+  PropertyBase* Entity::modProperty(const PropertyKey & key, const Atlas::Message::Element& def_val )
   {
     return nullptr;
   }
@@ -304,6 +304,14 @@
   }
 #endif //STUB_Entity_callDelegate
 
+#ifndef STUB_Entity_callDelegate
+//#define STUB_Entity_callDelegate
+  HandlerResult Entity::callDelegate(const PropertyKey &, const Operation &, OpVector &)
+  {
+    return *static_cast<HandlerResult*>(nullptr);
+  }
+#endif //STUB_Entity_callDelegate
+
 #ifndef STUB_Entity_callOperation
 //#define STUB_Entity_callOperation
   void Entity::callOperation(const Operation &, OpVector &)
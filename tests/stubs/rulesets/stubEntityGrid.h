@@ -0,0 +1,67 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubEntityGrid_custom.h file.
+
+#include "rulesets/EntityGrid.h"
+#include "stubEntityGrid_custom.h"
+
+#ifndef STUB_RULESETS_ENTITYGRID_H
+#define STUB_RULESETS_ENTITYGRID_H
+
+#ifndef STUB_EntityGrid_EntityGrid
+//#define STUB_EntityGrid_EntityGrid
+   EntityGrid::EntityGrid(WFMath::CoordType cellSize )
+  {
+    
+  }
+#endif //STUB_EntityGrid_EntityGrid
+
+#ifndef STUB_EntityGrid_update
+//#define STUB_EntityGrid_update
+  void EntityGrid::update(LocatedEntity * entity, const Point3D & pos)
+  {
+    
+  }
+#endif //STUB_EntityGrid_update
+
+#ifndef STUB_EntityGrid_remove
+//#define STUB_EntityGrid_remove
+  bool EntityGrid::remove(LocatedEntity * entity)
+  {
+    return false;
+  }
+#endif //STUB_EntityGrid_remove
+
+#ifndef STUB_EntityGrid_clear
+//#define STUB_EntityGrid_clear
+  void EntityGrid::clear()
+  {
+    
+  }
+#endif //STUB_EntityGrid_clear
+
+#ifndef STUB_EntityGrid_collect
+//#define STUB_EntityGrid_collect
+  void EntityGrid::collect(const Point3D & centre, WFMath::CoordType radius, std::vector<LocatedEntity *> & res) const
+  {
+    
+  }
+#endif //STUB_EntityGrid_collect
+
+#ifndef STUB_EntityGrid_cellIndex
+//#define STUB_EntityGrid_cellIndex
+  int EntityGrid::cellIndex(WFMath::CoordType coord) const
+  {
+    return 0;
+  }
+#endif //STUB_EntityGrid_cellIndex
+
+#ifndef STUB_EntityGrid_removeFromCell
+//#define STUB_EntityGrid_removeFromCell
+  void EntityGrid::removeFromCell(LocatedEntity * entity, CellKey cell)
+  {
+    
+  }
+#endif //STUB_EntityGrid_removeFromCell
+
+
+#endif
\ No newline at end of file
@@ -56,5 +56,13 @@
   }
 #endif //STUB_EntityProperty_copy
 
+#ifndef STUB_EntityProperty_typeId
+//#define STUB_EntityProperty_typeId
+  PropertyTypeId EntityProperty::typeId() const
+  {
+    return propertyTypeId<EntityProperty>();
+  }
+#endif //STUB_EntityProperty_typeId
+
 
 #endif
\ No newline at end of file
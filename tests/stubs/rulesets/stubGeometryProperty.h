@@ -31,6 +31,14 @@
   }
 #endif //STUB_GeometryProperty_copy
 
+#ifndef STUB_GeometryProperty_typeId
+//#define STUB_GeometryProperty_typeId
+  PropertyTypeId GeometryProperty::typeId() const
+  {
+    return propertyTypeId<GeometryProperty>();
+  }
+#endif //STUB_GeometryProperty_typeId
+
 #ifndef STUB_GeometryProperty_createShape
 //#define STUB_GeometryProperty_createShape
   std::pair<btCollisionShape*, std::shared_ptr<btCollisionShape>> GeometryProperty::createShape(const WFMath::AxisBox<3>& bbox, btVector3& centerOfMassOffset, float mass) const
@@ -47,5 +55,13 @@
   }
 #endif //STUB_GeometryProperty_buildMeshCreator
 
+#ifndef STUB_GeometryProperty_buildCompoundCreator
+//#define STUB_GeometryProperty_buildCompoundCreator
+  void GeometryProperty::buildCompoundCreator()
+  {
+    
+  }
+#endif //STUB_GeometryProperty_buildCompoundCreator
+
 
 #endif
\ No newline at end of file
@@ -15,6 +15,14 @@
   }
 #endif //STUB_ImmortalProperty_install
 
+#ifndef STUB_ImmortalProperty_install
+//#define STUB_ImmortalProperty_install
+  void ImmortalProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_ImmortalProperty_install
+
 #ifndef STUB_ImmortalProperty_remove
 //#define STUB_ImmortalProperty_remove
   void ImmortalProperty::remove(LocatedEntity *, const std::string &)
@@ -91,7 +91,7 @@
 
 #ifndef STUB_LocatedEntity_getProperty
 //#define STUB_LocatedEntity_getProperty
-  const PropertyBase* LocatedEntity::getProperty(const std::string & name) const
+  const PropertyBase* LocatedEntity::getProperty(const PropertyKey & key) const
   {
     return nullptr;
   }
@@ -99,7 +99,7 @@
 
 #ifndef STUB_LocatedEntity_modProperty
 //#define STUB_LocatedEntity_modProperty
-  PropertyBase* LocatedEntity::modProperty(const std::string & name, const Atlas::Message::Element& def_val )
+  PropertyBase* LocatedEntity::modProperty(const PropertyKey & key, const Atlas::Message::Element& def_val )
   {
     return nullptr;
   }
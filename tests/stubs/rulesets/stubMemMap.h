@@ -55,6 +55,78 @@
   }
 #endif //STUB_MemMap_addId
 
+#ifndef STUB_MemMap_getGrid
+//#define STUB_MemMap_getGrid
+  EntityGrid* MemMap::getGrid(LocatedEntity * place)
+  {
+    return nullptr;
+  }
+#endif //STUB_MemMap_getGrid
+
+#ifndef STUB_MemMap_updateGrid
+//#define STUB_MemMap_updateGrid
+  void MemMap::updateGrid(MemEntity * entity, LocatedEntity * old_loc)
+  {
+    
+  }
+#endif //STUB_MemMap_updateGrid
+
+#ifndef STUB_MemMap_unlink
+//#define STUB_MemMap_unlink
+  void MemMap::unlink(MemEntity * entity)
+  {
+    
+  }
+#endif //STUB_MemMap_unlink
+
+#ifndef STUB_MemMap_release
+//#define STUB_MemMap_release
+  void MemMap::release(MemEntity * entity)
+  {
+    
+  }
+#endif //STUB_MemMap_release
+
+#ifndef STUB_MemMap_releasePending
+//#define STUB_MemMap_releasePending
+  void MemMap::releasePending()
+  {
+    
+  }
+#endif //STUB_MemMap_releasePending
+
+#ifndef STUB_MemMap_isEvictable
+//#define STUB_MemMap_isEvictable
+  bool MemMap::isEvictable(const MemEntity * entity) const
+  {
+    return false;
+  }
+#endif //STUB_MemMap_isEvictable
+
+#ifndef STUB_MemMap_evict
+//#define STUB_MemMap_evict
+  void MemMap::evict(MemEntity * entity)
+  {
+    
+  }
+#endif //STUB_MemMap_evict
+
+#ifndef STUB_MemMap_enforceBudget
+//#define STUB_MemMap_enforceBudget
+  void MemMap::enforceBudget()
+  {
+    
+  }
+#endif //STUB_MemMap_enforceBudget
+
+#ifndef STUB_MemMap_reportStatistics
+//#define STUB_MemMap_reportStatistics
+  void MemMap::reportStatistics()
+  {
+    
+  }
+#endif //STUB_MemMap_reportStatistics
+
 #ifndef STUB_MemMap_MemMap
 //#define STUB_MemMap_MemMap
    MemMap::MemMap(Script *& s)
@@ -64,6 +136,14 @@
   }
 #endif //STUB_MemMap_MemMap
 
+#ifndef STUB_MemMap_MemMap_DTOR
+//#define STUB_MemMap_MemMap_DTOR
+   MemMap::~MemMap()
+  {
+    
+  }
+#endif //STUB_MemMap_MemMap_DTOR
+
 #ifndef STUB_MemMap_find
 //#define STUB_MemMap_find
   bool MemMap::find(const std::string & id) const
@@ -72,6 +152,14 @@
   }
 #endif //STUB_MemMap_find
 
+#ifndef STUB_MemMap_getEntitiesOfTypes
+//#define STUB_MemMap_getEntitiesOfTypes
+  void MemMap::getEntitiesOfTypes(const TypeNode * type, bool includeSubtypes, std::vector<const MemEntityDict *> & res) const
+  {
+    
+  }
+#endif //STUB_MemMap_getEntitiesOfTypes
+
 #ifndef STUB_MemMap_sendLooks
 //#define STUB_MemMap_sendLooks
   void MemMap::sendLooks(OpVector &)
@@ -138,7 +226,7 @@
 
 #ifndef STUB_MemMap_findByType
 //#define STUB_MemMap_findByType
-  EntityVector MemMap::findByType(const std::string & what)
+  EntityVector MemMap::findByType(const std::string & what, bool includeSubtypes )
   {
     return *static_cast<EntityVector*>(nullptr);
   }
@@ -146,12 +234,20 @@
 
 #ifndef STUB_MemMap_findByLocation
 //#define STUB_MemMap_findByLocation
-  EntityVector MemMap::findByLocation(const Location & where, WFMath::CoordType radius, const std::string & what)
+  EntityVector MemMap::findByLocation(const Location & where, WFMath::CoordType radius, const std::string & what, bool sort )
   {
     return *static_cast<EntityVector*>(nullptr);
   }
 #endif //STUB_MemMap_findByLocation
 
+#ifndef STUB_MemMap_findInRange
+//#define STUB_MemMap_findInRange
+  void MemMap::findInRange(const Location & where, WFMath::CoordType radius, const TypeNode * type, EntityVector & res, bool sort )
+  {
+    
+  }
+#endif //STUB_MemMap_findInRange
+
 #ifndef STUB_MemMap_check
 //#define STUB_MemMap_check
   void MemMap::check(const double &)
@@ -176,5 +272,13 @@
   }
 #endif //STUB_MemMap_setListener
 
+#ifndef STUB_MemMap_setBudget
+//#define STUB_MemMap_setBudget
+  void MemMap::setBudget(std::size_t budget)
+  {
+    
+  }
+#endif //STUB_MemMap_setBudget
+
 
 #endif
\ No newline at end of file
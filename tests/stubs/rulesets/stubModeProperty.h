@@ -32,6 +32,14 @@
   }
 #endif //STUB_ModeProperty_copy
 
+#ifndef STUB_ModeProperty_typeId
+//#define STUB_ModeProperty_typeId
+  PropertyTypeId ModeProperty::typeId() const
+  {
+    return propertyTypeId<ModeProperty>();
+  }
+#endif //STUB_ModeProperty_typeId
+
 #ifndef STUB_ModeProperty_set
 //#define STUB_ModeProperty_set
   void ModeProperty::set(const Atlas::Message::Element& val)
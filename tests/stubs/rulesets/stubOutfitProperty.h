@@ -72,6 +72,14 @@
   }
 #endif //STUB_OutfitProperty_copy
 
+#ifndef STUB_OutfitProperty_typeId
+//#define STUB_OutfitProperty_typeId
+  PropertyTypeId OutfitProperty::typeId() const
+  {
+    return propertyTypeId<OutfitProperty>();
+  }
+#endif //STUB_OutfitProperty_typeId
+
 #ifndef STUB_OutfitProperty_getEntity
 //#define STUB_OutfitProperty_getEntity
   LocatedEntity* OutfitProperty::getEntity(const std::string& key) const
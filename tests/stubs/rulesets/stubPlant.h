@@ -7,6 +7,14 @@
 #ifndef STUB_RULESETS_PLANT_H
 #define STUB_RULESETS_PLANT_H
 
+#ifndef STUB_Plant_grow
+//#define STUB_Plant_grow
+  void Plant::grow(OpVector & res)
+  {
+    
+  }
+#endif //STUB_Plant_grow
+
 #ifndef STUB_Plant_handleFruiting
 //#define STUB_Plant_handleFruiting
   void Plant::handleFruiting(OpVector & res, Property<int>& fruits_prop)
@@ -64,5 +64,13 @@
   }
 #endif //STUB_PropelProperty_copy
 
+#ifndef STUB_PropelProperty_typeId
+//#define STUB_PropelProperty_typeId
+  PropertyTypeId PropelProperty::typeId() const
+  {
+    return propertyTypeId<PropelProperty>();
+  }
+#endif //STUB_PropelProperty_typeId
+
 
 #endif
\ No newline at end of file
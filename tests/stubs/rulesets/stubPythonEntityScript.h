@@ -9,7 +9,7 @@
 
 #ifndef STUB_PythonEntityScript_PythonEntityScript
 //#define STUB_PythonEntityScript_PythonEntityScript
-   PythonEntityScript::PythonEntityScript(PyObject *)
+   PythonEntityScript::PythonEntityScript(PyObject *, std::shared_ptr<PythonOperationHandlers> handlers )
     : PythonWrapper(PyObject)
   {
     
@@ -32,6 +32,14 @@
   }
 #endif //STUB_PythonEntityScript_operation
 
+#ifndef STUB_PythonEntityScript_handlesOperation
+//#define STUB_PythonEntityScript_handlesOperation
+  bool PythonEntityScript::handlesOperation(const std::string & opname, int op_no)
+  {
+    return false;
+  }
+#endif //STUB_PythonEntityScript_handlesOperation
+
 #ifndef STUB_PythonEntityScript_hook
 //#define STUB_PythonEntityScript_hook
   void PythonEntityScript::hook(const std::string & function, LocatedEntity * entity)
@@ -0,0 +1,52 @@
+// AUTOGENERATED file, created by the tool generate_stub.py, don't edit!
+// If you want to add your own functionality, instead edit the stubPythonOperationHandlers_custom.h file.
+
+#include "rulesets/PythonOperationHandlers.h"
+#include "stubPythonOperationHandlers_custom.h"
+
+#ifndef STUB_RULESETS_PYTHONOPERATIONHANDLERS_H
+#define STUB_RULESETS_PYTHONOPERATIONHANDLERS_H
+
+#ifndef STUB_PythonOperationHandlers_resolve
+//#define STUB_PythonOperationHandlers_resolve
+  PythonOperationHandlers::Handler PythonOperationHandlers::resolve(const std::string & op_type) const
+  {
+    return Handler();
+  }
+#endif //STUB_PythonOperationHandlers_resolve
+
+#ifndef STUB_PythonOperationHandlers_PythonOperationHandlers
+//#define STUB_PythonOperationHandlers_PythonOperationHandlers
+   PythonOperationHandlers::PythonOperationHandlers(struct _object * cls)
+    : m_hasGetattr(false)
+  {
+    
+  }
+#endif //STUB_PythonOperationHandlers_PythonOperationHandlers
+
+#ifndef STUB_PythonOperationHandlers_PythonOperationHandlers_DTOR
+//#define STUB_PythonOperationHandlers_PythonOperationHandlers_DTOR
+   PythonOperationHandlers::~PythonOperationHandlers()
+  {
+    
+  }
+#endif //STUB_PythonOperationHandlers_PythonOperationHandlers_DTOR
+
+#ifndef STUB_PythonOperationHandlers_handler
+//#define STUB_PythonOperationHandlers_handler
+  struct _object* PythonOperationHandlers::handler(int class_no, const std::string & op_type, int *& calls)
+  {
+    return nullptr;
+  }
+#endif //STUB_PythonOperationHandlers_handler
+
+#ifndef STUB_PythonOperationHandlers_instanceHandles
+//#define STUB_PythonOperationHandlers_instanceHandles
+  bool PythonOperationHandlers::instanceHandles(struct _object * instance, const std::string & op_type) const
+  {
+    return false;
+  }
+#endif //STUB_PythonOperationHandlers_instanceHandles
+
+
+#endif
\ No newline at end of file
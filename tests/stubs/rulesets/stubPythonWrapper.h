@@ -25,5 +25,13 @@
   }
 #endif //STUB_PythonWrapper_PythonWrapper_DTOR
 
+#ifndef STUB_PythonWrapper_isReferenced
+//#define STUB_PythonWrapper_isReferenced
+  bool PythonWrapper::isReferenced() const
+  {
+    return false;
+  }
+#endif //STUB_PythonWrapper_isReferenced
+
 
 #endif
\ No newline at end of file
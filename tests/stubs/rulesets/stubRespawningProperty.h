@@ -32,6 +32,14 @@
   }
 #endif //STUB_RespawningProperty_install
 
+#ifndef STUB_RespawningProperty_install
+//#define STUB_RespawningProperty_install
+  void RespawningProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_RespawningProperty_install
+
 #ifndef STUB_RespawningProperty_remove
 //#define STUB_RespawningProperty_remove
   void RespawningProperty::remove(LocatedEntity *, const std::string &)
@@ -31,6 +31,14 @@
   }
 #endif //STUB_Script_operation
 
+#ifndef STUB_Script_handlesOperation
+//#define STUB_Script_handlesOperation
+  bool Script::handlesOperation(const std::string & opname, int op_no)
+  {
+    return false;
+  }
+#endif //STUB_Script_handlesOperation
+
 #ifndef STUB_Script_hook
 //#define STUB_Script_hook
   void Script::hook(const std::string & function, LocatedEntity * entity)
@@ -39,5 +47,13 @@
   }
 #endif //STUB_Script_hook
 
+#ifndef STUB_Script_isReferenced
+//#define STUB_Script_isReferenced
+  bool Script::isReferenced() const
+  {
+    return false;
+  }
+#endif //STUB_Script_isReferenced
+
 
 #endif
\ No newline at end of file
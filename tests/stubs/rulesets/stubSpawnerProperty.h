@@ -32,6 +32,14 @@
   }
 #endif //STUB_SpawnerProperty_install
 
+#ifndef STUB_SpawnerProperty_install
+//#define STUB_SpawnerProperty_install
+  void SpawnerProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_SpawnerProperty_install
+
 #ifndef STUB_SpawnerProperty_remove
 //#define STUB_SpawnerProperty_remove
   void SpawnerProperty::remove(LocatedEntity *, const std::string &)
@@ -15,6 +15,14 @@
   }
 #endif //STUB_StatusProperty_copy
 
+#ifndef STUB_StatusProperty_typeId
+//#define STUB_StatusProperty_typeId
+  PropertyTypeId StatusProperty::typeId() const
+  {
+    return propertyTypeId<StatusProperty>();
+  }
+#endif //STUB_StatusProperty_typeId
+
 #ifndef STUB_StatusProperty_apply
 //#define STUB_StatusProperty_apply
   void StatusProperty::apply(LocatedEntity *)
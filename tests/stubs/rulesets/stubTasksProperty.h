@@ -41,6 +41,14 @@
   }
 #endif //STUB_TasksProperty_copy
 
+#ifndef STUB_TasksProperty_typeId
+//#define STUB_TasksProperty_typeId
+  PropertyTypeId TasksProperty::typeId() const
+  {
+    return propertyTypeId<TasksProperty>();
+  }
+#endif //STUB_TasksProperty_typeId
+
 #ifndef STUB_TasksProperty_updateTask
 //#define STUB_TasksProperty_updateTask
   int TasksProperty::updateTask(LocatedEntity * owner, OpVector & res)
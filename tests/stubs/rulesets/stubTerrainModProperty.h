@@ -33,6 +33,14 @@
   }
 #endif //STUB_TerrainModProperty_copy
 
+#ifndef STUB_TerrainModProperty_typeId
+//#define STUB_TerrainModProperty_typeId
+  PropertyTypeId TerrainModProperty::typeId() const
+  {
+    return propertyTypeId<TerrainModProperty>();
+  }
+#endif //STUB_TerrainModProperty_typeId
+
 #ifndef STUB_TerrainModProperty_apply
 //#define STUB_TerrainModProperty_apply
   void TerrainModProperty::apply(LocatedEntity*)
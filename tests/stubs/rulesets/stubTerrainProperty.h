@@ -51,6 +51,14 @@
   }
 #endif //STUB_TerrainProperty_install
 
+#ifndef STUB_TerrainProperty_install
+//#define STUB_TerrainProperty_install
+  void TerrainProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_TerrainProperty_install
+
 #ifndef STUB_TerrainProperty_remove
 //#define STUB_TerrainProperty_remove
   void TerrainProperty::remove(LocatedEntity *, const std::string &)
@@ -83,6 +91,14 @@
   }
 #endif //STUB_TerrainProperty_copy
 
+#ifndef STUB_TerrainProperty_typeId
+//#define STUB_TerrainProperty_typeId
+  PropertyTypeId TerrainProperty::typeId() const
+  {
+    return propertyTypeId<TerrainProperty>();
+  }
+#endif //STUB_TerrainProperty_typeId
+
 #ifndef STUB_TerrainProperty_operation
 //#define STUB_TerrainProperty_operation
   HandlerResult TerrainProperty::operation(LocatedEntity *, const Operation &, OpVector &)
@@ -57,7 +57,7 @@
 
 #ifndef STUB_Account_connectCharacter
 //#define STUB_Account_connectCharacter
-  int Account::connectCharacter(LocatedEntity *chr)
+  int Account::connectCharacter(LocatedEntity *chr, bool possessed )
   {
     return 0;
   }
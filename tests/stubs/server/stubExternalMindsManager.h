@@ -39,6 +39,14 @@
   }
 #endif //STUB_ExternalMindsManager_requestPossession
 
+#ifndef STUB_ExternalMindsManager_getConnectionLoad
+//#define STUB_ExternalMindsManager_getConnectionLoad
+  size_t ExternalMindsManager::getConnectionLoad(const std::string& routerId) const
+  {
+    return 0;
+  }
+#endif //STUB_ExternalMindsManager_getConnectionLoad
+
 #ifndef STUB_ExternalMindsManager_entity_destroyed
 //#define STUB_ExternalMindsManager_entity_destroyed
   void ExternalMindsManager::entity_destroyed(Character* character)
@@ -63,6 +71,30 @@
   }
 #endif //STUB_ExternalMindsManager_requestPossessionFromRegisteredClients
 
+#ifndef STUB_ExternalMindsManager_findLeastLoadedConnection
+//#define STUB_ExternalMindsManager_findLeastLoadedConnection
+  ExternalMindsConnection* ExternalMindsManager::findLeastLoadedConnection()
+  {
+    return nullptr;
+  }
+#endif //STUB_ExternalMindsManager_findLeastLoadedConnection
+
+#ifndef STUB_ExternalMindsManager_findPossessingRouter
+//#define STUB_ExternalMindsManager_findPossessingRouter
+  std::string ExternalMindsManager::findPossessingRouter(Character* character) const
+  {
+    return "";
+  }
+#endif //STUB_ExternalMindsManager_findPossessingRouter
+
+#ifndef STUB_ExternalMindsManager_updateConnectionMonitor
+//#define STUB_ExternalMindsManager_updateConnectionMonitor
+  void ExternalMindsManager::updateConnectionMonitor(const std::string& routerId) const
+  {
+    
+  }
+#endif //STUB_ExternalMindsManager_updateConnectionMonitor
+
 #ifndef STUB_ExternalMindsManager_addPossessionEntryForCharacter
 //#define STUB_ExternalMindsManager_addPossessionEntryForCharacter
   void ExternalMindsManager::addPossessionEntryForCharacter(Character& character)
@@ -15,6 +15,14 @@
   }
 #endif //STUB_TeleportProperty_install
 
+#ifndef STUB_TeleportProperty_install
+//#define STUB_TeleportProperty_install
+  void TeleportProperty::install(TypeNode *, const std::string &)
+  {
+    
+  }
+#endif //STUB_TeleportProperty_install
+
 #ifndef STUB_TeleportProperty_operation
 //#define STUB_TeleportProperty_operation
   HandlerResult TeleportProperty::operation(LocatedEntity *, const Operation &, OpVector &)